@@ -2,12 +2,15 @@ from .constraint_component_base import *
 from .impact_constraint_component_base import *
 from .joint_position_lower_limit import *
 from .joint_position_upper_limit import *
+from .joint_position_box_limit import *
 from .joint_velocity_lower_limit import *
 from .joint_velocity_upper_limit import *
+from .joint_velocity_box_limit import *
 from .joint_acceleration_lower_limit import *
 from .joint_acceleration_upper_limit import *
 from .joint_torques_lower_limit import *
 from .joint_torques_upper_limit import *
+from .joint_torques_box_limit import *
 from .friction_cone import *
 from .impact_friction_cone import *
 from .contact_wrench_cone import *
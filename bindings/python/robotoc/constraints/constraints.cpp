@@ -33,8 +33,11 @@ PYBIND11_MODULE(constraints, m) {
           py::arg("barrier_param"))
     .def("set_fraction_to_boundary_rule", &Constraints::setFractionToBoundaryRule,
           py::arg("fraction_to_boundary_rule"))
+    .def("set_screening_ratio", &Constraints::setScreeningRatio,
+          py::arg("screening_ratio"))
     .def("get_barrier_param", &Constraints::getBarrierParam)
     .def("get_fraction_to_boundary_rule", &Constraints::getFractionToBoundaryRule)
+    .def("get_screening_ratio", &Constraints::getScreeningRatio)
     .def("get_position_level_constraint_list", &Constraints::getPositionLevelConstraintList)
     .def("get_velocity_level_constraint_list", &Constraints::getVelocityLevelConstraintList)
     .def("get_acceleration_level_constraint_list", &Constraints::getAccelerationLevelConstraintList)
@@ -0,0 +1,23 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
+
+#include "robotoc/constraints/joint_torques_box_limit.hpp"
+#include "robotoc/utils/pybind11_macros.hpp"
+
+
+namespace robotoc {
+namespace python {
+
+namespace py = pybind11;
+
+PYBIND11_MODULE(joint_torques_box_limit, m) {
+  py::class_<JointTorquesBoxLimit, ConstraintComponentBase, 
+             std::shared_ptr<JointTorquesBoxLimit>>(m, "JointTorquesBoxLimit")
+    .def(py::init<const Robot&>(),
+         py::arg("robot"))
+    DEFINE_ROBOTOC_PYBIND11_CLASS_CLONE(JointTorquesBoxLimit);
+}
+
+} // namespace python
+} // namespace robotoc
\ No newline at end of file
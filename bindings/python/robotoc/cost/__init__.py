@@ -13,4 +13,7 @@ from .local_contact_force_cost import *
 from .periodic_swing_foot_ref import *
 from .periodic_com_ref import *
 from .discrete_time_swing_foot_ref import *
-from .discrete_time_com_ref import *
\ No newline at end of file
+from .discrete_time_com_ref import *
+from .cached_configuration_space_ref import *
+from .cached_task_space_3d_ref import *
+from .cached_com_ref import *
\ No newline at end of file
@@ -0,0 +1,29 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
+
+#include "robotoc/cost/cached_com_ref.hpp"
+
+
+namespace robotoc {
+namespace python {
+
+namespace py = pybind11;
+
+PYBIND11_MODULE(cached_com_ref, m) {
+  py::class_<CachedCoMRef, CoMRefBase,
+             std::shared_ptr<CachedCoMRef>>(m, "CachedCoMRef")
+    .def(py::init<const std::shared_ptr<CoMRefBase>&>(),
+          py::arg("ref"))
+    .def("update_cache", &CachedCoMRef::updateCache,
+          py::arg("time_discretization"))
+    .def("clear_cache", &CachedCoMRef::clearCache)
+    .def("get_ref", &CachedCoMRef::getRef)
+    .def("updateRef", &CachedCoMRef::updateRef,
+          py::arg("grid_info"), py::arg("com_ref"))
+    .def("is_active", &CachedCoMRef::isActive,
+          py::arg("grid_info"));
+}
+
+} // namespace python
+} // namespace robotoc
\ No newline at end of file
@@ -0,0 +1,30 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
+
+#include "robotoc/cost/cached_configuration_space_ref.hpp"
+
+
+namespace robotoc {
+namespace python {
+
+namespace py = pybind11;
+
+PYBIND11_MODULE(cached_configuration_space_ref, m) {
+  py::class_<CachedConfigurationSpaceRef, ConfigurationSpaceRefBase,
+             std::shared_ptr<CachedConfigurationSpaceRef>>(m, "CachedConfigurationSpaceRef")
+    .def(py::init<const std::shared_ptr<ConfigurationSpaceRefBase>&, 
+                  const Robot&>(),
+          py::arg("ref"), py::arg("robot"))
+    .def("update_cache", &CachedConfigurationSpaceRef::updateCache,
+          py::arg("robot"), py::arg("time_discretization"))
+    .def("clear_cache", &CachedConfigurationSpaceRef::clearCache)
+    .def("get_ref", &CachedConfigurationSpaceRef::getRef)
+    .def("updateRef", &CachedConfigurationSpaceRef::updateRef,
+          py::arg("robot"), py::arg("grid_info"), py::arg("q_ref"))
+    .def("is_active", &CachedConfigurationSpaceRef::isActive,
+          py::arg("grid_info"));
+}
+
+} // namespace python
+} // namespace robotoc
\ No newline at end of file
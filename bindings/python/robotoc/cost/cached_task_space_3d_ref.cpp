@@ -0,0 +1,29 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
+
+#include "robotoc/cost/cached_task_space_3d_ref.hpp"
+
+
+namespace robotoc {
+namespace python {
+
+namespace py = pybind11;
+
+PYBIND11_MODULE(cached_task_space_3d_ref, m) {
+  py::class_<CachedTaskSpace3DRef, TaskSpace3DRefBase,
+             std::shared_ptr<CachedTaskSpace3DRef>>(m, "CachedTaskSpace3DRef")
+    .def(py::init<const std::shared_ptr<TaskSpace3DRefBase>&>(),
+          py::arg("ref"))
+    .def("update_cache", &CachedTaskSpace3DRef::updateCache,
+          py::arg("time_discretization"))
+    .def("clear_cache", &CachedTaskSpace3DRef::clearCache)
+    .def("get_ref", &CachedTaskSpace3DRef::getRef)
+    .def("updateRef", &CachedTaskSpace3DRef::updateRef,
+          py::arg("grid_info"), py::arg("x3d_ref"))
+    .def("is_active", &CachedTaskSpace3DRef::isActive,
+          py::arg("grid_info"));
+}
+
+} // namespace python
+} // namespace robotoc
\ No newline at end of file
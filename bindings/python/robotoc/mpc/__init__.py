@@ -1,4 +1,5 @@
 from .control_policy import *
+from .state_feedback_policy import *
 from .contact_planner_base import *
 from .trot_foot_step_planner import *
 from .crawl_foot_step_planner import *
@@ -6,6 +7,7 @@ from .pace_foot_step_planner import *
 from .biped_walk_foot_step_planner import *
 from .jump_foot_step_planner import *
 from .flying_trot_foot_step_planner import *
+from .gait_table import *
 from .mpc_periodic_swing_foot_ref import *
 from .mpc_periodic_com_ref import *
 from .mpc_periodic_configuration_ref import *
@@ -14,4 +16,5 @@ from .mpc_crawl import *
 from .mpc_pace import *
 from .mpc_biped_walk import *
 from .mpc_jump import *
-from .mpc_flying_trot import *
\ No newline at end of file
+from .mpc_flying_trot import *
+from .mpc_gait import *
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include <pybind11/numpy.h>
 
 #include "robotoc/mpc/control_policy.hpp"
+#include "robotoc/mpc/control_policy_table.hpp"
 #include "robotoc/utils/pybind11_macros.hpp"
 
 
@@ -26,6 +27,17 @@ PYBIND11_MODULE(control_policy, m) {
          py::arg("ocp_solver"), py::arg("t"))
     DEFINE_ROBOTOC_PYBIND11_CLASS_CLONE(ControlPolicy)
     DEFINE_ROBOTOC_PYBIND11_CLASS_PRINT(ControlPolicy);
+
+  py::class_<ControlPolicyTable>(m, "ControlPolicyTable")
+    .def(py::init<const OCPSolver&>(),
+         py::arg("ocp_solver"))
+    .def(py::init<>())
+    .def("update", &ControlPolicyTable::update,
+         py::arg("ocp_solver"))
+    .def("get", &ControlPolicyTable::get,
+         py::arg("t"))
+    .def("size", &ControlPolicyTable::size)
+    DEFINE_ROBOTOC_PYBIND11_CLASS_CLONE(ControlPolicyTable);
 }
 
 } // namespace python
@@ -0,0 +1,30 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+#include "robotoc/mpc/gait_table.hpp"
+#include "robotoc/utils/pybind11_macros.hpp"
+
+
+namespace robotoc {
+namespace python {
+
+namespace py = pybind11;
+
+PYBIND11_MODULE(gait_table, m) {
+  py::class_<GaitTable>(m, "GaitTable")
+    .def(py::init<const std::vector<std::vector<int>>&, const std::vector<double>&>(),
+          py::arg("active_contacts"), py::arg("durations"))
+    .def(py::init<>())
+    .def("num_phases", &GaitTable::numPhases)
+    .def("active_contacts", &GaitTable::activeContacts,
+          py::arg("phase"))
+    .def("duration", &GaitTable::duration,
+          py::arg("phase"))
+    .def("period", &GaitTable::period)
+    .def("min_duration", &GaitTable::minDuration)
+    DEFINE_ROBOTOC_PYBIND11_CLASS_CLONE(GaitTable)
+    DEFINE_ROBOTOC_PYBIND11_CLASS_PRINT(GaitTable);
+}
+
+} // namespace python
+} // namespace robotoc
\ No newline at end of file
@@ -0,0 +1,61 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
+
+#include "robotoc/mpc/mpc_gait.hpp"
+#include "robotoc/utils/pybind11_macros.hpp"
+
+
+namespace robotoc {
+namespace python {
+
+namespace py = pybind11;
+
+PYBIND11_MODULE(mpc_gait, m) {
+  py::class_<MPCGait>(m, "MPCGait")
+    .def(py::init<const Robot&, const double, const int, const int>(),
+         py::arg("robot"), py::arg("T"), py::arg("N"), 
+         py::arg("max_num_discrete_events"))
+    .def("set_gait", &MPCGait::setGait,
+         py::arg("planner"), py::arg("gait_table"), py::arg("swing_height"), 
+         py::arg("gait_start_time"))
+    .def("init", &MPCGait::init,
+          py::arg("t"), py::arg("q"), py::arg("v"), py::arg("solver_options"))
+    .def("switch_gait", &MPCGait::switchGait,
+         py::arg("planner"), py::arg("gait_table"), py::arg("swing_height"), 
+         py::arg("t"), py::arg("q"))
+    .def("reset", 
+          static_cast<void (MPCGait::*)()>(&MPCGait::reset))
+    .def("reset", 
+          static_cast<void (MPCGait::*)(const Eigen::VectorXd&, const Eigen::VectorXd&)>(&MPCGait::reset),
+          py::arg("q"), py::arg("v"))
+    .def("set_solver_options", &MPCGait::setSolverOptions,
+          py::arg("solver_options"))
+    .def("update_solution", &MPCGait::updateSolution,
+          py::arg("t"), py::arg("dt"), py::arg("q"), py::arg("v"))
+    .def("get_initial_control_input", &MPCGait::getInitialControlInput)
+    .def("get_solution", &MPCGait::getSolution)
+    .def("get_control_policy", &MPCGait::getControlPolicy,
+          py::arg("t"))
+    .def("KKT_error", 
+          static_cast<double (MPCGait::*)(const double, const Eigen::VectorXd&, const Eigen::VectorXd&)>(&MPCGait::KKTError),
+          py::arg("t"), py::arg("q"), py::arg("v"))
+    .def("KKT_error", 
+          static_cast<double (MPCGait::*)() const>(&MPCGait::KKTError))
+    .def("get_cost_handle", &MPCGait::getCostHandle)
+    .def("get_config_cost_handle", &MPCGait::getConfigCostHandle)
+    .def("get_base_rotation_cost_handle", &MPCGait::getBaseRotationCostHandle)
+    .def("get_swing_foot_cost_handle", &MPCGait::getSwingFootCostHandle)
+    .def("get_com_cost_handle", &MPCGait::getCoMCostHandle)
+    .def("get_constraints_handle", &MPCGait::getConstraintsHandle)
+    .def("get_friction_cone_handle", &MPCGait::getFrictionConeHandle)
+    .def("get_solver", &MPCGait::getSolver)
+    .def("get_contact_sequence", &MPCGait::getContactSequence)
+    .def("get_gait_table", &MPCGait::getGaitTable)
+    .def("set_robot_properties", &MPCGait::setRobotProperties)
+    DEFINE_ROBOTOC_PYBIND11_CLASS_CLONE(MPCGait);
+}
+
+} // namespace python
+} // namespace robotoc
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/eigen.h>
+#include <pybind11/numpy.h>
+
+#include "robotoc/mpc/state_feedback_policy.hpp"
+#include "robotoc/utils/pybind11_macros.hpp"
+
+
+namespace robotoc {
+namespace python {
+
+namespace py = pybind11;
+
+PYBIND11_MODULE(state_feedback_policy, m) {
+  py::class_<StateFeedbackPolicy>(m, "StateFeedbackPolicy")
+    .def(py::init<const Robot&>(),
+         py::arg("robot"))
+    .def(py::init<const Robot&, const OCPSolver&, const double>(),
+         py::arg("robot"), py::arg("ocp_solver"), py::arg("t"))
+    .def_readwrite("t", &StateFeedbackPolicy::t)
+    .def_readwrite("u", &StateFeedbackPolicy::u)
+    .def_readwrite("q", &StateFeedbackPolicy::q)
+    .def_readwrite("v", &StateFeedbackPolicy::v)
+    .def_readwrite("K", &StateFeedbackPolicy::K)
+    .def("set", &StateFeedbackPolicy::set,
+         py::arg("robot"), py::arg("ocp_solver"), py::arg("t"))
+    .def("compute_control_input", [](StateFeedbackPolicy& self, 
+                                     const Robot& robot,
+                                     const Eigen::VectorXd& q, 
+                                     const Eigen::VectorXd& v) {
+        Eigen::VectorXd u = Eigen::VectorXd::Zero(self.u.size());
+        self.computeControlInput(robot, q, v, u);
+        return u;
+     }, py::arg("robot"), py::arg("q"), py::arg("v"))
+    DEFINE_ROBOTOC_PYBIND11_CLASS_CLONE(StateFeedbackPolicy)
+    DEFINE_ROBOTOC_PYBIND11_CLASS_PRINT(StateFeedbackPolicy);
+}
+
+} // namespace python
+} // namespace robotoc
\ No newline at end of file
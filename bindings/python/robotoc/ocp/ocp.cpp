@@ -44,6 +44,8 @@ PYBIND11_MODULE(ocp, m) {
     .def_readwrite("T", &OCP::T)
     .def_readwrite("N", &OCP::N)
     .def_readwrite("reserved_num_discrete_events", &OCP::reserved_num_discrete_events)
+    .def_readwrite("time_steps", &OCP::time_steps)
+    .def_readwrite("move_blocking", &OCP::move_blocking)
     DEFINE_ROBOTOC_PYBIND11_CLASS_CLONE(OCP)
     DEFINE_ROBOTOC_PYBIND11_CLASS_PRINT(OCP);
 }
@@ -30,10 +30,18 @@ PYBIND11_MODULE(time_discretization, m) {
         return self.size();
      })
     .def("max_time_step", &TimeDiscretization::maxTimeStep)
+    .def("set_time_steps", &TimeDiscretization::setTimeSteps,
+          py::arg("time_steps"))
+    .def("time_steps", &TimeDiscretization::timeSteps)
+    .def_static("geometric_time_steps", &TimeDiscretization::GeometricTimeSteps,
+          py::arg("T"), py::arg("N"), py::arg("ratio"))
     .def("discretize", &TimeDiscretization::discretize,
           py::arg("contact_sequence"), py::arg("t")) 
     .def("correct_time_steps", &TimeDiscretization::correctTimeSteps,
           py::arg("contact_sequence"), py::arg("t")) 
+    .def("remesh", &TimeDiscretization::remesh,
+          py::arg("contact_sequence"), py::arg("t"), py::arg("num_grids_in_phase")) 
+    .def("num_phases", &TimeDiscretization::numPhases)
     DEFINE_ROBOTOC_PYBIND11_CLASS_CLONE(TimeDiscretization)
     DEFINE_ROBOTOC_PYBIND11_CLASS_PRINT(TimeDiscretization);
 }
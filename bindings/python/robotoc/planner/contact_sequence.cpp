@@ -56,7 +56,10 @@ PYBIND11_MODULE(contact_sequence, m) {
           py::arg("lift_index"))
     .def("event_type", &ContactSequence::eventType,
           py::arg("event_index"))
-    .def("event_times", &ContactSequence::eventTimes)
+    .def("event_times", [](const ContactSequence& self) {
+        const auto& ts = self.eventTimes();
+        return std::vector<double>(ts.begin(), ts.end());
+      })
     .def("reserve", &ContactSequence::reserve,
          py::arg("reserved_num_discrete_events"))
     .def("reserved_num_discrete_events", &ContactSequence::reservedNumDiscreteEvents)
@@ -33,6 +33,8 @@ PYBIND11_MODULE(robot_model_info, m) {
     .def_readwrite("point_contacts", &RobotModelInfo::point_contacts)
     .def_readwrite("surface_contacts", &RobotModelInfo::surface_contacts)
     .def_readwrite("contact_inv_damping", &RobotModelInfo::contact_inv_damping)
+    .def_readwrite("model_cache_dir", &RobotModelInfo::model_cache_dir)
+    .def_readwrite("locked_joints", &RobotModelInfo::locked_joints)
     .def_static("Manipulator", &RobotModelInfo::Manipulator,
                  py::arg("urdf_path"))
     .def_static("Quadruped", &RobotModelInfo::Quadruped,
@@ -12,6 +12,7 @@ PYBIND11_MODULE(interpolation_order, m) {
   py::enum_<InterpolationOrder>(m, "InterpolationOrder", py::arithmetic())
     .value("Linear",  InterpolationOrder::Linear)
     .value("Zero", InterpolationOrder::Zero)
+    .value("LQRRollout", InterpolationOrder::LQRRollout)
     .export_values();
 }
 
@@ -27,6 +27,9 @@ PYBIND11_MODULE(solver_options, m) {
     .def_readwrite("initial_sto_reg", &SolverOptions::initial_sto_reg)
     .def_readwrite("kkt_tol_mesh", &SolverOptions::kkt_tol_mesh)
     .def_readwrite("max_dt_mesh", &SolverOptions::max_dt_mesh)
+    .def_readwrite("enable_adaptive_mesh_refinement", &SolverOptions::enable_adaptive_mesh_refinement)
+    .def_readwrite("mesh_refinement_tol", &SolverOptions::mesh_refinement_tol)
+    .def_readwrite("mesh_coarsening_ratio", &SolverOptions::mesh_coarsening_ratio)
     .def_readwrite("max_dts_riccati", &SolverOptions::max_dts_riccati)
     .def_readwrite("enable_solution_interpolation", &SolverOptions::enable_solution_interpolation)
     .def_readwrite("interpolation_order", &SolverOptions::interpolation_order)
@@ -2,6 +2,7 @@
 #define ROBOTOC_CONSTRAINT_COMPONENT_DATA_HPP_
 
 #include <vector>
+#include <cassert>
 
 #include "Eigen/Core"
 
@@ -12,7 +13,11 @@ namespace robotoc {
 /// @class ConstraintComponentData
 /// @brief Data used in constraint components. Composed by slack, 
 /// dual (Lagrange multiplier), primal residual, complementary slackness between 
-/// the slack and dual, and directions of slack and dual.
+/// the slack and dual, and directions of slack and dual. These seven vectors 
+/// are views into a single storage. A standalone object owns the storage, 
+/// while the data in ConstraintsData is bound to the contiguous buffer of the 
+/// stage so that the step sizes and updates are computed for all the 
+/// components at once.
 ///
 class ConstraintComponentData {
 public:
@@ -35,66 +40,68 @@ public:
   ~ConstraintComponentData() = default;
 
   ///
-  /// @brief Default copy constructor. 
+  /// @brief Copy constructor. The copy owns its own storage. 
   ///
-  ConstraintComponentData(const ConstraintComponentData&) = default;
+  ConstraintComponentData(const ConstraintComponentData& other);
 
   ///
-  /// @brief Default copy operator. 
+  /// @brief Copy assign operator. If the dimensions are the same, the values 
+  /// are copied into the current storage, which can be the buffer of a stage.
   ///
-  ConstraintComponentData& operator=(const ConstraintComponentData&) = default;
+  ConstraintComponentData& operator=(const ConstraintComponentData& other);
 
   ///
-  /// @brief Default move constructor. 
+  /// @brief Move constructor. 
   ///
-  ConstraintComponentData(ConstraintComponentData&&) noexcept = default;
+  ConstraintComponentData(ConstraintComponentData&& other) noexcept;
 
   ///
-  /// @brief Default move assign operator. 
+  /// @brief Move assign operator. If this object is bound to the buffer of a 
+  /// stage and the dimensions are the same, the values are copied into it.
   ///
-  ConstraintComponentData& operator=(ConstraintComponentData&&) noexcept = default;
+  ConstraintComponentData& operator=(ConstraintComponentData&& other) noexcept;
 
   ///
   /// @brief Slack variable of the constraint. Size is 
   /// ConstraintComponentData::dimc(). All elements must be positive.
   ///
-  Eigen::VectorXd slack;
+  Eigen::Map<Eigen::VectorXd> slack;
 
   ///
   /// @brief Dual variable (Lagrange multiplier) of the constraint. Size is 
   /// ConstraintComponentData::dimc(). All elements must be positive.
   ///
-  Eigen::VectorXd dual;
+  Eigen::Map<Eigen::VectorXd> dual;
 
   ///
   /// @brief Primal residual of the constraint. Size is 
   /// ConstraintComponentData::dimc(). 
   ///
-  Eigen::VectorXd residual;
+  Eigen::Map<Eigen::VectorXd> residual;
 
   ///
   /// @brief Residual in the complementary slackness between slack and dual. 
   /// Size is ConstraintComponentData::dimc(). 
   ///
-  Eigen::VectorXd cmpl;
+  Eigen::Map<Eigen::VectorXd> cmpl;
 
   ///
   /// @brief Newton direction of the slack. Size is 
   /// ConstraintComponentData::dimc(). 
   ///
-  Eigen::VectorXd dslack;
+  Eigen::Map<Eigen::VectorXd> dslack;
 
   ///
   /// @brief Newton direction of the dual. Size is 
   /// ConstraintComponentData::dimc(). 
   ///
-  Eigen::VectorXd ddual;
+  Eigen::Map<Eigen::VectorXd> ddual;
 
   ///
   /// @brief Used in condensing of slack and dual. Size is 
   /// ConstraintComponentData::dimc(). 
   ///
-  Eigen::VectorXd cond;
+  Eigen::Map<Eigen::VectorXd> cond;
 
   ///
   /// @brief Value of the log berrier function of the slack variable.
@@ -103,16 +110,103 @@ public:
 
   ///
   /// @brief std vector of Eigen::VectorXd used to store residual temporaly. 
-  /// Only be allocated in ConstraintComponentBase::allocateExtraData().
+  /// Only be used for the extra data whose size changes after allocation. 
+  /// Otherwise, use allocateExtraVector() instead.
   ///
   std::vector<Eigen::VectorXd> r;
 
   ///
   /// @brief std vector of Eigen::MatrixXd used to store Jacobian temporaly. 
-  /// Only be allocated in ConstraintComponentBase::allocateExtraData().
+  /// Only be used for the extra data whose size changes after allocation. 
+  /// Otherwise, use allocateExtraMatrix() instead.
   ///
   std::vector<Eigen::MatrixXd> J;
 
+  ///
+  /// @brief Appends a zero vector to the contiguous storage of the extra data. 
+  /// All the extra vectors and matrices of this object are stored in a single 
+  /// buffer at fixed offsets, so that copying this object copies the extra 
+  /// data at once. Only be called in 
+  /// ConstraintComponentBase::allocateExtraData().
+  /// @param[in] size Size of the vector. Must be non-negative.
+  /// @return Index of the vector, which is passed to extraVector().
+  ///
+  int allocateExtraVector(const int size);
+
+  ///
+  /// @brief Appends a zero matrix to the contiguous storage of the extra data. 
+  /// Only be called in ConstraintComponentBase::allocateExtraData().
+  /// @param[in] rows Number of the rows of the matrix. Must be non-negative.
+  /// @param[in] cols Number of the columns of the matrix. Must be non-negative.
+  /// @return Index of the matrix, which is passed to extraMatrix().
+  ///
+  int allocateExtraMatrix(const int rows, const int cols);
+
+  ///
+  /// @brief Clears the contiguous storage of the extra data. 
+  ///
+  void clearExtraData();
+
+  ///
+  /// @brief Returns the extra vector allocated by allocateExtraVector(). 
+  /// @param[in] idx Index of the vector.
+  /// @return Map to the vector.
+  ///
+  Eigen::Map<Eigen::VectorXd> extraVector(const int idx) {
+    assert(idx >= 0);
+    assert(2*idx+1 < static_cast<int>(extra_vector_layout_.size()));
+    return Eigen::Map<Eigen::VectorXd>(
+        extra_data_.data()+extra_vector_layout_[2*idx], 
+        extra_vector_layout_[2*idx+1]);
+  }
+
+  ///
+  /// @brief Returns the extra vector allocated by allocateExtraVector(). 
+  /// @param[in] idx Index of the vector.
+  /// @return Const map to the vector.
+  ///
+  Eigen::Map<const Eigen::VectorXd> extraVector(const int idx) const {
+    assert(idx >= 0);
+    assert(2*idx+1 < static_cast<int>(extra_vector_layout_.size()));
+    return Eigen::Map<const Eigen::VectorXd>(
+        extra_data_.data()+extra_vector_layout_[2*idx], 
+        extra_vector_layout_[2*idx+1]);
+  }
+
+  ///
+  /// @brief Returns the extra matrix allocated by allocateExtraMatrix(). 
+  /// @param[in] idx Index of the matrix.
+  /// @return Map to the matrix.
+  ///
+  Eigen::Map<Eigen::MatrixXd> extraMatrix(const int idx) {
+    assert(idx >= 0);
+    assert(3*idx+2 < static_cast<int>(extra_matrix_layout_.size()));
+    return Eigen::Map<Eigen::MatrixXd>(
+        extra_data_.data()+extra_matrix_layout_[3*idx], 
+        extra_matrix_layout_[3*idx+1], extra_matrix_layout_[3*idx+2]);
+  }
+
+  ///
+  /// @brief Returns the extra matrix allocated by allocateExtraMatrix(). 
+  /// @param[in] idx Index of the matrix.
+  /// @return Const map to the matrix.
+  ///
+  Eigen::Map<const Eigen::MatrixXd> extraMatrix(const int idx) const {
+    assert(idx >= 0);
+    assert(3*idx+2 < static_cast<int>(extra_matrix_layout_.size()));
+    return Eigen::Map<const Eigen::MatrixXd>(
+        extra_data_.data()+extra_matrix_layout_[3*idx], 
+        extra_matrix_layout_[3*idx+1], extra_matrix_layout_[3*idx+2]);
+  }
+
+  ///
+  /// @brief Returns the total size of the contiguous storage of the extra data. 
+  /// @return Total size of the extra data.
+  ///
+  int extraDataSize() const {
+    return extra_data_.size();
+  }
+
   ///
   /// @brief Returns the squared norm of the KKT reisdual, that is, the sum of
   /// the squared norm of the primal residual and complementary slackness of 
@@ -148,11 +242,42 @@ public:
   }
 
   ///
-  /// @brief Resizes the constraint. 
+  /// @brief Resizes the constraint. The slack and dual are kept up to the new 
+  /// size. If this object is bound to the buffer of a stage, it is unbound 
+  /// and owns its own storage.
   /// @param[in] dimc The new size. 
   ///
   void resize(const int dimc);
 
+  ///
+  /// @brief Moves slack, dual, residual, cmpl, dslack, ddual, and cond into 
+  /// an external contiguous buffer and releases the own storage. The i-th of 
+  /// these vectors is placed at buffer+i*stride. Only be called in 
+  /// ConstraintsData.
+  /// @param[in] buffer Pointer to the external buffer. The buffer must 
+  /// outlive the binding.
+  /// @param[in] stride Stride between the vectors in the buffer. Must not be 
+  /// less than ConstraintComponentData::dimc().
+  ///
+  void bindToBuffer(double* buffer, const int stride);
+
+  ///
+  /// @brief Checks whether this object is bound to an external buffer by 
+  /// bindToBuffer().
+  /// @return true if this object is bound to an external buffer. false if it 
+  /// owns its own storage.
+  ///
+  bool isBoundToBuffer() const {
+    return (dimc_ > 0 && storage_.size() == 0);
+  }
+
+  ///
+  /// @brief Returns the number of the vectors stored in the buffer, i.e., 
+  /// slack, dual, residual, cmpl, dslack, ddual, and cond.
+  /// @return The number of the vectors stored in the buffer.
+  ///
+  static constexpr int numBufferVectors() { return 7; }
+
   ///
   /// @brief Dimension of the constraint. 
   /// @return Dimension of the constraint. 
@@ -176,7 +301,18 @@ public:
   bool isApprox(const ConstraintComponentData& other) const;
 
 private:
-  int dimc_;
+  int dimc_, stride_;
+  Eigen::VectorXd storage_;
+  Eigen::VectorXd extra_data_;
+  // (offset, size) of each extra vector and (offset, rows, cols) of each 
+  // extra matrix in extra_data_.
+  std::vector<int> extra_vector_layout_, extra_matrix_layout_;
+
+  void bindVectors(double* buffer, const int stride);
+
+  void copyVectors(const ConstraintComponentData& other);
+
+  void copyExtraData(const ConstraintComponentData& other);
 
 };
 
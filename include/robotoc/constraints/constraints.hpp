@@ -277,6 +277,8 @@ public:
   ///
   /// @brief Computes and returns the maximum step size by applying 
   /// fraction-to-boundary-rule to the directions of the slack variables.
+  /// If ConstraintsData::isBoundToBuffer() is true, this is a single 
+  /// reduction over the contiguous buffer of the stage.
   /// @param[in] data Constraints data.
   /// @return Maximum step size regarding the slack variables.
   ///
@@ -285,6 +287,8 @@ public:
   ///
   /// @brief Computes and returns the maximum step size by applying 
   /// fraction-to-boundary-rule to the directions of the dual variables.
+  /// If ConstraintsData::isBoundToBuffer() is true, this is a single 
+  /// reduction over the contiguous buffer of the stage.
   /// @param[in] data Constraints data.
   /// @return Maximum step size regarding the dual variables.
   ///
@@ -318,6 +322,16 @@ public:
   ///
   void setFractionToBoundaryRule(const double fraction_to_boundary_rule);
 
+  ///
+  /// @brief Sets the ratio of the constraint screening for all the constraint 
+  /// components. If positive, the Hessians of the blocks of the constraints 
+  /// far from active are not condensed. See 
+  /// ConstraintComponentBase::setScreeningRatio() for details.
+  /// @param[in] screening_ratio Ratio of the constraint screening. Must be 
+  /// non-negative. 0 disables the screening. 
+  ///
+  void setScreeningRatio(const double screening_ratio);
+
   ///
   /// @brief Gets the barrier parameter.
   /// @return Barrier parameter. 
@@ -330,6 +344,12 @@ public:
   ///
   double getFractionToBoundaryRule() const;
 
+  ///
+  /// @brief Gets the ratio of the constraint screening. 
+  /// @return The ratio of the constraint screening. 
+  ///
+  double getScreeningRatio() const;
+
   ///
   /// @brief Gets a list of the position-level constraints. 
   /// @return Name list of the position-level constraints.
@@ -379,7 +399,7 @@ private:
                                           velocity_level_constraint_names_, 
                                           acceleration_level_constraint_names_,
                                           impact_level_constraint_names_;
-  double barrier_, fraction_to_boundary_rule_;
+  double barrier_, fraction_to_boundary_rule_, screening_ratio_;
 };
 
 } // namespace robotoc
@@ -3,6 +3,8 @@
 
 #include <vector>
 
+#include "Eigen/Core"
+
 #include "robotoc/constraints/constraint_component_data.hpp"
 
 
@@ -11,7 +13,11 @@ namespace robotoc {
 ///
 /// @class ConstraintsData
 /// @brief Data for constraints. Composed of ConstraintComponentData 
-/// corrensponding to the components of Constraints.
+/// corrensponding to the components of Constraints. The slack, dual, residual, 
+/// cmpl, dslack, ddual, and cond of all the components can be bound to a 
+/// contiguous buffer of this stage by bindComponentsToBuffer(), so that the 
+/// fraction-to-boundary rule and the updates of the slack and dual are 
+/// computed in a single vectorized pass over the stage.
 ///
 class ConstraintsData {
 public:
@@ -33,14 +39,17 @@ public:
   ~ConstraintsData() = default;
 
   ///
-  /// @brief Default copy constructor. 
+  /// @brief Copy constructor. If other is bound to its buffer, the copy is 
+  /// bound to its own buffer.
   ///
-  ConstraintsData(const ConstraintsData&) = default;
+  ConstraintsData(const ConstraintsData& other);
 
   ///
-  /// @brief Default copy operator. 
+  /// @brief Copy assign operator. If the components have the same dimensions
+  /// and this object is bound to the buffer, the values are copied into the 
+  /// buffer without reallocation.
   ///
-  ConstraintsData& operator=(const ConstraintsData&) = default;
+  ConstraintsData& operator=(const ConstraintsData& other);
 
   ///
   /// @brief Default move constructor. 
@@ -126,6 +135,92 @@ public:
   template <int p=1>
   double dualFeasibility() const;
 
+  ///
+  /// @brief Moves the slack, dual, residual, cmpl, dslack, ddual, and cond of 
+  /// all the components into a contiguous buffer of this stage. Each vector of 
+  /// the components is a view of the buffer afterwards. Must be called again 
+  /// after the collections of the components data are modified.
+  ///
+  void bindComponentsToBuffer();
+
+  ///
+  /// @brief Checks whether the components data is bound to the contiguous 
+  /// buffer of this stage by bindComponentsToBuffer(). 
+  /// @return true if the components data is bound to the buffer. false 
+  /// otherwise. 
+  ///
+  bool isBoundToBuffer() const {
+    return is_bound_to_buffer_;
+  }
+
+  ///
+  /// @brief Returns the slack variables of all the valid constraints. 
+  /// isBoundToBuffer() must be true.
+  /// @return Contiguous segment of the buffer.
+  ///
+  Eigen::VectorBlock<Eigen::VectorXd> slack() { return validSegment(0); }
+
+  ///
+  /// @brief Returns the slack variables of all the valid constraints. 
+  /// isBoundToBuffer() must be true.
+  /// @return Contiguous segment of the buffer.
+  ///
+  const Eigen::VectorBlock<const Eigen::VectorXd> slack() const { 
+    return validSegment(0); 
+  }
+
+  ///
+  /// @brief Returns the dual variables of all the valid constraints. 
+  /// isBoundToBuffer() must be true.
+  /// @return Contiguous segment of the buffer.
+  ///
+  Eigen::VectorBlock<Eigen::VectorXd> dual() { return validSegment(1); }
+
+  ///
+  /// @brief Returns the dual variables of all the valid constraints. 
+  /// isBoundToBuffer() must be true.
+  /// @return Contiguous segment of the buffer.
+  ///
+  const Eigen::VectorBlock<const Eigen::VectorXd> dual() const { 
+    return validSegment(1); 
+  }
+
+  ///
+  /// @brief Returns the primal residuals of all the valid constraints. 
+  /// isBoundToBuffer() must be true.
+  /// @return Contiguous segment of the buffer.
+  ///
+  const Eigen::VectorBlock<const Eigen::VectorXd> residual() const { 
+    return validSegment(2); 
+  }
+
+  ///
+  /// @brief Returns the complementary slackness of all the valid constraints. 
+  /// isBoundToBuffer() must be true.
+  /// @return Contiguous segment of the buffer.
+  ///
+  const Eigen::VectorBlock<const Eigen::VectorXd> cmpl() const { 
+    return validSegment(3); 
+  }
+
+  ///
+  /// @brief Returns the directions of the slack variables of all the valid 
+  /// constraints. isBoundToBuffer() must be true.
+  /// @return Contiguous segment of the buffer.
+  ///
+  const Eigen::VectorBlock<const Eigen::VectorXd> dslack() const { 
+    return validSegment(4); 
+  }
+
+  ///
+  /// @brief Returns the directions of the dual variables of all the valid 
+  /// constraints. isBoundToBuffer() must be true.
+  /// @return Contiguous segment of the buffer.
+  ///
+  const Eigen::VectorBlock<const Eigen::VectorXd> ddual() const { 
+    return validSegment(5); 
+  }
+
   ///
   /// @brief The collection of the position-level constraints data. 
   ///
@@ -148,7 +243,21 @@ public:
 
 private:
   bool is_position_level_valid_, is_velocity_level_valid_, 
-       is_acceleration_level_valid_, is_impact_level_valid_;
+       is_acceleration_level_valid_, is_impact_level_valid_, 
+       is_bound_to_buffer_;
+  Eigen::VectorXd buffer_;
+  int dimc_position_level_, dimc_velocity_level_, dimc_acceleration_level_, 
+      dimc_impact_level_, dimc_;
+
+  bool hasSameDimensions(const ConstraintsData& other) const;
+
+  Eigen::VectorBlock<Eigen::VectorXd> validSegment(const int i);
+
+  const Eigen::VectorBlock<const Eigen::VectorXd> validSegment(const int i) const;
+
+  int validSegmentStart() const;
+
+  int validSegmentSize() const;
 
 };
   
@@ -3,10 +3,15 @@
 
 #include "robotoc/constraints/constraints_data.hpp"
 
+#include <cassert>
+
 
 namespace robotoc {
 
 inline double ConstraintsData::KKTError() const {
+  if (isBoundToBuffer()) {
+    return (residual().squaredNorm() + cmpl().squaredNorm());
+  }
   double err = 0.0;
   if (isPositionLevelValid()) {
     for (const auto& data : position_level_data) {
@@ -111,6 +116,56 @@ inline double ConstraintsData::dualFeasibility() const {
   return feasibility;
 }
 
+
+inline Eigen::VectorBlock<Eigen::VectorXd> 
+ConstraintsData::validSegment(const int i) {
+  assert(isBoundToBuffer());
+  return buffer_.segment(i*dimc_+validSegmentStart(), validSegmentSize());
+}
+
+
+inline const Eigen::VectorBlock<const Eigen::VectorXd> 
+ConstraintsData::validSegment(const int i) const {
+  assert(isBoundToBuffer());
+  return buffer_.segment(i*dimc_+validSegmentStart(), validSegmentSize());
+}
+
+
+inline int ConstraintsData::validSegmentStart() const {
+  // The levels are stored in the order of position, velocity, acceleration, 
+  // and impact, and the valid levels of a stage are consecutive.
+  if (isPositionLevelValid()) {
+    return 0;
+  }
+  else if (isVelocityLevelValid()) {
+    return dimc_position_level_;
+  }
+  else if (isAccelerationLevelValid()) {
+    return (dimc_position_level_+dimc_velocity_level_);
+  }
+  else {
+    return (dimc_position_level_+dimc_velocity_level_+dimc_acceleration_level_);
+  }
+}
+
+
+inline int ConstraintsData::validSegmentSize() const {
+  int size = 0;
+  if (isPositionLevelValid()) {
+    size += dimc_position_level_;
+  }
+  if (isVelocityLevelValid()) {
+    size += dimc_velocity_level_;
+  }
+  if (isAccelerationLevelValid()) {
+    size += dimc_acceleration_level_;
+  }
+  if (isImpactLevelValid()) {
+    size += dimc_impact_level_;
+  }
+  return size;
+}
+
 } // namespace robotoc
 
 #endif // ROBOTOC_CONSTRAINTS_DATA_XXH
\ No newline at end of file
@@ -183,6 +183,17 @@ void setFractionToBoundaryRule(
     std::vector<ConstraintComponentBaseTypePtr>& constraints,
     const double fraction_to_boundary_rule);
 
+///
+/// @brief Sets the ratio of the constraint screening.
+/// @param[in, out] constraints Vector of the constraint components. 
+/// @param[in] screening_ratio Ratio of the constraint screening. Must be 
+/// non-negative. 
+///
+template <typename ConstraintComponentBaseTypePtr>
+void setScreeningRatio(
+    std::vector<ConstraintComponentBaseTypePtr>& constraints,
+    const double screening_ratio);
+
 } // namespace constraintsimpl
 } // namespace robotoc
 
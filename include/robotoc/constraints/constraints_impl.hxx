@@ -200,6 +200,16 @@ inline void setFractionToBoundaryRule(
   }
 }
 
+
+template <typename ConstraintComponentBaseTypePtr>
+inline void setScreeningRatio(
+    std::vector<ConstraintComponentBaseTypePtr>& constraints,
+    const double screening_ratio) {
+  for (auto& constraint : constraints) {
+    constraint->setScreeningRatio(screening_ratio);
+  }
+}
+
 } // namespace constraintsimpl
 } // namespace robotoc
 
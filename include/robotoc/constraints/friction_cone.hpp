@@ -126,44 +126,44 @@ private:
   std::vector<int> contact_frame_;
   std::vector<ContactType> contact_types_;
 
-  static Eigen::VectorXd& fW(ConstraintComponentData& data, 
-                             const int contact_idx) {
-    return data.r[contact_idx];
+  static Eigen::Map<Eigen::VectorXd> fW(ConstraintComponentData& data, 
+                                        const int contact_idx) {
+    return data.extraVector(contact_idx);
   }
 
-  Eigen::VectorXd& r(ConstraintComponentData& data, 
-                     const int contact_idx) const {
-    return data.r[max_num_contacts_+contact_idx];
+  Eigen::Map<Eigen::VectorXd> r(ConstraintComponentData& data, 
+                                const int contact_idx) const {
+    return data.extraVector(max_num_contacts_+contact_idx);
   }
 
-  static Eigen::MatrixXd& dg_dq(ConstraintComponentData& data, 
-                                const int contact_idx) {
-    return data.J[contact_idx];
+  static Eigen::Map<Eigen::MatrixXd> dg_dq(ConstraintComponentData& data, 
+                                           const int contact_idx) {
+    return data.extraMatrix(contact_idx);
   }
 
-  Eigen::MatrixXd& dg_df(ConstraintComponentData& data, 
-                         const int contact_idx) const {
-    return data.J[max_num_contacts_+contact_idx];
+  Eigen::Map<Eigen::MatrixXd> dg_df(ConstraintComponentData& data, 
+                                    const int contact_idx) const {
+    return data.extraMatrix(max_num_contacts_+contact_idx);
   }
 
-  Eigen::MatrixXd& dfW_dq(ConstraintComponentData& data, 
-                          const int contact_idx) const {
-    return data.J[2*max_num_contacts_+contact_idx];
+  Eigen::Map<Eigen::MatrixXd> dfW_dq(ConstraintComponentData& data, 
+                                     const int contact_idx) const {
+    return data.extraMatrix(2*max_num_contacts_+contact_idx);
   }
 
-  Eigen::MatrixXd& r_dg_df(ConstraintComponentData& data, 
-                           const int contact_idx) const {
-    return data.J[3*max_num_contacts_+contact_idx];
+  Eigen::Map<Eigen::MatrixXd> r_dg_df(ConstraintComponentData& data, 
+                                      const int contact_idx) const {
+    return data.extraMatrix(3*max_num_contacts_+contact_idx);
   }
 
-  Eigen::MatrixXd& cone_local(ConstraintComponentData& data, 
-                              const int contact_idx) const {
-    return data.J[4*max_num_contacts_+contact_idx];
+  Eigen::Map<Eigen::MatrixXd> cone_local(ConstraintComponentData& data, 
+                                         const int contact_idx) const {
+    return data.extraMatrix(4*max_num_contacts_+contact_idx);
   }
 
-  Eigen::MatrixXd& cone_world(ConstraintComponentData& data, 
-                              const int contact_idx) const {
-    return data.J[5*max_num_contacts_+contact_idx];
+  Eigen::Map<Eigen::MatrixXd> cone_world(ConstraintComponentData& data, 
+                                         const int contact_idx) const {
+    return data.extraMatrix(5*max_num_contacts_+contact_idx);
   }
 
 };
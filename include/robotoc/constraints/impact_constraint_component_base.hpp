@@ -219,6 +219,25 @@ public:
   virtual void setFractionToBoundaryRule(
       const double fraction_to_boundary_rule) final;
 
+  ///
+  /// @brief Gets the ratio of the constraint screening.
+  /// @return The ratio of the constraint screening.
+  ///
+  virtual double getScreeningRatio() const final;
+
+  ///
+  /// @brief Sets the ratio of the constraint screening. If positive, the  
+  /// blocks of the constraint far from active, i.e., whose slacks are all 
+  /// larger than screening_ratio * sqrt(barrier_param) and whose duals are 
+  /// all smaller than sqrt(barrier_param) / screening_ratio, skip the 
+  /// condensing of their Hessians, whose weights dual/slack are then smaller 
+  /// than 1/screening_ratio^2. The gradients are always exact, so the 
+  /// solution is unchanged. 0 disables the screening. Default is 0.
+  /// @param[in] screening_ratio Ratio of the constraint screening. Must be 
+  /// non-negative. Should be larger than 10 if positive.
+  ///
+  virtual void setScreeningRatio(const double screening_ratio) final;
+
   ///
   /// @brief Gets the shared ptr of this object as the specified type. If this 
   /// fails in dynamic casting, throws an exception.
@@ -355,8 +374,21 @@ protected:
   template <typename VectorType>
   double logBarrier(const Eigen::MatrixBase<VectorType>& slack) const;
 
+  ///
+  /// @brief Checks whether a block of the constraint is far from active 
+  /// according to the constraint screening. See setScreeningRatio().
+  /// @param[in] data Constraint data.
+  /// @param[in] start Start position of the block.
+  /// @tparam Size Size of the block.
+  /// @return true if the screening is enabled and the block is far from 
+  /// active. false otherwise.
+  ///
+  template <int Size>
+  bool isFarFromActive(const ConstraintComponentData& data, 
+                       const int start) const;
+
 private:
-  double barrier_, fraction_to_boundary_rule_;
+  double barrier_, fraction_to_boundary_rule_, screening_ratio_;
 
 };
 
@@ -5,6 +5,7 @@
 #include "robotoc/constraints/pdipm.hpp"
 
 #include <cassert>
+#include <cmath>
 
 
 namespace robotoc {
@@ -129,6 +130,18 @@ inline double ImpactConstraintComponentBase::logBarrier(
   return pdipm::logBarrier(barrier_, slack);
 }
 
+
+template <int Size>
+inline bool ImpactConstraintComponentBase::isFarFromActive(
+    const ConstraintComponentData& data, const int start) const {
+  if (screening_ratio_ <= 0) return false;
+  const double sqrt_barrier = std::sqrt(barrier_);
+  return ((data.slack.template segment<Size>(start).minCoeff() 
+              > screening_ratio_ * sqrt_barrier)
+          && (screening_ratio_ * data.dual.template segment<Size>(start).maxCoeff()
+              < sqrt_barrier));
+}
+
 } // namespace robotoc
 
 #endif // ROBOTOC_IMPACT_CONSTRAINT_COMPONENT_BASE_HXX_ 
\ No newline at end of file
@@ -106,7 +106,7 @@ private:
   double X_, Y_;
 
   void computeCone(const double mu, Eigen::MatrixXd& cone) const;
-  void updateCone(const double mu, Eigen::MatrixXd& cone) const;
+  void updateCone(const double mu, Eigen::Map<Eigen::MatrixXd>& cone) const;
 
 };
 
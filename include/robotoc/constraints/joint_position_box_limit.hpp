@@ -0,0 +1,103 @@
+#ifndef ROBOTOC_JOINT_POSITION_BOX_LIMIT_HPP_
+#define ROBOTOC_JOINT_POSITION_BOX_LIMIT_HPP_
+
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/robot/contact_status.hpp"
+#include "robotoc/core/split_solution.hpp"
+#include "robotoc/core/split_direction.hpp"
+#include "robotoc/core/split_kkt_residual.hpp"
+#include "robotoc/core/split_kkt_matrix.hpp"
+#include "robotoc/constraints/constraint_component_base.hpp"
+#include "robotoc/constraints/constraint_component_data.hpp"
+
+
+namespace robotoc {
+
+///
+/// @class JointPositionBoxLimit
+/// @brief Constraint on both the lower and upper limits of the joint positions. 
+/// Equivalent to JointPositionLowerLimit and JointPositionUpperLimit, but the two bounds 
+/// share a single constraint data, i.e., the slack and dual variables of the 
+/// lower limits followed by those of the upper limits, and are condensed into 
+/// the diagonal of the KKT matrix by one vectorized pass.
+///
+class JointPositionBoxLimit final : public ConstraintComponentBase {
+public:
+  ///
+  /// @brief Constructor. 
+  /// @param[in] robot Robot model.
+  ///
+  JointPositionBoxLimit(const Robot& robot);
+
+  ///
+  /// @brief Default constructor. 
+  ///
+  JointPositionBoxLimit();
+
+  ///
+  /// @brief Destructor. 
+  ///
+  ~JointPositionBoxLimit();
+
+  ///
+  /// @brief Default copy constructor. 
+  ///
+  JointPositionBoxLimit(const JointPositionBoxLimit&) = default;
+
+  ///
+  /// @brief Default copy operator. 
+  ///
+  JointPositionBoxLimit& operator=(const JointPositionBoxLimit&) = default;
+
+  ///
+  /// @brief Default move constructor. 
+  ///
+  JointPositionBoxLimit(JointPositionBoxLimit&&) noexcept = default;
+
+  ///
+  /// @brief Default move assign operator. 
+  ///
+  JointPositionBoxLimit& operator=(JointPositionBoxLimit&&) noexcept = default;
+
+  KinematicsLevel kinematicsLevel() const override;
+
+  void allocateExtraData(ConstraintComponentData& data) const override {}
+
+  bool isFeasible(Robot& robot, const ContactStatus& contact_status, 
+                  ConstraintComponentData& data, 
+                  const SplitSolution& s) const override;
+
+  void setSlack(Robot& robot, const ContactStatus& contact_status, 
+                ConstraintComponentData& data, 
+                const SplitSolution& s) const override;
+
+  void evalConstraint(Robot& robot, const ContactStatus& contact_status, 
+                      ConstraintComponentData& data, 
+                      const SplitSolution& s) const override;
+
+  void evalDerivatives(Robot& robot, const ContactStatus& contact_status, 
+                       ConstraintComponentData& data, const SplitSolution& s,
+                       SplitKKTResidual& kkt_residual) const override;
+
+  void condenseSlackAndDual(const ContactStatus& contact_status, 
+                            ConstraintComponentData& data, 
+                            SplitKKTMatrix& kkt_matrix,
+                            SplitKKTResidual& kkt_residual) const override;
+
+  void expandSlackAndDual(const ContactStatus& contact_status, 
+                          ConstraintComponentData& data, 
+                          const SplitDirection& d) const override; 
+
+  int dimc() const override;
+
+private:
+  int dimc_, dim_;
+  Eigen::VectorXd qmin_, qmax_;
+
+};
+
+} // namespace robotoc
+
+#endif // ROBOTOC_JOINT_POSITION_BOX_LIMIT_HPP_
\ No newline at end of file
@@ -0,0 +1,103 @@
+#ifndef ROBOTOC_JOINT_VELOCITY_BOX_LIMIT_HPP_
+#define ROBOTOC_JOINT_VELOCITY_BOX_LIMIT_HPP_
+
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/robot/contact_status.hpp"
+#include "robotoc/core/split_solution.hpp"
+#include "robotoc/core/split_direction.hpp"
+#include "robotoc/core/split_kkt_residual.hpp"
+#include "robotoc/core/split_kkt_matrix.hpp"
+#include "robotoc/constraints/constraint_component_base.hpp"
+#include "robotoc/constraints/constraint_component_data.hpp"
+
+
+namespace robotoc {
+
+///
+/// @class JointVelocityBoxLimit
+/// @brief Constraint on both the lower and upper limits of the joint velocities. 
+/// Equivalent to JointVelocityLowerLimit and JointVelocityUpperLimit, but the two bounds 
+/// share a single constraint data, i.e., the slack and dual variables of the 
+/// lower limits followed by those of the upper limits, and are condensed into 
+/// the diagonal of the KKT matrix by one vectorized pass.
+///
+class JointVelocityBoxLimit final : public ConstraintComponentBase {
+public:
+  ///
+  /// @brief Constructor. 
+  /// @param[in] robot Robot model.
+  ///
+  JointVelocityBoxLimit(const Robot& robot);
+
+  ///
+  /// @brief Default constructor. 
+  ///
+  JointVelocityBoxLimit();
+
+  ///
+  /// @brief Destructor. 
+  ///
+  ~JointVelocityBoxLimit();
+
+  ///
+  /// @brief Default copy constructor. 
+  ///
+  JointVelocityBoxLimit(const JointVelocityBoxLimit&) = default;
+
+  ///
+  /// @brief Default copy operator. 
+  ///
+  JointVelocityBoxLimit& operator=(const JointVelocityBoxLimit&) = default;
+
+  ///
+  /// @brief Default move constructor. 
+  ///
+  JointVelocityBoxLimit(JointVelocityBoxLimit&&) noexcept = default;
+
+  ///
+  /// @brief Default move assign operator. 
+  ///
+  JointVelocityBoxLimit& operator=(JointVelocityBoxLimit&&) noexcept = default;
+
+  KinematicsLevel kinematicsLevel() const override;
+
+  void allocateExtraData(ConstraintComponentData& data) const override {}
+
+  bool isFeasible(Robot& robot, const ContactStatus& contact_status, 
+                  ConstraintComponentData& data, 
+                  const SplitSolution& s) const override;
+
+  void setSlack(Robot& robot, const ContactStatus& contact_status, 
+                ConstraintComponentData& data, 
+                const SplitSolution& s) const override;
+
+  void evalConstraint(Robot& robot, const ContactStatus& contact_status, 
+                      ConstraintComponentData& data, 
+                      const SplitSolution& s) const override;
+
+  void evalDerivatives(Robot& robot, const ContactStatus& contact_status, 
+                       ConstraintComponentData& data, const SplitSolution& s,
+                       SplitKKTResidual& kkt_residual) const override;
+
+  void condenseSlackAndDual(const ContactStatus& contact_status, 
+                            ConstraintComponentData& data, 
+                            SplitKKTMatrix& kkt_matrix,
+                            SplitKKTResidual& kkt_residual) const override;
+
+  void expandSlackAndDual(const ContactStatus& contact_status, 
+                          ConstraintComponentData& data, 
+                          const SplitDirection& d) const override; 
+
+  int dimc() const override;
+
+private:
+  int dimc_, dim_;
+  Eigen::VectorXd vmin_, vmax_;
+
+};
+
+} // namespace robotoc
+
+#endif // ROBOTOC_JOINT_VELOCITY_BOX_LIMIT_HPP_
\ No newline at end of file
@@ -134,6 +134,22 @@ double fractionToBoundary(const int dim, const double fraction_rate,
                           const Eigen::VectorXd& vec,
                           const Eigen::VectorXd& dvec);
 
+///
+/// @brief Applies the fraction-to-boundary-rule. The minimum is computed by a 
+/// branch-free vectorized reduction, so that this can be applied to the 
+/// contiguous slack and dual variables of all the constraints of a stage at 
+/// once.
+/// @param[in] fraction_rate Must be larger than 0 and smaller than 1. Should be 
+/// between 0.9 and 0.995.
+/// @param[in] vec A vector. Can be a segment of a larger vector.
+/// @param[in] dvec A direction vector of vec. Size must be the same as vec.
+/// @return Fraction-to-boundary of dvec. 1 if vec is empty.
+///
+template <typename VectorType1, typename VectorType2>
+double fractionToBoundary(const double fraction_rate, 
+                          const Eigen::MatrixBase<VectorType1>& vec,
+                          const Eigen::MatrixBase<VectorType2>& dvec);
+
 ///
 /// @brief Applies the fraction-to-boundary-rule.
 /// @param[in] fraction_rate Must be larger than 0 and smaller than 1. Should be 
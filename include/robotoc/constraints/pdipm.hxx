@@ -15,11 +15,7 @@ inline void setSlackAndDualPositive(const double barrier_param,
   assert(barrier_param > 0);
   assert(data.checkDimensionalConsistency());
   const double sqrt_barrier = std::sqrt(barrier_param);
-  for (int i=0; i<data.slack.size(); ++i) {
-    if (data.slack.coeff(i) < sqrt_barrier) {
-      data.slack.coeffRef(i) = sqrt_barrier;
-    }
-  }
+  data.slack = data.slack.cwiseMax(sqrt_barrier);
   data.dual.array() = barrier_param / data.slack.array();
 }
 
@@ -105,7 +101,7 @@ inline double fractionToBoundarySlack(const double fraction_rate,
   assert(fraction_rate > 0);
   assert(fraction_rate <= 1);
   assert(data.checkDimensionalConsistency());
-  return fractionToBoundary(data.dimc(), fraction_rate, data.slack, data.dslack);
+  return fractionToBoundary(fraction_rate, data.slack, data.dslack);
 }
 
 
@@ -114,7 +110,7 @@ inline double fractionToBoundaryDual(const double fraction_rate,
   assert(fraction_rate > 0);
   assert(fraction_rate <= 1);
   assert(data.checkDimensionalConsistency());
-  return fractionToBoundary(data.dimc(), fraction_rate, data.dual, data.ddual);
+  return fractionToBoundary(fraction_rate, data.dual, data.ddual);
 }
 
 
@@ -122,20 +118,29 @@ inline double fractionToBoundary(const int dim, const double fraction_rate,
                                  const Eigen::VectorXd& vec, 
                                  const Eigen::VectorXd& dvec) {
   assert(dim > 0);
-  assert(fraction_rate > 0);
-  assert(fraction_rate <= 1);
   assert(vec.size() == dim);
   assert(dvec.size() == dim);
-  double min_fraction_to_boundary = 1;
-  for (int i=0; i<dim; ++i) {
-    const double fraction_to_boundary 
-        = - fraction_rate * (vec.coeff(i)/dvec.coeff(i));
-    if (fraction_to_boundary > 0 && fraction_to_boundary < 1) {
-      if (fraction_to_boundary < min_fraction_to_boundary) {
-        min_fraction_to_boundary = fraction_to_boundary;
-      }
-    }
+  return fractionToBoundary(fraction_rate, vec, dvec);
+}
+
+
+template <typename VectorType1, typename VectorType2>
+inline double fractionToBoundary(const double fraction_rate, 
+                                 const Eigen::MatrixBase<VectorType1>& vec, 
+                                 const Eigen::MatrixBase<VectorType2>& dvec) {
+  assert(fraction_rate > 0);
+  assert(fraction_rate <= 1);
+  assert(vec.size() == dvec.size());
+  if (vec.size() == 0) {
+    return 1.0;
   }
+  // Only the elements in (0, 1) restrict the step size. The others, including 
+  // NaN from zero directions, are replaced with 1.
+  const auto fraction_to_boundary 
+      = - fraction_rate * (vec.array() / dvec.array());
+  const double min_fraction_to_boundary 
+      = ((fraction_to_boundary > 0) && (fraction_to_boundary < 1)).select(
+            fraction_to_boundary, 1.0).minCoeff();
   assert(min_fraction_to_boundary > 0);
   assert(min_fraction_to_boundary <= 1);
   return min_fraction_to_boundary;
@@ -0,0 +1,69 @@
+#ifndef ROBOTOC_CACHED_COM_REF_HPP_
+#define ROBOTOC_CACHED_COM_REF_HPP_
+
+#include <memory>
+
+#include "Eigen/Core"
+
+#include "robotoc/ocp/grid_info.hpp"
+#include "robotoc/ocp/time_discretization.hpp"
+#include "robotoc/cost/com_ref_base.hpp"
+#include "robotoc/cost/grid_ref_cache.hpp"
+
+
+namespace robotoc {
+
+///
+/// @class CachedCoMRef
+/// @brief Wraps a CoMRefBase and caches the reference CoM position and 
+/// its activity for each grid. The cache is filled by updateCache() once per 
+/// time discretization, e.g., after OCPSolver::discretize(), and is 
+/// invalidated by clearCache(). Grids that are not cached are passed through 
+/// to the wrapped reference. 
+///
+class CachedCoMRef : public CoMRefBase {
+public:
+  ///
+  /// @brief Constructor. 
+  /// @param[in] ref Reference to be cached.
+  ///
+  CachedCoMRef(const std::shared_ptr<CoMRefBase>& ref);
+
+  ///
+  /// @brief Destructor. 
+  ///
+  ~CachedCoMRef();
+
+  ///
+  /// @brief Evaluates the wrapped reference on all the grids of the time 
+  /// discretization and stores the results.
+  /// @param[in] time_discretization Time discretization.
+  ///
+  void updateCache(const TimeDiscretization& time_discretization);
+
+  ///
+  /// @brief Invalidates the cache. Call this when the wrapped reference is 
+  /// modified.
+  ///
+  void clearCache();
+
+  ///
+  /// @brief Gets the wrapped reference.
+  /// @return Shared ptr to the wrapped reference.
+  ///
+  const std::shared_ptr<CoMRefBase>& getRef() const;
+
+  void updateRef(const GridInfo& grid_info, 
+                 Eigen::VectorXd& com_ref) const override;
+
+  bool isActive(const GridInfo& grid_info) const override;
+
+private:
+  std::shared_ptr<CoMRefBase> ref_;
+  GridRefCache cache_;
+
+};
+
+} // namespace robotoc
+
+#endif // ROBOTOC_CACHED_COM_REF_HPP_
\ No newline at end of file
@@ -0,0 +1,75 @@
+#ifndef ROBOTOC_CACHED_CONFIGURATION_SPACE_REF_HPP_
+#define ROBOTOC_CACHED_CONFIGURATION_SPACE_REF_HPP_
+
+#include <memory>
+
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/ocp/grid_info.hpp"
+#include "robotoc/ocp/time_discretization.hpp"
+#include "robotoc/cost/configuration_space_ref_base.hpp"
+#include "robotoc/cost/grid_ref_cache.hpp"
+
+
+namespace robotoc {
+
+///
+/// @class CachedConfigurationSpaceRef
+/// @brief Wraps a ConfigurationSpaceRefBase and caches the reference 
+/// configuration and its activity for each grid. The cache is filled by 
+/// updateCache() once per time discretization, e.g., after 
+/// OCPSolver::discretize(), and is invalidated by clearCache(). Grids that are 
+/// not cached are passed through to the wrapped reference. 
+///
+class CachedConfigurationSpaceRef : public ConfigurationSpaceRefBase {
+public:
+  ///
+  /// @brief Constructor. 
+  /// @param[in] ref Reference to be cached.
+  /// @param[in] robot Robot model.
+  ///
+  CachedConfigurationSpaceRef(
+      const std::shared_ptr<ConfigurationSpaceRefBase>& ref, 
+      const Robot& robot);
+
+  ///
+  /// @brief Destructor. 
+  ///
+  ~CachedConfigurationSpaceRef();
+
+  ///
+  /// @brief Evaluates the wrapped reference on all the grids of the time 
+  /// discretization and stores the results.
+  /// @param[in] robot Robot model.
+  /// @param[in] time_discretization Time discretization.
+  ///
+  void updateCache(const Robot& robot, 
+                   const TimeDiscretization& time_discretization);
+
+  ///
+  /// @brief Invalidates the cache. Call this when the wrapped reference is 
+  /// modified.
+  ///
+  void clearCache();
+
+  ///
+  /// @brief Gets the wrapped reference.
+  /// @return Shared ptr to the wrapped reference.
+  ///
+  const std::shared_ptr<ConfigurationSpaceRefBase>& getRef() const;
+
+  void updateRef(const Robot& robot, const GridInfo& grid_info, 
+                 Eigen::VectorXd& q_ref) const override;
+
+  bool isActive(const GridInfo& grid_info) const override;
+
+private:
+  std::shared_ptr<ConfigurationSpaceRefBase> ref_;
+  GridRefCache cache_;
+
+};
+
+} // namespace robotoc
+
+#endif // ROBOTOC_CACHED_CONFIGURATION_SPACE_REF_HPP_
\ No newline at end of file
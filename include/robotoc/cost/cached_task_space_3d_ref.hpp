@@ -0,0 +1,69 @@
+#ifndef ROBOTOC_CACHED_TASK_SPACE_3D_REF_HPP_
+#define ROBOTOC_CACHED_TASK_SPACE_3D_REF_HPP_
+
+#include <memory>
+
+#include "Eigen/Core"
+
+#include "robotoc/ocp/grid_info.hpp"
+#include "robotoc/ocp/time_discretization.hpp"
+#include "robotoc/cost/task_space_3d_ref_base.hpp"
+#include "robotoc/cost/grid_ref_cache.hpp"
+
+
+namespace robotoc {
+
+///
+/// @class CachedTaskSpace3DRef
+/// @brief Wraps a TaskSpace3DRefBase and caches the reference task-space 
+/// position and its activity for each grid. The cache is filled by 
+/// updateCache() once per time discretization, e.g., after 
+/// OCPSolver::discretize(), and is invalidated by clearCache(). Grids that are 
+/// not cached are passed through to the wrapped reference. 
+///
+class CachedTaskSpace3DRef : public TaskSpace3DRefBase {
+public:
+  ///
+  /// @brief Constructor. 
+  /// @param[in] ref Reference to be cached.
+  ///
+  CachedTaskSpace3DRef(const std::shared_ptr<TaskSpace3DRefBase>& ref);
+
+  ///
+  /// @brief Destructor. 
+  ///
+  ~CachedTaskSpace3DRef();
+
+  ///
+  /// @brief Evaluates the wrapped reference on all the grids of the time 
+  /// discretization and stores the results.
+  /// @param[in] time_discretization Time discretization.
+  ///
+  void updateCache(const TimeDiscretization& time_discretization);
+
+  ///
+  /// @brief Invalidates the cache. Call this when the wrapped reference is 
+  /// modified.
+  ///
+  void clearCache();
+
+  ///
+  /// @brief Gets the wrapped reference.
+  /// @return Shared ptr to the wrapped reference.
+  ///
+  const std::shared_ptr<TaskSpace3DRefBase>& getRef() const;
+
+  void updateRef(const GridInfo& grid_info, 
+                 Eigen::VectorXd& x3d_ref) const override;
+
+  bool isActive(const GridInfo& grid_info) const override;
+
+private:
+  std::shared_ptr<TaskSpace3DRefBase> ref_;
+  GridRefCache cache_;
+
+};
+
+} // namespace robotoc
+
+#endif // ROBOTOC_CACHED_TASK_SPACE_3D_REF_HPP_
\ No newline at end of file
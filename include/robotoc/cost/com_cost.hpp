@@ -188,4 +188,6 @@ private:
 
 } // namespace robotoc
 
+#include "robotoc/cost/com_cost.hxx"
+
 #endif // ROBOTOC_COM_COST_HPP_ 
\ No newline at end of file
@@ -0,0 +1,133 @@
+#ifndef ROBOTOC_COM_COST_HXX_
+#define ROBOTOC_COM_COST_HXX_
+
+#include "robotoc/cost/com_cost.hpp"
+
+
+namespace robotoc {
+
+inline double CoMCost::evalStageCost(Robot& robot, const ContactStatus& contact_status, 
+                                     CostFunctionData& data, const GridInfo& grid_info, 
+                                     const SplitSolution& s) const {
+  if (enable_cost_ && isCostActive(grid_info)) {
+    evalDiff(robot, data, grid_info);
+    const double l = (weight_.array()*data.diff_3d.array()*data.diff_3d.array()).sum();
+    return 0.5 * grid_info.dt * l;
+  }
+  else {
+    return 0.0;
+  }
+}
+
+
+inline void CoMCost::evalStageCostDerivatives(Robot& robot, 
+                                              const ContactStatus& contact_status, 
+                                              CostFunctionData& data, 
+                                              const GridInfo& grid_info,
+                                              const SplitSolution& s,
+                                              SplitKKTResidual& kkt_residual) const {
+  if (enable_cost_ && isCostActive(grid_info)) {
+    data.J_3d.setZero();
+    robot.getCoMJacobian(data.J_3d);
+    kkt_residual.lq().noalias() 
+        += grid_info.dt * data.J_3d.transpose() * weight_.asDiagonal() * data.diff_3d;
+  }
+}
+
+
+inline void CoMCost::evalStageCostHessian(Robot& robot, 
+                                          const ContactStatus& contact_status, 
+                                          CostFunctionData& data, 
+                                          const GridInfo& grid_info,
+                                          const SplitSolution& s, 
+                                          SplitKKTMatrix& kkt_matrix) const {
+  if (enable_cost_ && isCostActive(grid_info)) {
+    kkt_matrix.Qqq().noalias()
+        += grid_info.dt * data.J_3d.transpose() * weight_.asDiagonal() * data.J_3d;
+  }
+}
+
+
+inline double CoMCost::evalTerminalCost(Robot& robot, CostFunctionData& data, 
+                                        const GridInfo& grid_info,
+                                        const SplitSolution& s) const {
+  if (enable_cost_terminal_ && isCostActive(grid_info)) {
+    evalDiff(robot, data, grid_info);
+    const double l = (weight_terminal_.array()*data.diff_3d.array()*data.diff_3d.array()).sum();
+    return 0.5 * l;
+  }
+  else {
+    return 0.0;
+  }
+}
+
+
+inline void CoMCost::evalTerminalCostDerivatives(Robot& robot, CostFunctionData& data, 
+                                                 const GridInfo& grid_info,
+                                                 const SplitSolution& s, 
+                                                 SplitKKTResidual& kkt_residual) const {
+  if (enable_cost_terminal_ && isCostActive(grid_info)) {
+    data.J_3d.setZero();
+    robot.getCoMJacobian(data.J_3d);
+    kkt_residual.lq().noalias() 
+        += data.J_3d.transpose() * weight_terminal_.asDiagonal() * data.diff_3d;
+  }
+}
+
+
+inline void CoMCost::evalTerminalCostHessian(Robot& robot, CostFunctionData& data, 
+                                             const GridInfo& grid_info,
+                                             const SplitSolution& s, 
+                                             SplitKKTMatrix& kkt_matrix) const {
+  if (enable_cost_terminal_ && isCostActive(grid_info)) {
+    data.J_3d.setZero();
+    robot.getCoMJacobian(data.J_3d);
+    kkt_matrix.Qqq().noalias()
+        += data.J_3d.transpose() * weight_terminal_.asDiagonal() * data.J_3d;
+  }
+}
+
+
+inline double CoMCost::evalImpactCost(Robot& robot, const ImpactStatus& impact_status, 
+                                       CostFunctionData& data, 
+                                       const GridInfo& grid_info,
+                                       const SplitSolution& s) const {
+  if (enable_cost_impact_ && isCostActive(grid_info)) {
+    evalDiff(robot, data, grid_info);
+    const double l = (weight_impact_.array()*data.diff_3d.array()*data.diff_3d.array()).sum();
+    return 0.5 * l;
+  }
+  else {
+    return 0.0;
+  }
+}
+
+
+inline void CoMCost::evalImpactCostDerivatives(
+    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s, 
+    SplitKKTResidual& kkt_residual) const {
+  if (enable_cost_impact_ && isCostActive(grid_info)) {
+    data.J_3d.setZero();
+    robot.getCoMJacobian(data.J_3d);
+    kkt_residual.lq().noalias() 
+        += data.J_3d.transpose() * weight_impact_.asDiagonal() * data.diff_3d;
+  }
+}
+
+
+inline void CoMCost::evalImpactCostHessian(Robot& robot, 
+                                            const ImpactStatus& impact_status, 
+                                            CostFunctionData& data, 
+                                            const GridInfo& grid_info,
+                                            const SplitSolution& s, 
+                                            SplitKKTMatrix& kkt_matrix) const {
+  if (enable_cost_impact_ && isCostActive(grid_info)) {
+    kkt_matrix.Qqq().noalias()
+        += data.J_3d.transpose() * weight_impact_.asDiagonal() * data.J_3d;
+  }
+}
+
+} // namespace robotoc
+
+#endif // ROBOTOC_COM_COST_HXX_ 
\ No newline at end of file
@@ -270,4 +270,6 @@ private:
 } // namespace robotoc
 
 
+#include "robotoc/cost/configuration_space_cost.hxx"
+
 #endif // ROBOTOC_CONFIGURATION_SPACE_COST_HPP_ 
\ No newline at end of file
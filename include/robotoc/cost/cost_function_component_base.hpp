@@ -27,7 +27,7 @@ public:
   ///
   /// @brief Default constructor. 
   ///
-  CostFunctionComponentBase() {}
+  CostFunctionComponentBase() : has_fused_evaluation_(false) {}
 
   ///
   /// @brief Destructor. 
@@ -203,6 +203,171 @@ public:
                                       const SplitSolution& s, 
                                       SplitKKTMatrix& kkt_matrix) const = 0; 
 
+  ///
+  /// @brief Computes the stage cost and its first-order partial derivatives. 
+  /// By default, calls evalStageCost() and evalStageCostDerivatives(). 
+  /// Override this to fuse the two computations, e.g., when this component 
+  /// is composed of other components sharing CostFunctionData, and construct
+  /// the base with has_fused_evaluation = true so that CostFunction calls it.
+  /// @param[in] robot Robot model.
+  /// @param[in] contact_status Contact status.
+  /// @param[in] data Cost function data.
+  /// @param[in] grid_info Grid info.
+  /// @param[in] s Split solution.
+  /// @param[in, out] kkt_residual Split KKT residual. The partial derivatives 
+  /// are added to this object.
+  /// @return Stage cost.
+  ///
+  virtual double linearizeStageCost(Robot& robot, 
+                                    const ContactStatus& contact_status, 
+                                    CostFunctionData& data, 
+                                    const GridInfo& grid_info, 
+                                    const SplitSolution& s, 
+                                    SplitKKTResidual& kkt_residual) const {
+    const double l = evalStageCost(robot, contact_status, data, grid_info, s);
+    evalStageCostDerivatives(robot, contact_status, data, grid_info, s, 
+                             kkt_residual);
+    return l;
+  }
+
+  ///
+  /// @brief Computes the stage cost, its first-order partial derivatives, and 
+  /// its Hessian. By default, calls evalStageCost(), 
+  /// evalStageCostDerivatives(), and evalStageCostHessian().
+  /// @param[in] robot Robot model.
+  /// @param[in] contact_status Contact status.
+  /// @param[in] data Cost function data.
+  /// @param[in] grid_info Grid info.
+  /// @param[in] s Split solution.
+  /// @param[in, out] kkt_residual Split KKT residual. The partial derivatives 
+  /// are added to this object.
+  /// @param[in, out] kkt_matrix Split KKT matrix. The Hessians are added to 
+  /// this object.
+  /// @return Stage cost.
+  ///
+  virtual double quadratizeStageCost(Robot& robot, 
+                                     const ContactStatus& contact_status, 
+                                     CostFunctionData& data, 
+                                     const GridInfo& grid_info, 
+                                     const SplitSolution& s, 
+                                     SplitKKTResidual& kkt_residual, 
+                                     SplitKKTMatrix& kkt_matrix) const {
+    const double l = evalStageCost(robot, contact_status, data, grid_info, s);
+    evalStageCostDerivatives(robot, contact_status, data, grid_info, s, 
+                             kkt_residual);
+    evalStageCostHessian(robot, contact_status, data, grid_info, s, kkt_matrix);
+    return l;
+  }
+
+  ///
+  /// @brief Computes the terminal cost and its first-order partial 
+  /// derivatives. By default, calls evalTerminalCost() and 
+  /// evalTerminalCostDerivatives().
+  /// @param[in] robot Robot model.
+  /// @param[in] data Cost function data.
+  /// @param[in] grid_info Grid info.
+  /// @param[in] s Split solution.
+  /// @param[in, out] kkt_residual Split KKT residual. The partial derivatives 
+  /// are added to this object.
+  /// @return Terminal cost.
+  ///
+  virtual double linearizeTerminalCost(Robot& robot, CostFunctionData& data, 
+                                       const GridInfo& grid_info, 
+                                       const SplitSolution& s, 
+                                       SplitKKTResidual& kkt_residual) const {
+    const double l = evalTerminalCost(robot, data, grid_info, s);
+    evalTerminalCostDerivatives(robot, data, grid_info, s, kkt_residual);
+    return l;
+  }
+
+  ///
+  /// @brief Computes the terminal cost, its first-order partial derivatives, 
+  /// and its Hessian. By default, calls evalTerminalCost(), 
+  /// evalTerminalCostDerivatives(), and evalTerminalCostHessian().
+  /// @param[in] robot Robot model.
+  /// @param[in] data Cost function data.
+  /// @param[in] grid_info Grid info.
+  /// @param[in] s Split solution.
+  /// @param[in, out] kkt_residual Split KKT residual. The partial derivatives 
+  /// are added to this object.
+  /// @param[in, out] kkt_matrix Split KKT matrix. The Hessians are added to 
+  /// this object.
+  /// @return Terminal cost.
+  ///
+  virtual double quadratizeTerminalCost(Robot& robot, CostFunctionData& data, 
+                                        const GridInfo& grid_info, 
+                                        const SplitSolution& s, 
+                                        SplitKKTResidual& kkt_residual, 
+                                        SplitKKTMatrix& kkt_matrix) const {
+    const double l = evalTerminalCost(robot, data, grid_info, s);
+    evalTerminalCostDerivatives(robot, data, grid_info, s, kkt_residual);
+    evalTerminalCostHessian(robot, data, grid_info, s, kkt_matrix);
+    return l;
+  }
+
+  ///
+  /// @brief Computes the impact cost and its first-order partial derivatives. 
+  /// By default, calls evalImpactCost() and evalImpactCostDerivatives().
+  /// @param[in] robot Robot model.
+  /// @param[in] impact_status Impact status.
+  /// @param[in] data Cost function data.
+  /// @param[in] grid_info Grid info.
+  /// @param[in] s Split solution.
+  /// @param[in, out] kkt_residual Split KKT residual. The partial derivatives 
+  /// are added to this object.
+  /// @return Impact cost.
+  ///
+  virtual double linearizeImpactCost(Robot& robot, 
+                                     const ImpactStatus& impact_status, 
+                                     CostFunctionData& data, 
+                                     const GridInfo& grid_info, 
+                                     const SplitSolution& s, 
+                                     SplitKKTResidual& kkt_residual) const {
+    const double l = evalImpactCost(robot, impact_status, data, grid_info, s);
+    evalImpactCostDerivatives(robot, impact_status, data, grid_info, s, 
+                              kkt_residual);
+    return l;
+  }
+
+  ///
+  /// @brief Computes the impact cost, its first-order partial derivatives, and 
+  /// its Hessian. By default, calls evalImpactCost(), 
+  /// evalImpactCostDerivatives(), and evalImpactCostHessian().
+  /// @param[in] robot Robot model.
+  /// @param[in] impact_status Impact status.
+  /// @param[in] data Cost function data.
+  /// @param[in] grid_info Grid info.
+  /// @param[in] s Split solution.
+  /// @param[in, out] kkt_residual Split KKT residual. The partial derivatives 
+  /// are added to this object.
+  /// @param[in, out] kkt_matrix Split KKT matrix. The Hessians are added to 
+  /// this object.
+  /// @return Impact cost.
+  ///
+  virtual double quadratizeImpactCost(Robot& robot, 
+                                      const ImpactStatus& impact_status, 
+                                      CostFunctionData& data, 
+                                      const GridInfo& grid_info, 
+                                      const SplitSolution& s, 
+                                      SplitKKTResidual& kkt_residual, 
+                                      SplitKKTMatrix& kkt_matrix) const {
+    const double l = evalImpactCost(robot, impact_status, data, grid_info, s);
+    evalImpactCostDerivatives(robot, impact_status, data, grid_info, s, 
+                              kkt_residual);
+    evalImpactCostHessian(robot, impact_status, data, grid_info, s, 
+                          kkt_matrix);
+    return l;
+  }
+
+  ///
+  /// @brief Checks if this component overrides the fused computations, i.e., 
+  /// linearizeStageCost(), quadratizeStageCost(), etc. CostFunction calls 
+  /// them only for such components and calls evalStageCost(), 
+  /// evalStageCostDerivatives(), and evalStageCostHessian() otherwise.
+  /// @return true if this component overrides the fused computations. 
+  ///
+  bool hasFusedEvaluation() const { return has_fused_evaluation_; }
+
   ///
   /// @brief Gets the shared ptr of this object as the specified type. If this 
   /// fails in dynamic casting, throws an exception.
@@ -219,6 +384,18 @@ public:
     return derived_ptr;
   }
 
+protected:
+  ///
+  /// @brief Constructor. 
+  /// @param[in] has_fused_evaluation Set true if the derived class overrides 
+  /// the fused computations. 
+  ///
+  explicit CostFunctionComponentBase(const bool has_fused_evaluation) 
+    : has_fused_evaluation_(has_fused_evaluation) {}
+
+private:
+  bool has_fused_evaluation_;
+
 };
 
 } // namespace robotoc
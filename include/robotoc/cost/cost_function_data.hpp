@@ -5,6 +5,7 @@
 
 #include "robotoc/robot/robot.hpp"
 #include "robotoc/robot/se3.hpp"
+#include "robotoc/core/split_kkt_residual.hpp"
 
 
 namespace robotoc {
@@ -144,6 +145,13 @@ public:
   ///
   Eigen::MatrixXd JJ_6d;
 
+  ///
+  /// @brief Split KKT residual used in StaticCostFunction to recompute the 
+  /// derivatives of each component before its Hessian. Be allocated only when
+  /// CostFunction has StaticCostFunction, or at the first use otherwise.
+  ///
+  SplitKKTResidual kkt_residual;
+
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW 
 };
 
@@ -0,0 +1,153 @@
+#ifndef ROBOTOC_GRID_REF_CACHE_HPP_
+#define ROBOTOC_GRID_REF_CACHE_HPP_
+
+#include <vector>
+#include <cassert>
+
+#include "Eigen/Core"
+
+#include "robotoc/ocp/grid_info.hpp"
+
+
+namespace robotoc {
+
+///
+/// @class GridRefCache
+/// @brief Cache of a reference vector and its activity indexed by the grid 
+/// (GridInfo::stage). An entry is used only if the grid info passed at the 
+/// look-up is identical to that at the caching, including the time step and 
+/// the place of the grid in its phase, so that a stale entry is never 
+/// returned after the time discretization changes, e.g., by moved events.
+///
+class GridRefCache {
+public:
+  ///
+  /// @brief Constructor. 
+  /// @param[in] dim Dimension of the reference vector.
+  ///
+  GridRefCache(const int dim);
+
+  ///
+  /// @brief Default constructor. 
+  ///
+  GridRefCache();
+
+  ///
+  /// @brief Destructor. 
+  ///
+  ~GridRefCache() = default;
+
+  ///
+  /// @brief Default copy constructor. 
+  ///
+  GridRefCache(const GridRefCache&) = default;
+
+  ///
+  /// @brief Default copy operator. 
+  ///
+  GridRefCache& operator=(const GridRefCache&) = default;
+
+  ///
+  /// @brief Default move constructor. 
+  ///
+  GridRefCache(GridRefCache&&) noexcept = default;
+
+  ///
+  /// @brief Default move assign operator. 
+  ///
+  GridRefCache& operator=(GridRefCache&&) noexcept = default;
+
+  ///
+  /// @brief Invalidates all the entries and makes sure that the cache can 
+  /// hold num_grids entries. Memory is reallocated only if num_grids exceeds 
+  /// the current capacity.
+  /// @param[in] num_grids Number of the grids. 
+  ///
+  void reset(const int num_grids);
+
+  ///
+  /// @brief Invalidates all the entries. 
+  ///
+  void clear();
+
+  ///
+  /// @brief Stores the grid info and the activity at the entry indexed by 
+  /// GridInfo::stage. The reference vector of this entry must be then set via 
+  /// ref().
+  /// @param[in] grid_info Grid info.
+  /// @param[in] is_active Activity of the reference at this grid.
+  ///
+  void cache(const GridInfo& grid_info, const bool is_active);
+
+  ///
+  /// @brief Checks if a valid entry exists for the grid info. 
+  /// @param[in] grid_info Grid info.
+  /// @return true if a valid entry exists. false if not.
+  ///
+  bool isCached(const GridInfo& grid_info) const {
+    const int stage = grid_info.stage;
+    if (stage < 0 || stage >= num_grids_ || !is_cached_[stage]) {
+      return false;
+    }
+    const GridInfo& cached = grids_[stage];
+    return (cached.type == grid_info.type && cached.t == grid_info.t 
+            && cached.t0 == grid_info.t0 && cached.dt == grid_info.dt 
+            && cached.phase == grid_info.phase
+            && cached.impact_index == grid_info.impact_index
+            && cached.lift_index == grid_info.lift_index
+            && cached.stage_in_phase == grid_info.stage_in_phase
+            && cached.num_grids_in_phase == grid_info.num_grids_in_phase);
+  }
+
+  ///
+  /// @brief Gets the cached activity. 
+  /// @param[in] stage Stage of the grid.
+  /// @return Cached activity.
+  ///
+  bool isActive(const int stage) const {
+    assert(stage >= 0);
+    assert(stage < num_grids_);
+    return is_active_[stage];
+  }
+
+  ///
+  /// @brief Gets the cached reference vector. 
+  /// @param[in] stage Stage of the grid.
+  /// @return Reference to the cached reference vector.
+  ///
+  Eigen::VectorXd& ref(const int stage) {
+    assert(stage >= 0);
+    assert(stage < num_grids_);
+    return refs_[stage];
+  }
+
+  ///
+  /// @brief Gets the cached reference vector. 
+  /// @param[in] stage Stage of the grid.
+  /// @return Const reference to the cached reference vector.
+  ///
+  const Eigen::VectorXd& ref(const int stage) const {
+    assert(stage >= 0);
+    assert(stage < num_grids_);
+    return refs_[stage];
+  }
+
+  ///
+  /// @brief Returns the number of the grids that the cache currently holds. 
+  /// @return The number of the grids.
+  ///
+  int size() const {
+    return num_grids_;
+  }
+
+private:
+  int dim_, num_grids_;
+  std::vector<GridInfo> grids_;
+  std::vector<Eigen::VectorXd> refs_;
+  std::vector<bool> is_active_, is_cached_;
+
+};
+
+} // namespace robotoc
+
+#endif // ROBOTOC_GRID_REF_CACHE_HPP_
\ No newline at end of file
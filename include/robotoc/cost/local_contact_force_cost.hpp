@@ -141,4 +141,6 @@ private:
 } // namespace robotoc
 
 
+#include "robotoc/cost/local_contact_force_cost.hxx"
+
 #endif // ROBOTOC_LOCAL_CONTACT_FORCE_COST_HPP_ 
\ No newline at end of file
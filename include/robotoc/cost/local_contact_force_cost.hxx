@@ -0,0 +1,162 @@
+#ifndef ROBOTOC_LOCAL_CONTACT_FORCE_COST_HXX_
+#define ROBOTOC_LOCAL_CONTACT_FORCE_COST_HXX_
+
+#include "robotoc/cost/local_contact_force_cost.hpp"
+
+
+namespace robotoc {
+
+inline double LocalContactForceCost::evalStageCost(Robot& robot, 
+                                                   const ContactStatus& contact_status, 
+                                                   CostFunctionData& data, 
+                                                   const GridInfo& grid_info,
+                                                   const SplitSolution& s) const {
+  double l = 0;
+  for (int i=0; i<max_num_contacts_; ++i) {
+    if (contact_status.isContactActive(i)) {
+      const auto& fl = s.f[i].template head<3>();
+      l += (f_weight_[i].array() * (fl.array()-f_ref_[i].array()) 
+                                 * (fl.array()-f_ref_[i].array())).sum();
+    }
+  }
+  return 0.5 * grid_info.dt * l;
+}
+
+
+inline void LocalContactForceCost::evalStageCostDerivatives(
+    Robot& robot, const ContactStatus& contact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s, 
+    SplitKKTResidual& kkt_residual) const {
+  int dimf_stack = 0;
+  for (int i=0; i<max_num_contacts_; ++i) {
+    if (contact_status.isContactActive(i)) {
+      const auto& fl = s.f[i].template head<3>();
+      kkt_residual.lf().template segment<3>(dimf_stack).array()
+          += grid_info.dt * f_weight_[i].array() * (fl.array()-f_ref_[i].array());
+      switch (contact_types_[i]) {
+        case ContactType::PointContact:
+          dimf_stack += 3;
+          break;
+        case ContactType::SurfaceContact:
+          dimf_stack += 6;
+          break;
+        default:
+          break;
+      }
+    }
+  }
+}
+
+
+inline void LocalContactForceCost::evalStageCostHessian(
+    Robot& robot, const ContactStatus& contact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s, 
+    SplitKKTMatrix& kkt_matrix) const {
+  int dimf_stack = 0;
+  for (int i=0; i<max_num_contacts_; ++i) {
+    if (contact_status.isContactActive(i)) {
+      kkt_matrix.Qff().diagonal().template segment<3>(dimf_stack).noalias() 
+          += grid_info.dt * f_weight_[i];
+      switch (contact_types_[i]) {
+        case ContactType::PointContact:
+          dimf_stack += 3;
+          break;
+        case ContactType::SurfaceContact:
+          dimf_stack += 6;
+          break;
+        default:
+          break;
+      }
+    }
+  }
+}
+
+
+inline double LocalContactForceCost::evalTerminalCost(Robot& robot, 
+                                                      CostFunctionData& data, 
+                                                      const GridInfo& grid_info,  
+                                                      const SplitSolution& s) const {
+  return 0;
+}
+
+
+inline void LocalContactForceCost::evalTerminalCostDerivatives(
+    Robot& robot, CostFunctionData& data, const GridInfo& grid_info,  
+    const SplitSolution& s, SplitKKTResidual& kkt_residual) const {
+  // Do nothing.
+}
+
+
+inline void LocalContactForceCost::evalTerminalCostHessian(
+    Robot& robot, CostFunctionData& data, const GridInfo& grid_info,  
+    const SplitSolution& s, SplitKKTMatrix& kkt_matrix) const {
+  // Do nothing.
+}
+
+
+inline double LocalContactForceCost::evalImpactCost(
+    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s) const {
+  double l = 0;
+  for (int i=0; i<max_num_contacts_; ++i) {
+    if (impact_status.isImpactActive(i)) {
+      const auto& fl = s.f[i].template head<3>();
+      l += (fi_weight_[i].array() * (fl.array()-fi_ref_[i].array()) 
+                                  * (fl.array()-fi_ref_[i].array())).sum();
+    }
+  }
+  return 0.5 * l;
+}
+
+
+inline void LocalContactForceCost::evalImpactCostDerivatives(
+    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s, 
+    SplitKKTResidual& kkt_residual) const {
+  int dimf_stack = 0;
+  for (int i=0; i<max_num_contacts_; ++i) {
+    if (impact_status.isImpactActive(i)) {
+      const auto& fl = s.f[i].template head<3>();
+      kkt_residual.lf().template segment<3>(dimf_stack).array()
+          += fi_weight_[i].array() * (fl.array()-fi_ref_[i].array());
+      switch (contact_types_[i]) {
+        case ContactType::PointContact:
+          dimf_stack += 3;
+          break;
+        case ContactType::SurfaceContact:
+          dimf_stack += 6;
+          break;
+        default:
+          break;
+      }
+    }
+  }
+}
+
+
+inline void LocalContactForceCost::evalImpactCostHessian(
+    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s, 
+    SplitKKTMatrix& kkt_matrix) const {
+  int dimf_stack = 0;
+  for (int i=0; i<max_num_contacts_; ++i) {
+    if (impact_status.isImpactActive(i)) {
+      kkt_matrix.Qff().diagonal().template segment<3>(dimf_stack).noalias() 
+          += fi_weight_[i];
+      switch (contact_types_[i]) {
+        case ContactType::PointContact:
+          dimf_stack += 3;
+          break;
+        case ContactType::SurfaceContact:
+          dimf_stack += 6;
+          break;
+        default:
+          break;
+      }
+    }
+  }
+}
+
+} // namespace robotoc
+
+#endif // ROBOTOC_LOCAL_CONTACT_FORCE_COST_HXX_ 
\ No newline at end of file
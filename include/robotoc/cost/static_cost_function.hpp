@@ -0,0 +1,185 @@
+#ifndef ROBOTOC_STATIC_COST_FUNCTION_HPP_
+#define ROBOTOC_STATIC_COST_FUNCTION_HPP_
+
+#include <tuple>
+#include <type_traits>
+#include <cstddef>
+
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/robot/contact_status.hpp"
+#include "robotoc/robot/impact_status.hpp"
+#include "robotoc/core/split_solution.hpp"
+#include "robotoc/core/split_kkt_residual.hpp"
+#include "robotoc/core/split_kkt_matrix.hpp"
+#include "robotoc/ocp/grid_info.hpp"
+#include "robotoc/cost/cost_function_component_base.hpp"
+#include "robotoc/cost/cost_function_data.hpp"
+
+
+namespace robotoc {
+
+///
+/// @class StaticCostFunction
+/// @brief Cost function components composed at compile time. The components
+/// are stored by value and are called through their concrete types, so that
+/// the compiler can inline their kernels, which are defined in the headers 
+/// (e.g., com_cost.hxx). Since this class itself is a 
+/// CostFunctionComponentBase, it is added to CostFunction as one component
+/// and therefore costs a single virtual call per stage regardless of the
+/// number of the composed components. The components share 
+/// CostFunctionData, so the cost, derivatives, and Hessian of each component 
+/// are computed before those of the next component.
+/// @tparam Components Types of the cost function components. Each type must
+/// be a concrete class derived from CostFunctionComponentBase.
+///
+template <typename... Components>
+class StaticCostFunction final : public CostFunctionComponentBase {
+  static_assert(sizeof...(Components) > 0, 
+                "[StaticCostFunction] at least one component is required!");
+
+public:
+  ///
+  /// @brief Constructor.
+  /// @param[in] components Cost function components.
+  ///
+  StaticCostFunction(const Components&... components);
+
+  ///
+  /// @brief Destructor.
+  ///
+  ~StaticCostFunction() = default;
+
+  ///
+  /// @brief Default copy constructor.
+  ///
+  StaticCostFunction(const StaticCostFunction&) = default;
+
+  ///
+  /// @brief Default copy operator.
+  ///
+  StaticCostFunction& operator=(const StaticCostFunction&) = default;
+
+  ///
+  /// @brief Default move constructor.
+  ///
+  StaticCostFunction(StaticCostFunction&&) noexcept = default;
+
+  ///
+  /// @brief Default move assign operator.
+  ///
+  StaticCostFunction& operator=(StaticCostFunction&&) noexcept = default;
+
+  ///
+  /// @brief Gets the I-th cost function component.
+  /// @tparam I Index of the component.
+  /// @return Reference to the I-th component.
+  ///
+  template <std::size_t I>
+  typename std::tuple_element<I, std::tuple<Components...>>::type& get();
+
+  ///
+  /// @brief Gets the I-th cost function component.
+  /// @tparam I Index of the component.
+  /// @return Const reference to the I-th component.
+  ///
+  template <std::size_t I>
+  const typename std::tuple_element<I, std::tuple<Components...>>::type&
+  get() const;
+
+  ///
+  /// @brief Returns the number of the composed components.
+  /// @return The number of the composed components.
+  ///
+  static constexpr std::size_t size() { return sizeof...(Components); }
+
+  double evalStageCost(Robot& robot, const ContactStatus& contact_status,
+                       CostFunctionData& data, const GridInfo& grid_info,
+                       const SplitSolution& s) const override;
+
+  void evalStageCostDerivatives(Robot& robot,
+                                const ContactStatus& contact_status,
+                                CostFunctionData& data,
+                                const GridInfo& grid_info,
+                                const SplitSolution& s,
+                                SplitKKTResidual& kkt_residual) const override;
+
+  void evalStageCostHessian(Robot& robot, const ContactStatus& contact_status,
+                            CostFunctionData& data, const GridInfo& grid_info,
+                            const SplitSolution& s,
+                            SplitKKTMatrix& kkt_matrix) const override;
+
+  double linearizeStageCost(Robot& robot, const ContactStatus& contact_status, 
+                            CostFunctionData& data, const GridInfo& grid_info, 
+                            const SplitSolution& s, 
+                            SplitKKTResidual& kkt_residual) const override;
+
+  double quadratizeStageCost(Robot& robot, const ContactStatus& contact_status, 
+                             CostFunctionData& data, const GridInfo& grid_info, 
+                             const SplitSolution& s, 
+                             SplitKKTResidual& kkt_residual, 
+                             SplitKKTMatrix& kkt_matrix) const override;
+
+  double evalTerminalCost(Robot& robot, CostFunctionData& data,
+                          const GridInfo& grid_info,
+                          const SplitSolution& s) const override;
+
+  void evalTerminalCostDerivatives(Robot& robot, CostFunctionData& data,
+                                   const GridInfo& grid_info,
+                                   const SplitSolution& s,
+                                   SplitKKTResidual& kkt_residual) const override;
+
+  void evalTerminalCostHessian(Robot& robot, CostFunctionData& data,
+                               const GridInfo& grid_info,
+                               const SplitSolution& s,
+                               SplitKKTMatrix& kkt_matrix) const override;
+
+  double linearizeTerminalCost(Robot& robot, CostFunctionData& data, 
+                               const GridInfo& grid_info, 
+                               const SplitSolution& s, 
+                               SplitKKTResidual& kkt_residual) const override;
+
+  double quadratizeTerminalCost(Robot& robot, CostFunctionData& data, 
+                                const GridInfo& grid_info, 
+                                const SplitSolution& s, 
+                                SplitKKTResidual& kkt_residual, 
+                                SplitKKTMatrix& kkt_matrix) const override;
+
+  double evalImpactCost(Robot& robot, const ImpactStatus& impact_status,
+                        CostFunctionData& data, const GridInfo& grid_info,
+                        const SplitSolution& s) const override;
+
+  void evalImpactCostDerivatives(Robot& robot,
+                                 const ImpactStatus& impact_status,
+                                 CostFunctionData& data,
+                                 const GridInfo& grid_info,
+                                 const SplitSolution& s,
+                                 SplitKKTResidual& kkt_residual) const override;
+
+  void evalImpactCostHessian(Robot& robot, const ImpactStatus& impact_status,
+                             CostFunctionData& data, const GridInfo& grid_info,
+                             const SplitSolution& s,
+                             SplitKKTMatrix& kkt_matrix) const override;
+
+  double linearizeImpactCost(Robot& robot, const ImpactStatus& impact_status, 
+                             CostFunctionData& data, const GridInfo& grid_info, 
+                             const SplitSolution& s, 
+                             SplitKKTResidual& kkt_residual) const override;
+
+  double quadratizeImpactCost(Robot& robot, const ImpactStatus& impact_status, 
+                              CostFunctionData& data, const GridInfo& grid_info, 
+                              const SplitSolution& s, 
+                              SplitKKTResidual& kkt_residual, 
+                              SplitKKTMatrix& kkt_matrix) const override;
+
+private:
+  std::tuple<Components...> components_;
+
+};
+
+} // namespace robotoc
+
+#include "robotoc/cost/static_cost_function.hxx"
+
+#endif // ROBOTOC_STATIC_COST_FUNCTION_HPP_
\ No newline at end of file
@@ -0,0 +1,467 @@
+#ifndef ROBOTOC_STATIC_COST_FUNCTION_HXX_
+#define ROBOTOC_STATIC_COST_FUNCTION_HXX_
+
+#include "robotoc/cost/static_cost_function.hpp"
+
+#include <cassert>
+
+
+namespace robotoc {
+namespace staticcostfunctionimpl {
+
+template <typename... Components>
+struct AreCostFunctionComponents;
+
+template <>
+struct AreCostFunctionComponents<> : std::true_type {};
+
+template <typename Component, typename... Components>
+struct AreCostFunctionComponents<Component, Components...>
+  : std::integral_constant<
+        bool, 
+        std::is_base_of<CostFunctionComponentBase, Component>::value 
+            && AreCostFunctionComponents<Components...>::value> {};
+
+
+///
+/// @brief Gets the buffer into which the derivatives are recomputed before 
+/// the Hessians. The buffer is owned by CostFunctionData and is allocated only
+/// if CostFunction::createCostFunctionData() has not done it.
+///
+inline SplitKKTResidual& derivativeBuffer(const Robot& robot, const int dimf, 
+                                          CostFunctionData& data) {
+  if (data.kkt_residual.lx.size() == 0) {
+    data.kkt_residual = SplitKKTResidual(robot);
+  }
+  data.kkt_residual.setContactDimension(dimf);
+  data.kkt_residual.setZero();
+  return data.kkt_residual;
+}
+
+
+///
+/// @brief Unrolls the calls to the components from I-th to the last at 
+/// compile time. Each component is called with the qualified name of its 
+/// concrete type, which bypasses the virtual dispatch. Since the components 
+/// share CostFunctionData, the linearization and quadratization finish the 
+/// computation of one component before starting the next one.
+///
+template <std::size_t I, std::size_t N>
+struct ComponentLoop {
+  template <typename Tuple>
+  static inline double evalStageCost(const Tuple& costs, Robot& robot, 
+                                     const ContactStatus& contact_status, 
+                                     CostFunctionData& data, 
+                                     const GridInfo& grid_info, 
+                                     const SplitSolution& s) {
+    using Component = typename std::tuple_element<I, Tuple>::type;
+    const double l = std::get<I>(costs).Component::evalStageCost(
+        robot, contact_status, data, grid_info, s);
+    return l + ComponentLoop<I+1, N>::evalStageCost(
+        costs, robot, contact_status, data, grid_info, s);
+  }
+
+  template <typename Tuple>
+  static inline double linearizeStageCost(
+      const Tuple& costs, Robot& robot, const ContactStatus& contact_status, 
+      CostFunctionData& data, const GridInfo& grid_info, 
+      const SplitSolution& s, SplitKKTResidual& kkt_residual) {
+    using Component = typename std::tuple_element<I, Tuple>::type;
+    const auto& cost = std::get<I>(costs);
+    const double l = cost.Component::evalStageCost(
+        robot, contact_status, data, grid_info, s);
+    cost.Component::evalStageCostDerivatives(
+        robot, contact_status, data, grid_info, s, kkt_residual);
+    return l + ComponentLoop<I+1, N>::linearizeStageCost(
+        costs, robot, contact_status, data, grid_info, s, kkt_residual);
+  }
+
+  template <typename Tuple>
+  static inline double quadratizeStageCost(
+      const Tuple& costs, Robot& robot, const ContactStatus& contact_status, 
+      CostFunctionData& data, const GridInfo& grid_info, 
+      const SplitSolution& s, SplitKKTResidual& kkt_residual, 
+      SplitKKTMatrix& kkt_matrix) {
+    using Component = typename std::tuple_element<I, Tuple>::type;
+    const auto& cost = std::get<I>(costs);
+    const double l = cost.Component::evalStageCost(
+        robot, contact_status, data, grid_info, s);
+    cost.Component::evalStageCostDerivatives(
+        robot, contact_status, data, grid_info, s, kkt_residual);
+    cost.Component::evalStageCostHessian(
+        robot, contact_status, data, grid_info, s, kkt_matrix);
+    return l + ComponentLoop<I+1, N>::quadratizeStageCost(
+        costs, robot, contact_status, data, grid_info, s, kkt_residual, 
+        kkt_matrix);
+  }
+
+  template <typename Tuple>
+  static inline double evalTerminalCost(const Tuple& costs, Robot& robot, 
+                                        CostFunctionData& data, 
+                                        const GridInfo& grid_info, 
+                                        const SplitSolution& s) {
+    using Component = typename std::tuple_element<I, Tuple>::type;
+    const double l = std::get<I>(costs).Component::evalTerminalCost(
+        robot, data, grid_info, s);
+    return l + ComponentLoop<I+1, N>::evalTerminalCost(
+        costs, robot, data, grid_info, s);
+  }
+
+  template <typename Tuple>
+  static inline double linearizeTerminalCost(
+      const Tuple& costs, Robot& robot, CostFunctionData& data, 
+      const GridInfo& grid_info, const SplitSolution& s, 
+      SplitKKTResidual& kkt_residual) {
+    using Component = typename std::tuple_element<I, Tuple>::type;
+    const auto& cost = std::get<I>(costs);
+    const double l = cost.Component::evalTerminalCost(robot, data, grid_info, s);
+    cost.Component::evalTerminalCostDerivatives(
+        robot, data, grid_info, s, kkt_residual);
+    return l + ComponentLoop<I+1, N>::linearizeTerminalCost(
+        costs, robot, data, grid_info, s, kkt_residual);
+  }
+
+  template <typename Tuple>
+  static inline double quadratizeTerminalCost(
+      const Tuple& costs, Robot& robot, CostFunctionData& data, 
+      const GridInfo& grid_info, const SplitSolution& s, 
+      SplitKKTResidual& kkt_residual, SplitKKTMatrix& kkt_matrix) {
+    using Component = typename std::tuple_element<I, Tuple>::type;
+    const auto& cost = std::get<I>(costs);
+    const double l = cost.Component::evalTerminalCost(robot, data, grid_info, s);
+    cost.Component::evalTerminalCostDerivatives(
+        robot, data, grid_info, s, kkt_residual);
+    cost.Component::evalTerminalCostHessian(
+        robot, data, grid_info, s, kkt_matrix);
+    return l + ComponentLoop<I+1, N>::quadratizeTerminalCost(
+        costs, robot, data, grid_info, s, kkt_residual, kkt_matrix);
+  }
+
+  template <typename Tuple>
+  static inline double evalImpactCost(const Tuple& costs, Robot& robot, 
+                                      const ImpactStatus& impact_status, 
+                                      CostFunctionData& data, 
+                                      const GridInfo& grid_info, 
+                                      const SplitSolution& s) {
+    using Component = typename std::tuple_element<I, Tuple>::type;
+    const double l = std::get<I>(costs).Component::evalImpactCost(
+        robot, impact_status, data, grid_info, s);
+    return l + ComponentLoop<I+1, N>::evalImpactCost(
+        costs, robot, impact_status, data, grid_info, s);
+  }
+
+  template <typename Tuple>
+  static inline double linearizeImpactCost(
+      const Tuple& costs, Robot& robot, const ImpactStatus& impact_status, 
+      CostFunctionData& data, const GridInfo& grid_info, 
+      const SplitSolution& s, SplitKKTResidual& kkt_residual) {
+    using Component = typename std::tuple_element<I, Tuple>::type;
+    const auto& cost = std::get<I>(costs);
+    const double l = cost.Component::evalImpactCost(
+        robot, impact_status, data, grid_info, s);
+    cost.Component::evalImpactCostDerivatives(
+        robot, impact_status, data, grid_info, s, kkt_residual);
+    return l + ComponentLoop<I+1, N>::linearizeImpactCost(
+        costs, robot, impact_status, data, grid_info, s, kkt_residual);
+  }
+
+  template <typename Tuple>
+  static inline double quadratizeImpactCost(
+      const Tuple& costs, Robot& robot, const ImpactStatus& impact_status, 
+      CostFunctionData& data, const GridInfo& grid_info, 
+      const SplitSolution& s, SplitKKTResidual& kkt_residual, 
+      SplitKKTMatrix& kkt_matrix) {
+    using Component = typename std::tuple_element<I, Tuple>::type;
+    const auto& cost = std::get<I>(costs);
+    const double l = cost.Component::evalImpactCost(
+        robot, impact_status, data, grid_info, s);
+    cost.Component::evalImpactCostDerivatives(
+        robot, impact_status, data, grid_info, s, kkt_residual);
+    cost.Component::evalImpactCostHessian(
+        robot, impact_status, data, grid_info, s, kkt_matrix);
+    return l + ComponentLoop<I+1, N>::quadratizeImpactCost(
+        costs, robot, impact_status, data, grid_info, s, kkt_residual, 
+        kkt_matrix);
+  }
+};
+
+
+template <std::size_t N>
+struct ComponentLoop<N, N> {
+  template <typename Tuple>
+  static inline double evalStageCost(const Tuple&, Robot&, 
+                                     const ContactStatus&, CostFunctionData&, 
+                                     const GridInfo&, const SplitSolution&) {
+    return 0.0;
+  }
+
+  template <typename Tuple>
+  static inline double linearizeStageCost(const Tuple&, Robot&, 
+                                          const ContactStatus&, 
+                                          CostFunctionData&, const GridInfo&, 
+                                          const SplitSolution&, 
+                                          SplitKKTResidual&) {
+    return 0.0;
+  }
+
+  template <typename Tuple>
+  static inline double quadratizeStageCost(const Tuple&, Robot&, 
+                                           const ContactStatus&, 
+                                           CostFunctionData&, const GridInfo&, 
+                                           const SplitSolution&, 
+                                           SplitKKTResidual&, SplitKKTMatrix&) {
+    return 0.0;
+  }
+
+  template <typename Tuple>
+  static inline double evalTerminalCost(const Tuple&, Robot&, 
+                                        CostFunctionData&, const GridInfo&, 
+                                        const SplitSolution&) {
+    return 0.0;
+  }
+
+  template <typename Tuple>
+  static inline double linearizeTerminalCost(const Tuple&, Robot&, 
+                                             CostFunctionData&, 
+                                             const GridInfo&, 
+                                             const SplitSolution&, 
+                                             SplitKKTResidual&) {
+    return 0.0;
+  }
+
+  template <typename Tuple>
+  static inline double quadratizeTerminalCost(const Tuple&, Robot&, 
+                                              CostFunctionData&, 
+                                              const GridInfo&, 
+                                              const SplitSolution&, 
+                                              SplitKKTResidual&, 
+                                              SplitKKTMatrix&) {
+    return 0.0;
+  }
+
+  template <typename Tuple>
+  static inline double evalImpactCost(const Tuple&, Robot&, 
+                                      const ImpactStatus&, CostFunctionData&, 
+                                      const GridInfo&, const SplitSolution&) {
+    return 0.0;
+  }
+
+  template <typename Tuple>
+  static inline double linearizeImpactCost(const Tuple&, Robot&, 
+                                           const ImpactStatus&, 
+                                           CostFunctionData&, const GridInfo&, 
+                                           const SplitSolution&, 
+                                           SplitKKTResidual&) {
+    return 0.0;
+  }
+
+  template <typename Tuple>
+  static inline double quadratizeImpactCost(const Tuple&, Robot&, 
+                                            const ImpactStatus&, 
+                                            CostFunctionData&, 
+                                            const GridInfo&, 
+                                            const SplitSolution&, 
+                                            SplitKKTResidual&, 
+                                            SplitKKTMatrix&) {
+    return 0.0;
+  }
+};
+
+} // namespace staticcostfunctionimpl
+
+
+template <typename... Components>
+inline StaticCostFunction<Components...>::StaticCostFunction(
+    const Components&... components)
+  : CostFunctionComponentBase(true),
+    components_(components...) {
+  static_assert(
+      staticcostfunctionimpl::AreCostFunctionComponents<Components...>::value,
+      "[StaticCostFunction] Components must be derived from CostFunctionComponentBase!");
+}
+
+
+template <typename... Components>
+template <std::size_t I>
+inline typename std::tuple_element<I, std::tuple<Components...>>::type& 
+StaticCostFunction<Components...>::get() {
+  return std::get<I>(components_);
+}
+
+
+template <typename... Components>
+template <std::size_t I>
+inline const typename std::tuple_element<I, std::tuple<Components...>>::type& 
+StaticCostFunction<Components...>::get() const {
+  return std::get<I>(components_);
+}
+
+
+template <typename... Components>
+inline double StaticCostFunction<Components...>::evalStageCost(
+    Robot& robot, const ContactStatus& contact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s) const {
+  return staticcostfunctionimpl::ComponentLoop<0, sizeof...(Components)>
+      ::evalStageCost(components_, robot, contact_status, data, grid_info, s);
+}
+
+
+template <typename... Components>
+inline void StaticCostFunction<Components...>::evalStageCostDerivatives(
+    Robot& robot, const ContactStatus& contact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s, 
+    SplitKKTResidual& kkt_residual) const {
+  // Re-evaluates each component's cost so that its derivatives are computed 
+  // from its own intermediate data.
+  staticcostfunctionimpl::ComponentLoop<0, sizeof...(Components)>
+      ::linearizeStageCost(components_, robot, contact_status, data, grid_info, 
+                           s, kkt_residual);
+}
+
+
+template <typename... Components>
+inline void StaticCostFunction<Components...>::evalStageCostHessian(
+    Robot& robot, const ContactStatus& contact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s, 
+    SplitKKTMatrix& kkt_matrix) const {
+  // Re-evaluates each component's cost and derivatives so that its Hessian is 
+  // computed from its own intermediate data. CostFunction calls 
+  // quadratizeStageCost() instead.
+  auto& kkt_residual = staticcostfunctionimpl::derivativeBuffer(
+      robot, contact_status.dimf(), data);
+  staticcostfunctionimpl::ComponentLoop<0, sizeof...(Components)>
+      ::quadratizeStageCost(components_, robot, contact_status, data, grid_info, 
+                            s, kkt_residual, kkt_matrix);
+}
+
+
+template <typename... Components>
+inline double StaticCostFunction<Components...>::linearizeStageCost(
+    Robot& robot, const ContactStatus& contact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s, 
+    SplitKKTResidual& kkt_residual) const {
+  return staticcostfunctionimpl::ComponentLoop<0, sizeof...(Components)>
+      ::linearizeStageCost(components_, robot, contact_status, data, grid_info, 
+                           s, kkt_residual);
+}
+
+
+template <typename... Components>
+inline double StaticCostFunction<Components...>::quadratizeStageCost(
+    Robot& robot, const ContactStatus& contact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s, 
+    SplitKKTResidual& kkt_residual, SplitKKTMatrix& kkt_matrix) const {
+  return staticcostfunctionimpl::ComponentLoop<0, sizeof...(Components)>
+      ::quadratizeStageCost(components_, robot, contact_status, data, grid_info, 
+                            s, kkt_residual, kkt_matrix);
+}
+
+
+template <typename... Components>
+inline double StaticCostFunction<Components...>::evalTerminalCost(
+    Robot& robot, CostFunctionData& data, const GridInfo& grid_info, 
+    const SplitSolution& s) const {
+  return staticcostfunctionimpl::ComponentLoop<0, sizeof...(Components)>
+      ::evalTerminalCost(components_, robot, data, grid_info, s);
+}
+
+
+template <typename... Components>
+inline void StaticCostFunction<Components...>::evalTerminalCostDerivatives(
+    Robot& robot, CostFunctionData& data, const GridInfo& grid_info, 
+    const SplitSolution& s, SplitKKTResidual& kkt_residual) const {
+  staticcostfunctionimpl::ComponentLoop<0, sizeof...(Components)>
+      ::linearizeTerminalCost(components_, robot, data, grid_info, s, 
+                              kkt_residual);
+}
+
+
+template <typename... Components>
+inline void StaticCostFunction<Components...>::evalTerminalCostHessian(
+    Robot& robot, CostFunctionData& data, const GridInfo& grid_info, 
+    const SplitSolution& s, SplitKKTMatrix& kkt_matrix) const {
+  auto& kkt_residual = staticcostfunctionimpl::derivativeBuffer(robot, 0, data);
+  staticcostfunctionimpl::ComponentLoop<0, sizeof...(Components)>
+      ::quadratizeTerminalCost(components_, robot, data, grid_info, s, 
+                               kkt_residual, kkt_matrix);
+}
+
+
+template <typename... Components>
+inline double StaticCostFunction<Components...>::linearizeTerminalCost(
+    Robot& robot, CostFunctionData& data, const GridInfo& grid_info, 
+    const SplitSolution& s, SplitKKTResidual& kkt_residual) const {
+  return staticcostfunctionimpl::ComponentLoop<0, sizeof...(Components)>
+      ::linearizeTerminalCost(components_, robot, data, grid_info, s, 
+                              kkt_residual);
+}
+
+
+template <typename... Components>
+inline double StaticCostFunction<Components...>::quadratizeTerminalCost(
+    Robot& robot, CostFunctionData& data, const GridInfo& grid_info, 
+    const SplitSolution& s, SplitKKTResidual& kkt_residual, 
+    SplitKKTMatrix& kkt_matrix) const {
+  return staticcostfunctionimpl::ComponentLoop<0, sizeof...(Components)>
+      ::quadratizeTerminalCost(components_, robot, data, grid_info, s, 
+                               kkt_residual, kkt_matrix);
+}
+
+
+template <typename... Components>
+inline double StaticCostFunction<Components...>::evalImpactCost(
+    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s) const {
+  return staticcostfunctionimpl::ComponentLoop<0, sizeof...(Components)>
+      ::evalImpactCost(components_, robot, impact_status, data, grid_info, s);
+}
+
+
+template <typename... Components>
+inline void StaticCostFunction<Components...>::evalImpactCostDerivatives(
+    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s, 
+    SplitKKTResidual& kkt_residual) const {
+  staticcostfunctionimpl::ComponentLoop<0, sizeof...(Components)>
+      ::linearizeImpactCost(components_, robot, impact_status, data, grid_info, 
+                            s, kkt_residual);
+}
+
+
+template <typename... Components>
+inline void StaticCostFunction<Components...>::evalImpactCostHessian(
+    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s, 
+    SplitKKTMatrix& kkt_matrix) const {
+  auto& kkt_residual = staticcostfunctionimpl::derivativeBuffer(
+      robot, impact_status.dimf(), data);
+  staticcostfunctionimpl::ComponentLoop<0, sizeof...(Components)>
+      ::quadratizeImpactCost(components_, robot, impact_status, data, grid_info, 
+                             s, kkt_residual, kkt_matrix);
+}
+
+
+template <typename... Components>
+inline double StaticCostFunction<Components...>::linearizeImpactCost(
+    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s, 
+    SplitKKTResidual& kkt_residual) const {
+  return staticcostfunctionimpl::ComponentLoop<0, sizeof...(Components)>
+      ::linearizeImpactCost(components_, robot, impact_status, data, grid_info, 
+                            s, kkt_residual);
+}
+
+
+template <typename... Components>
+inline double StaticCostFunction<Components...>::quadratizeImpactCost(
+    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
+    const GridInfo& grid_info, const SplitSolution& s, 
+    SplitKKTResidual& kkt_residual, SplitKKTMatrix& kkt_matrix) const {
+  return staticcostfunctionimpl::ComponentLoop<0, sizeof...(Components)>
+      ::quadratizeImpactCost(components_, robot, impact_status, data, grid_info, 
+                             s, kkt_residual, kkt_matrix);
+}
+
+} // namespace robotoc
+
+#endif // ROBOTOC_STATIC_COST_FUNCTION_HXX_ 
\ No newline at end of file
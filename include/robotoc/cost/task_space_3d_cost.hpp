@@ -225,4 +225,6 @@ private:
 } // namespace robotoc
 
 
+#include "robotoc/cost/task_space_3d_cost.hxx"
+
 #endif // ROBOTOC_TASK_SPACE_3D_COST_HPP_
\ No newline at end of file
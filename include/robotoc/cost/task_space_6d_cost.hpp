@@ -268,4 +268,6 @@ private:
 } // namespace robotoc
 
 
+#include "robotoc/cost/task_space_6d_cost.hxx"
+
 #endif // ROBOTOC_TASK_SPACE_6D_COST_HPP_
\ No newline at end of file
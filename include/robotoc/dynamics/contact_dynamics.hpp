@@ -67,14 +67,15 @@ void expandContactDynamicsPrimal(const ContactDynamicsData& data, SplitDirection
 ///
 /// @brief Expands the dual variables, i.e., computes the Newton direction 
 /// of the condensed dual variables (Lagrange multipliers) of this stage.
+/// @param[in] robot Robot model. 
 /// @param[in] dt Time step of this time stage. 
 /// @param[in] dts Direction of the switching time regarding of this time stage. 
 /// @param[in, out] data Data structure for the contact dynamics.
 /// @param[in] d_next Split direction of the next stage.
 /// @param[in, out] d Split direction of this time stage.
 /// 
-void expandContactDynamicsDual(const double dt, const double dts, 
-                               ContactDynamicsData& data,
+void expandContactDynamicsDual(const Robot& robot, const double dt, 
+                               const double dts, ContactDynamicsData& data,
                                const SplitDirection& d_next, SplitDirection& d);
 
 } // namespace robotoc 
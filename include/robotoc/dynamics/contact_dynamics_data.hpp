@@ -69,6 +69,25 @@ public:
 
   bool hasFloatingBase() const;
 
+  ///
+  /// @brief Caches the factorization of the contact dynamics matrix computed 
+  /// by the robot in this data by exchanging the buffers (O(1)). Calling this 
+  /// twice hands the factorization back to the robot.
+  /// @param[in, out] robot Robot model. 
+  ///
+  void swapMJtJFactorization(Robot& robot);
+
+  ///
+  /// @brief Applies the inverse of the contact dynamics matrix 
+  /// [[M J^T], [J O]] to X in place using the cached factorization.
+  /// @param[in] robot Robot model. 
+  /// @param[in, out] X Right-hand side overwritten by the solution. Row size 
+  /// must be ContactDynamicsData::dimvf().
+  ///
+  template <typename MatrixType>
+  void solveMJtJ(const Robot& robot, 
+                 const Eigen::MatrixBase<MatrixType>& X) const;
+
   Eigen::MatrixXd Qxu_passive;
 
   Eigen::MatrixXd Quu_passive_topRight;
@@ -103,9 +122,14 @@ public:
 
   const Eigen::Block<const Eigen::MatrixXd> dCdv() const;
 
-  Eigen::Block<Eigen::MatrixXd> MJtJinv();
+  ///
+  /// @brief The leading Robot::dimv() columns of the inverse of the contact 
+  /// dynamics matrix, i.e., [[M J^T], [J O]]^{-1} [I; O]. Computed by the 
+  /// solves against the cached factorization. 
+  ///
+  Eigen::Block<Eigen::MatrixXd> MJtJinv_IO();
 
-  const Eigen::Block<const Eigen::MatrixXd> MJtJinv() const;
+  const Eigen::Block<const Eigen::MatrixXd> MJtJinv_IO() const;
 
   Eigen::Block<Eigen::MatrixXd> MJtJinv_dIDCdqv();
 
@@ -206,10 +230,12 @@ public:
   }
 
 private:
-  Eigen::MatrixXd dCda_full_, dIDCdqv_full_, MJtJinv_full_, 
+  Eigen::MatrixXd dCda_full_, dIDCdqv_full_, MJtJinv_IO_full_, 
                   MJtJinv_dIDCdqv_full_, Qafqv_full_, 
                   Qafu_full_full_, Phia_full_;
   Eigen::VectorXd IDC_full_, MJtJinv_IDC_full_, laf_full_, haf_full_;
+  Eigen::MatrixXd M_U_, sDUiJt_, JMinvJt_L_;
+  Eigen::VectorXd M_D_;
   int dimv_, dimu_, dimf_, dimvf_, dims_, dim_passive_;
   bool has_floating_base_;
 
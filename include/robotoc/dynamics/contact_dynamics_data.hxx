@@ -54,6 +54,19 @@ inline bool ContactDynamicsData::hasFloatingBase() const {
 }
 
 
+inline void ContactDynamicsData::swapMJtJFactorization(Robot& robot) {
+  robot.swapMJtJFactorization(M_U_, M_D_, sDUiJt_, JMinvJt_L_);
+}
+
+
+template <typename MatrixType>
+inline void ContactDynamicsData::solveMJtJ(
+    const Robot& robot, const Eigen::MatrixBase<MatrixType>& X) const {
+  assert(X.rows() == dimvf_);
+  robot.solveMJtJ(M_U_, M_D_, sDUiJt_, JMinvJt_L_, X);
+}
+
+
 inline Eigen::Block<Eigen::MatrixXd> ContactDynamicsData::dCda() {
   return dCda_full_.topLeftCorner(dimf_, dimv_);
 }
@@ -120,14 +133,14 @@ ContactDynamicsData::dCdv() const {
 }
 
 
-inline Eigen::Block<Eigen::MatrixXd> ContactDynamicsData::MJtJinv() {
-  return MJtJinv_full_.topLeftCorner(dimvf_, dimvf_);
+inline Eigen::Block<Eigen::MatrixXd> ContactDynamicsData::MJtJinv_IO() {
+  return MJtJinv_IO_full_.topLeftCorner(dimvf_, dimv_);
 }
 
 
 inline const Eigen::Block<const Eigen::MatrixXd> 
-ContactDynamicsData::MJtJinv() const {
-  return MJtJinv_full_.topLeftCorner(dimvf_, dimvf_);
+ContactDynamicsData::MJtJinv_IO() const {
+  return MJtJinv_IO_full_.topLeftCorner(dimvf_, dimv_);
 }
 
 
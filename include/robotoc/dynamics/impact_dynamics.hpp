@@ -63,11 +63,12 @@ void expandImpactDynamicsPrimal(const ContactDynamicsData& data,
 /// @brief Expands the dual variables, i.e., computes the Newton direction 
 /// of the condensed dual variables (Lagrange multipliers) of this impact 
 /// stage.
+/// @param[in] robot Robot model. 
 /// @param[in, out] data Data structure for the contact dynamics.
 /// @param[in] d_next Split direction of the next stage.
 /// @param[in, out] d Split direction of this impact stage.
 /// 
-void expandImpactDynamicsDual(ContactDynamicsData& data, 
+void expandImpactDynamicsDual(const Robot& robot, ContactDynamicsData& data, 
                               const SplitDirection& d_next, SplitDirection& d);
 
 } // namespace robotoc 
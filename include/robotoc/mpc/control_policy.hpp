@@ -59,6 +59,20 @@ struct ControlPolicy {
   ///
   void set(const OCPSolver& ocp_solver, const double t);
 
+  ///
+  /// @brief Finds the grid interval over which the policy is interpolated at 
+  /// the inquired time by the binary search. This is shared with 
+  /// StateFeedbackPolicy. 
+  /// @param[in] time_discretization Time discretization. 
+  /// @param[in] t Inquired time of the control. 
+  /// @return Index i such that the policy is interpolated between the grids 
+  /// i-1 and i. 0 if t is before the initial grid and 
+  /// TimeDiscretization::N()-1 if t is after the grid N-2, where the policy 
+  /// is held at those grids.
+  ///
+  static int findInterval(const TimeDiscretization& time_discretization, 
+                          const double t);
+
   ///
   /// @brief Inquired time of the control. 
   ///
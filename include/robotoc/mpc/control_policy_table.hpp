@@ -0,0 +1,95 @@
+#ifndef ROBOTOC_CONTROL_POLICY_TABLE_HPP_
+#define ROBOTOC_CONTROL_POLICY_TABLE_HPP_
+
+#include <vector>
+
+#include "Eigen/Core"
+
+#include "robotoc/solver/ocp_solver.hpp"
+#include "robotoc/mpc/control_policy.hpp"
+
+
+namespace robotoc {
+
+///
+/// @class ControlPolicyTable
+/// @brief Table of the control policy precompiled from the MPC solution. 
+/// The table is built once after each solve and gives the same control 
+/// policy as ControlPolicy::set() without scanning the time discretization 
+/// and without dynamic memory allocation. The interval lookup is amortized 
+/// O(1) for the monotonically increasing inquired times.
+///
+class ControlPolicyTable {
+public:
+  ///
+  /// @brief Constructs the table from the OCP solver. 
+  /// @param[in] ocp_solver OCP solver. 
+  ///
+  ControlPolicyTable(const OCPSolver& ocp_solver);
+
+  ///
+  /// @brief Default constructor. 
+  ///
+  ControlPolicyTable();
+
+  ///
+  /// @brief Default destructor. 
+  ///
+  ~ControlPolicyTable() = default;
+
+  ///
+  /// @brief Default copy constructor. 
+  ///
+  ControlPolicyTable(const ControlPolicyTable&) = default;
+
+  ///
+  /// @brief Default copy assign operator. 
+  ///
+  ControlPolicyTable& operator=(const ControlPolicyTable&) = default;
+
+  ///
+  /// @brief Default move constructor. 
+  ///
+  ControlPolicyTable(ControlPolicyTable&&) noexcept = default;
+
+  ///
+  /// @brief Default move assign operator. 
+  ///
+  ControlPolicyTable& operator=(ControlPolicyTable&&) noexcept = default;
+
+  ///
+  /// @brief Builds the table from the current solution of the OCP solver. 
+  /// The internal memory is reallocated only if the table grows.
+  /// @param[in] ocp_solver OCP solver. 
+  ///
+  void update(const OCPSolver& ocp_solver);
+
+  ///
+  /// @brief Evaluates the control policy at the inquired time. 
+  /// @param[in] t Inquired time of the control. 
+  /// @return const reference to the control policy at the inquired time. 
+  /// This is overwritten at the next call of this function.
+  ///
+  const ControlPolicy& get(const double t);
+
+  ///
+  /// @brief Returns the number of the grids stored in the table. 
+  /// @return The number of the grids.
+  ///
+  int size() const { return size_; }
+
+private:
+  std::vector<double> t_;
+  Eigen::MatrixXd tauJ_, qJ_, dqJ_, Kp_, Kd_;
+  ControlPolicy policy_;
+  int dimu_, size_, num_knots_, interval_;
+
+  void setPolicy(const int i);
+
+  void interpolatePolicy(const int i, const double alpha);
+
+};
+
+} // namespace robotoc 
+
+#endif // ROBOTOC_CONTROL_POLICY_TABLE_HPP_
\ No newline at end of file
@@ -0,0 +1,104 @@
+#ifndef ROBOTOC_GAIT_TABLE_HPP_
+#define ROBOTOC_GAIT_TABLE_HPP_
+
+#include <vector>
+#include <iostream>
+
+
+namespace robotoc {
+
+///
+/// @class GaitTable
+/// @brief Table of a periodic gait, i.e., the sequence of the contact phases
+/// that is repeated cyclically. Each phase is defined by the set of the 
+/// active contacts and its duration. 
+///
+class GaitTable {
+public:
+  ///
+  /// @brief Constructor. 
+  /// @param[in] active_contacts Indices of the active contacts of each phase.
+  /// The sets of the consecutive phases (including the last and first phases
+  /// if there are more than one phases) must be different. 
+  /// @param[in] durations Durations of the phases. Each element must be 
+  /// positive. Size must be the same as active_contacts.
+  ///
+  GaitTable(const std::vector<std::vector<int>>& active_contacts, 
+            const std::vector<double>& durations);
+
+  ///
+  /// @brief Default constructor. 
+  ///
+  GaitTable();
+
+  ///
+  /// @brief Default destructor. 
+  ///
+  ~GaitTable() = default;
+
+  ///
+  /// @brief Default copy constructor. 
+  ///
+  GaitTable(const GaitTable&) = default;
+
+  ///
+  /// @brief Default copy assign operator. 
+  ///
+  GaitTable& operator=(const GaitTable&) = default;
+
+  ///
+  /// @brief Default move constructor. 
+  ///
+  GaitTable(GaitTable&&) noexcept = default;
+
+  ///
+  /// @brief Default move assign operator. 
+  ///
+  GaitTable& operator=(GaitTable&&) noexcept = default;
+
+  ///
+  /// @brief Returns the number of the phases in a period. 
+  /// @return The number of the phases.
+  ///
+  int numPhases() const { return durations_.size(); }
+
+  ///
+  /// @brief Returns the indices of the active contacts of a phase. 
+  /// @param[in] phase Index of the phase of interest.
+  /// @return const reference to the indices of the active contacts.
+  ///
+  const std::vector<int>& activeContacts(const int phase) const;
+
+  ///
+  /// @brief Returns the duration of a phase. 
+  /// @param[in] phase Index of the phase of interest.
+  /// @return The duration of the phase.
+  ///
+  double duration(const int phase) const;
+
+  ///
+  /// @brief Returns the period of the gait, i.e., the sum of the durations. 
+  /// @return The period.
+  ///
+  double period() const { return period_; }
+
+  ///
+  /// @brief Returns the minimum duration of the phases. 
+  /// @return The minimum duration.
+  ///
+  double minDuration() const { return min_duration_; }
+
+  void disp(std::ostream& os) const;
+
+  friend std::ostream& operator<<(std::ostream& os, const GaitTable& gait_table);
+
+private:
+  std::vector<std::vector<int>> active_contacts_;
+  std::vector<double> durations_;
+  double period_, min_duration_;
+
+};
+
+} // namespace robotoc 
+
+#endif // ROBOTOC_GAIT_TABLE_HPP_
\ No newline at end of file
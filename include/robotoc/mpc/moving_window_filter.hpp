@@ -4,14 +4,19 @@
 #include <stdexcept>
 #include <iostream>
 #include <cassert>
+#include <cmath>
 
-#include "robotoc/utils/aligned_deque.hpp"
+#include "Eigen/Core"
+
+#include "robotoc/utils/ring_buffer.hpp"
 
 namespace robotoc {
 
 ///
 /// @class MovingWindowFilter
-/// @brief Moving window filter for foot step planning. 
+/// @brief Moving window filter for foot step planning. The average is 
+/// computed from the running sum of the samples, which is recomputed 
+/// periodically to avoid the accumulation of the rounding errors. 
 ///
 template <int dim>
 class MovingWindowFilter {
@@ -31,6 +36,8 @@ public:
       last_sampling_time_(0.0),
       time_(),
       data_(),
+      num_updates_(0),
+      sum_(Vector::Zero()),
       average_(Vector::Zero()) {
     if (time_length <= 0.0) {
       throw std::out_of_range("[MovingWindowFilter] invalid argument: 'time_length' must be positive!");
@@ -38,6 +45,7 @@ public:
     if (min_sampling_period < 0) {
       throw std::out_of_range("[MovingWindowFilter] invalid argument: 'min_sampling_period' must be non-negative!");
     }
+    reserve(time_length, min_sampling_period);
   }
 
   ///
@@ -49,6 +57,8 @@ public:
       last_sampling_time_(0.0),
       time_(),
       data_(),
+      num_updates_(0),
+      sum_(Vector::Zero()),
       average_(Vector::Zero()) {
   }
 
@@ -93,6 +103,7 @@ public:
     }
     time_length_ = time_length;
     min_sampling_period_ = min_sampling_period;
+    reserve(time_length, min_sampling_period);
   }
 
   ///
@@ -102,6 +113,8 @@ public:
     last_sampling_time_ = 0.0;
     time_.clear();
     data_.clear();
+    num_updates_ = 0;
+    sum_.setZero();
     average_.setZero();
   }
 
@@ -114,6 +127,8 @@ public:
     if (time_.empty()) {
       time_.push_back(t);
       data_.push_back(data);
+      num_updates_ = 0;
+      sum_ = data;
       average_ = data;
       last_sampling_time_ = t;
     }
@@ -121,15 +136,23 @@ public:
       if (t - last_sampling_time_ >= min_sampling_period_) {
         time_.push_back(t);
         data_.push_back(data);
+        sum_.noalias() += data;
         while (t - time_.front() > time_length_) {
+          sum_.noalias() -= data_.front();
           time_.pop_front();
           data_.pop_front();
         }
-        average_.setZero();
-        for (const auto& e : data_) { 
-          average_.noalias() += e;
+        // Recomputes the sum once per the capacity of the buffer, i.e., in 
+        // amortized O(1).
+        ++num_updates_;
+        if (num_updates_ >= static_cast<int>(data_.capacity())) {
+          sum_.setZero();
+          for (const auto& e : data_) { 
+            sum_.noalias() += e;
+          }
+          num_updates_ = 0;
         }
-        average_.array() /= data_.size();
+        average_ = sum_ / data_.size();
         last_sampling_time_ = t;
       }
     }
@@ -153,9 +176,22 @@ public:
 
 private:
   double time_length_, min_sampling_period_, last_sampling_time_;
-  std::deque<double> time_;
-  aligned_deque<Vector> data_;
-  Vector average_;
+  RingBuffer<double> time_;
+  RingBuffer<Vector> data_;
+  int num_updates_;
+  Vector sum_, average_;
+
+  void reserve(const double time_length, const double min_sampling_period) {
+    // The buffer grows if the samples exceed this capacity, e.g., if 
+    // min_sampling_period is zero.
+    constexpr int default_capacity = 16;
+    int capacity = default_capacity;
+    if (min_sampling_period > 0.0) {
+      capacity = static_cast<int>(std::ceil(time_length/min_sampling_period)) + 2;
+    }
+    time_.reserve(capacity);
+    data_.reserve(capacity);
+  }
 
 };
 
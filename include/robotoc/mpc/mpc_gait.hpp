@@ -0,0 +1,309 @@
+#ifndef ROBOTOC_MPC_GAIT_HPP_
+#define ROBOTOC_MPC_GAIT_HPP_
+
+#include <vector>
+#include <memory>
+
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/ocp/ocp.hpp"
+#include "robotoc/solver/ocp_solver.hpp"
+#include "robotoc/planner/contact_sequence.hpp"
+#include "robotoc/cost/cost_function.hpp"
+#include "robotoc/constraints/constraints.hpp"
+#include "robotoc/solver/solver_options.hpp"
+#include "robotoc/mpc/contact_planner_base.hpp"
+#include "robotoc/mpc/gait_table.hpp"
+#include "robotoc/cost/configuration_space_cost.hpp"
+#include "robotoc/cost/task_space_3d_cost.hpp"
+#include "robotoc/cost/com_cost.hpp"
+#include "robotoc/mpc/mpc_gait_swing_foot_ref.hpp"
+#include "robotoc/mpc/mpc_gait_com_ref.hpp"
+#include "robotoc/mpc/mpc_gait_configuration_ref.hpp"
+#include "robotoc/constraints/joint_position_lower_limit.hpp"
+#include "robotoc/constraints/joint_position_upper_limit.hpp"
+#include "robotoc/constraints/joint_velocity_lower_limit.hpp"
+#include "robotoc/constraints/joint_velocity_upper_limit.hpp"
+#include "robotoc/constraints/joint_torques_lower_limit.hpp"
+#include "robotoc/constraints/joint_torques_upper_limit.hpp"
+#include "robotoc/constraints/friction_cone.hpp"
+#include "robotoc/mpc/control_policy.hpp"
+
+
+namespace robotoc {
+
+///
+/// @class MPCGait
+/// @brief MPC solver for the periodic gaits of the robots with point contacts
+/// defined by gait tables. The gait can be switched online while the single 
+/// OCP solver and its solution are kept as the warm-start. 
+///
+class MPCGait {
+public:
+  ///
+  /// @brief Construct MPC solver.
+  /// @param[in] robot Robot model with point contacts. 
+  /// @param[in] T Length of the horizon. 
+  /// @param[in] N Number of the discretization grids of the horizon. 
+  /// @param[in] max_num_discrete_events Maximum number of the discrete events
+  /// on the horizon, used to preallocate the OCP solver. For a gait table, 
+  /// this is std::ceil(T/GaitTable::minDuration())+1. If a gait needs more,
+  /// the OCP solver grows when the gait is set. Must be non-negative.
+  ///
+  MPCGait(const Robot& robot, const double T, const int N, 
+          const int max_num_discrete_events);
+
+  ///
+  /// @brief Default constructor. 
+  ///
+  MPCGait();
+
+  ///
+  /// @brief Destructor. 
+  ///
+  ~MPCGait();
+
+  ///
+  /// @brief Default copy constructor. 
+  ///
+  MPCGait(const MPCGait&) = default;
+
+  ///
+  /// @brief Default copy assign operator. 
+  ///
+  MPCGait& operator=(const MPCGait&) = default;
+
+  ///
+  /// @brief Default move constructor. 
+  ///
+  MPCGait(MPCGait&&) noexcept = default;
+
+  ///
+  /// @brief Default move assign operator. 
+  ///
+  MPCGait& operator=(MPCGait&&) noexcept = default;
+
+  ///
+  /// @brief Sets the gait. The robot stands on all the contacts until the 
+  /// gait starts.
+  /// @param[in] foot_step_planner Foot step planner of the gait. 
+  /// @param[in] gait_table Gait table. 
+  /// @param[in] swing_height Swing height of the gait. 
+  /// @param[in] gait_start_time Start time of the gait. 
+  ///
+  void setGait(const std::shared_ptr<ContactPlannerBase>& foot_step_planner,
+               const GaitTable& gait_table, const double swing_height, 
+               const double gait_start_time);
+
+  ///
+  /// @brief Initializes the optimal control problem solover. 
+  /// @param[in] t Initial time of the horizon. 
+  /// @param[in] q Initial configuration. Size must be Robot::dimq().
+  /// @param[in] v Initial velocity. Size must be Robot::dimv().
+  /// @param[in] solver_options Solver options for the initialization. 
+  /// @remark The linear and angular velocities of the floating base are assumed
+  /// to be expressed in the body local coordinate.
+  ///
+  void init(const double t, const Eigen::VectorXd& q, const Eigen::VectorXd& v, 
+            const SolverOptions& solver_options);
+
+  ///
+  /// @brief Switches the gait online. The current contact phase is kept and 
+  /// the new gait starts at its end. The contact phases of the new gait that
+  /// have the same active contacts as the preceding phase are merged into it.
+  /// The solution of the OCP solver is used as the warm-start of the next 
+  /// updateSolution().
+  /// @param[in] foot_step_planner Foot step planner of the new gait. 
+  /// @param[in] gait_table Gait table of the new gait. 
+  /// @param[in] swing_height Swing height of the new gait. 
+  /// @param[in] t Current time. 
+  /// @param[in] q Current configuration. Size must be Robot::dimq().
+  ///
+  void switchGait(const std::shared_ptr<ContactPlannerBase>& foot_step_planner,
+                  const GaitTable& gait_table, const double swing_height, 
+                  const double t, const Eigen::VectorXd& q);
+
+  ///
+  /// @brief Resets the optimal control problem solover via the solution 
+  /// computed by init(). 
+  ///
+  void reset();
+
+  ///
+  /// @brief Resets the optimal control problem solover via the solution 
+  /// computed by init(), q, and v.
+  ///
+  void reset(const Eigen::VectorXd& q, const Eigen::VectorXd& v);
+
+  ///
+  /// @brief Sets the solver options. 
+  /// @param[in] solver_options Solver options.  
+  ///
+  void setSolverOptions(const SolverOptions& solver_options);
+
+  ///
+  /// @brief Updates the solution by iterationg the Newton-type method.
+  /// @param[in] t Initial time of the horizon. 
+  /// @param[in] dt Sampling time of MPC. Must be positive.
+  /// @param[in] q Configuration. Size must be Robot::dimq().
+  /// @param[in] v Velocity. Size must be Robot::dimv().
+  /// @remark The linear and angular velocities of the floating base are assumed
+  /// to be expressed in the body local coordinate.
+  ///
+  void updateSolution(const double t, const double dt, const Eigen::VectorXd& q, 
+                      const Eigen::VectorXd& v);
+
+  ///
+  /// @brief Get the initial control input.
+  /// @return Const reference to the control input.
+  ///
+  const Eigen::VectorXd& getInitialControlInput() const;
+
+  ///
+  /// @brief Get the solution. 
+  /// @return const reference to the solution.
+  ///
+  const Solution& getSolution() const;
+
+  ///
+  /// @brief Gets of the local LQR policies over the horizon. 
+  /// @return const reference to the local LQR policies.
+  ///
+  const aligned_vector<LQRPolicy>& getLQRPolicy() const;
+
+  ///
+  /// @brief Gets the control policy at the specified time.  
+  /// @param[in] t The specified time.  
+  /// @return Control poclity at the specified time.
+  ///
+  ControlPolicy getControlPolicy(const double t) const { 
+    return ControlPolicy(ocp_solver_, t); 
+  }
+
+  ///
+  /// @brief Computes the KKT residual of the optimal control problem. 
+  /// @param[in] t Initial time of the horizon. 
+  /// @param[in] q Initial configuration. Size must be Robot::dimq().
+  /// @param[in] v Initial velocity. Size must be Robot::dimv().
+  /// @remark The linear and angular velocities of the floating base are assumed
+  /// to be expressed in the body local coordinate.
+  ///
+  double KKTError(const double t, const Eigen::VectorXd& q, 
+                  const Eigen::VectorXd& v);
+
+  ///
+  /// @brief Returns the l2-norm of the KKT residuals.
+  /// MPCGait::updateSolution() must be computed.  
+  /// @return The l2-norm of the KKT residual.
+  ///
+  double KKTError() const;
+
+  ///
+  /// @brief Gets the cost function handle.  
+  /// @return Shared ptr to the cost function.
+  ///
+  std::shared_ptr<CostFunction> getCostHandle();
+
+  ///
+  /// @brief Gets the configuration space cost handle.  
+  /// @return Shared ptr to the configuration space cost.
+  ///
+  std::shared_ptr<ConfigurationSpaceCost> getConfigCostHandle();
+
+  ///
+  /// @brief Gets the base rotation cost handle.  
+  /// @return Shared ptr to the base rotation cost.
+  ///
+  std::shared_ptr<ConfigurationSpaceCost> getBaseRotationCostHandle();
+
+  ///
+  /// @brief Gets the swing foot task space costs handle. The order is the 
+  /// same as the contact frames of the robot.
+  /// @return Shared ptrs to the task space costs.
+  ///
+  std::vector<std::shared_ptr<TaskSpace3DCost>> getSwingFootCostHandle();
+
+  ///
+  /// @brief Gets the com cost handle.  
+  /// @return Shared ptr to the com cost.
+  ///
+  std::shared_ptr<CoMCost> getCoMCostHandle();
+
+  ///
+  /// @brief Gets the constraints handle.  
+  /// @return Shared ptr to the constraints.
+  ///
+  std::shared_ptr<Constraints> getConstraintsHandle();
+
+  ///
+  /// @brief Gets the friction cone constraints handle.  
+  /// @return Shared ptr to the friction cone constraints.
+  ///
+  std::shared_ptr<FrictionCone> getFrictionConeHandle();
+
+  ///
+  /// @brief Gets the const handle of the MPC solver.  
+  /// @return Const reference to the MPC solver.
+  ///
+  const OCPSolver& getSolver() const { return ocp_solver_; }
+
+  ///
+  /// @brief Gets the const handle of the contact sequence.  
+  /// @return Const reference to the shared_ptr of the contact sequence.
+  ///
+  const std::shared_ptr<ContactSequence>& getContactSequence() const { 
+    return contact_sequence_; 
+  }
+
+  ///
+  /// @brief Gets the gait table of the current gait.  
+  /// @return Const reference to the gait table.
+  ///
+  const GaitTable& getGaitTable() const { return gait_table_; }
+
+  ///
+  /// @brief Sets a collection of the properties for robot model in this MPC. 
+  /// @param[in] properties A collection of the properties for the robot model.
+  ///
+  void setRobotProperties(const RobotProperties& properties);
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+private:
+  Robot robot_;
+  std::shared_ptr<ContactPlannerBase> foot_step_planner_;
+  std::shared_ptr<ContactSequence> contact_sequence_;
+  std::shared_ptr<CostFunction> cost_;
+  std::shared_ptr<Constraints> constraints_;
+  OCPSolver ocp_solver_;
+  GaitTable gait_table_;
+  std::vector<ContactStatus> cs_gait_;
+  ContactStatus cs_standing_;
+  robotoc::Solution s_;
+  std::vector<double> phase_times_;
+  double swing_height_, gait_start_time_, next_phase_time_, 
+         T_, dtm_, ts_last_, eps_;
+  int N_, predict_phase_;
+
+  std::shared_ptr<ConfigurationSpaceCost> config_cost_;
+  std::shared_ptr<ConfigurationSpaceCost> base_rot_cost_;
+  std::vector<std::shared_ptr<TaskSpace3DCost>> swing_foot_cost_;
+  std::shared_ptr<CoMCost> com_cost_;
+  std::shared_ptr<MPCGaitConfigurationRef> base_rot_ref_;
+  std::vector<std::shared_ptr<MPCGaitSwingFootRef>> swing_foot_ref_;
+  std::shared_ptr<MPCGaitCoMRef> com_ref_;
+  std::shared_ptr<FrictionCone> friction_cone_;
+
+  void setGaitTable(const GaitTable& gait_table, const double swing_height);
+
+  bool addStep(const double t);
+
+  void resetContactPlacements(const double t, const Eigen::VectorXd& q, 
+                              const Eigen::VectorXd& v);
+
+};
+
+} // namespace robotoc 
+
+#endif // ROBOTOC_MPC_GAIT_HPP_
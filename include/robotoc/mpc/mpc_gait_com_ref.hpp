@@ -0,0 +1,62 @@
+#ifndef ROBOTOC_MPC_GAIT_COM_REF_HPP_
+#define ROBOTOC_MPC_GAIT_COM_REF_HPP_
+
+#include <vector>
+#include <memory>
+
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/cost/com_ref_base.hpp"
+#include "robotoc/planner/contact_sequence.hpp"
+#include "robotoc/mpc/contact_planner_base.hpp"
+
+
+namespace robotoc {
+
+///
+/// @class MPCGaitCoMRef
+/// @brief Reference positions of the center of mass of a gait given by the 
+/// contact sequence. The reference is interpolated over each contact phase 
+/// where some contacts are inactive. 
+///
+class MPCGaitCoMRef final : public CoMRefBase {
+public:
+  ///
+  /// @brief Constructor. 
+  ///
+  MPCGaitCoMRef();
+
+  ///
+  /// @brief Destructor. 
+  ///
+  ~MPCGaitCoMRef();
+
+  ///
+  /// @brief Sets the reference positions of CoM from the contact sequence and
+  /// the CoM positions of the foot step planner.
+  /// @param[in] contact_sequence Contact sequence.
+  /// @param[in] foot_step_planner Foot step planner.
+  /// @param[in] phase_times Start times of the contact phases and the end 
+  /// time of the last contact phase. Size must be 
+  /// ContactSequence::numContactPhases() + 1.
+  ///
+  void setCoMRef(const std::shared_ptr<ContactSequence>& contact_sequence,
+                 const std::shared_ptr<ContactPlannerBase>& foot_step_planner,
+                 const std::vector<double>& phase_times);
+
+  void updateRef(const GridInfo& grid_info, 
+                 Eigen::VectorXd& com_ref) const override;
+
+  bool isActive(const GridInfo& grid_info) const override;
+
+private:
+  std::vector<Eigen::Vector3d> com_;
+  std::vector<double> phase_times_;
+  std::vector<bool> has_inactive_contacts_;
+
+};
+
+} // namespace robotoc
+
+#endif // ROBOTOC_MPC_GAIT_COM_REF_HPP_
@@ -0,0 +1,75 @@
+#ifndef ROBOTOC_MPC_GAIT_CONFIGURATION_REF_HPP_
+#define ROBOTOC_MPC_GAIT_CONFIGURATION_REF_HPP_
+
+#include <vector>
+#include <memory>
+
+#include "Eigen/Core"
+#include "Eigen/Geometry"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/utils/aligned_vector.hpp"
+#include "robotoc/cost/configuration_space_ref_base.hpp"
+#include "robotoc/planner/contact_sequence.hpp"
+#include "robotoc/mpc/contact_planner_base.hpp"
+
+
+namespace robotoc {
+
+///
+/// @class MPCGaitConfigurationRef
+/// @brief Reference configuration of a gait given by the contact sequence. 
+/// The base orientation is interpolated over each contact phase where some 
+/// contacts are inactive. 
+///
+class MPCGaitConfigurationRef final : public ConfigurationSpaceRefBase {
+public:
+  ///
+  /// @brief Constructor. 
+  /// @param[in] q Reference configuration. The base orientation is 
+  /// overwritten by the reference of the foot step planner.
+  ///
+  MPCGaitConfigurationRef(const Eigen::VectorXd& q);
+
+  ///
+  /// @brief Destructor. 
+  ///
+  ~MPCGaitConfigurationRef();
+
+  ///
+  /// @brief Sets the reference configuration. 
+  /// @param[in] q Reference configuration.
+  ///
+  void setConfiguration(const Eigen::VectorXd& q);
+
+  ///
+  /// @brief Sets the reference base orientations from the contact sequence 
+  /// and the base orientations of the foot step planner.
+  /// @param[in] contact_sequence Contact sequence.
+  /// @param[in] foot_step_planner Foot step planner.
+  /// @param[in] phase_times Start times of the contact phases and the end 
+  /// time of the last contact phase. Size must be 
+  /// ContactSequence::numContactPhases() + 1.
+  ///
+  void setConfigurationRef(const std::shared_ptr<ContactSequence>& contact_sequence,
+                           const std::shared_ptr<ContactPlannerBase>& foot_step_planner,
+                           const std::vector<double>& phase_times);
+
+  void updateRef(const Robot& robot, const GridInfo& grid_info,
+                 Eigen::VectorXd& q_ref) const override;
+
+  bool isActive(const GridInfo& grid_info) const override;
+
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+private:
+  Eigen::VectorXd q_;
+  aligned_vector<Eigen::Quaterniond> quat_;
+  std::vector<double> phase_times_;
+  std::vector<bool> has_inactive_contacts_;
+
+};
+
+} // namespace robotoc
+
+#endif // ROBOTOC_MPC_GAIT_CONFIGURATION_REF_HPP_
@@ -0,0 +1,73 @@
+#ifndef ROBOTOC_MPC_GAIT_SWING_FOOT_REF_HPP_
+#define ROBOTOC_MPC_GAIT_SWING_FOOT_REF_HPP_
+
+#include <vector>
+#include <memory>
+
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/cost/task_space_3d_cost.hpp"
+#include "robotoc/planner/contact_sequence.hpp"
+#include "robotoc/mpc/contact_planner_base.hpp"
+
+
+namespace robotoc {
+
+///
+/// @class MPCGaitSwingFootRef
+/// @brief Reference of the foot position of a gait given by the contact 
+/// sequence. The foot is lifted at the beginning of the first phase where the
+/// contact is inactive and touches down at the end of the last one. 
+///
+class MPCGaitSwingFootRef final : public TaskSpace3DRefBase {
+public:
+  ///
+  /// @brief Constructor. 
+  /// @param[in] contact_index Contact index of the foot.
+  /// @param[in] swing_height The swing height of the gait. Must be 
+  /// non-negative.
+  ///
+  MPCGaitSwingFootRef(const int contact_index, const double swing_height);
+
+  ///
+  /// @brief Destructor. 
+  ///
+  ~MPCGaitSwingFootRef();
+
+  ///
+  /// @brief Sets the swing height. 
+  /// @param[in] swing_height The swing height of the gait. Must be 
+  /// non-negative.
+  ///
+  void setSwingHeight(const double swing_height);
+
+  ///
+  /// @brief Sets the reference positions of the foot from the contact 
+  /// sequence and the contact positions of the foot step planner.
+  /// @param[in] contact_sequence Contact sequence.
+  /// @param[in] foot_step_planner Foot step planner.
+  /// @param[in] phase_times Start times of the contact phases and the end 
+  /// time of the last contact phase. Size must be 
+  /// ContactSequence::numContactPhases() + 1.
+  ///
+  void setSwingFootRef(const std::shared_ptr<ContactSequence>& contact_sequence,
+                       const std::shared_ptr<ContactPlannerBase>& foot_step_planner,
+                       const std::vector<double>& phase_times);
+
+  void updateRef(const GridInfo& grid_info, Eigen::VectorXd& x3d_ref) const override;
+
+  bool isActive(const GridInfo& grid_info) const override;
+
+private:
+  int contact_index_;
+  std::vector<Eigen::Vector3d> lift_position_, touchdown_position_;
+  std::vector<double> lift_time_, touchdown_time_;
+  std::vector<bool> is_contact_active_;
+  double swing_height_;
+
+};
+
+} // namespace robotoc
+
+#endif // ROBOTOC_MPC_GAIT_SWING_FOOT_REF_HPP_
@@ -0,0 +1,52 @@
+#ifndef ROBOTOC_MPC_LOCOMOTION_SETUP_HPP_
+#define ROBOTOC_MPC_LOCOMOTION_SETUP_HPP_
+
+#include <memory>
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/cost/configuration_space_cost.hpp"
+#include "robotoc/cost/configuration_space_ref_base.hpp"
+#include "robotoc/constraints/constraints.hpp"
+#include "robotoc/constraints/friction_cone.hpp"
+
+
+namespace robotoc {
+namespace locomotion {
+
+///
+/// @brief Creates the configuration space cost of the locomotion MPCs, which 
+/// regularizes the joint positions, the velocity, the joint torques, and the 
+/// impact. The floating base configuration is not penalized.
+/// @param[in] robot Robot model with a floating base.
+/// @return Shared ptr to the configuration space cost.
+///
+std::shared_ptr<ConfigurationSpaceCost> CreateConfigurationCost(
+    const Robot& robot);
+
+///
+/// @brief Creates the cost on the rotation of the floating base of the 
+/// locomotion MPCs. 
+/// @param[in] robot Robot model with a floating base.
+/// @param[in] ref Reference configuration. Can be nullptr and set later.
+/// @param[in] weight Weight on the rotation. Must be non-negative. 
+/// Default is 1000.
+/// @return Shared ptr to the configuration space cost.
+///
+std::shared_ptr<ConfigurationSpaceCost> CreateBaseRotationCost(
+    const Robot& robot, const std::shared_ptr<ConfigurationSpaceRefBase>& ref, 
+    const double weight=1000);
+
+///
+/// @brief Adds the joint position, velocity, and torque limits and the 
+/// friction cone of the locomotion MPCs to the constraints. 
+/// @param[in] robot Robot model.
+/// @param[in, out] constraints Constraints. 
+/// @return Shared ptr to the added friction cone constraints.
+///
+std::shared_ptr<FrictionCone> AddJointLimitsAndFrictionCone(
+    const Robot& robot, const std::shared_ptr<Constraints>& constraints);
+
+} // namespace locomotion
+} // namespace robotoc 
+
+#endif // ROBOTOC_MPC_LOCOMOTION_SETUP_HPP_
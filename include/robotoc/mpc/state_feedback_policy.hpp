@@ -0,0 +1,132 @@
+#ifndef ROBOTOC_STATE_FEEDBACK_POLICY_HPP_
+#define ROBOTOC_STATE_FEEDBACK_POLICY_HPP_
+
+#include <iostream>
+
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/solver/ocp_solver.hpp"
+#include "robotoc/mpc/control_policy.hpp"
+
+
+namespace robotoc {
+
+///
+/// @class StateFeedbackPolicy
+/// @brief Full-state feedback policy constructed for the MPC solution. 
+/// Unlike ControlPolicy, the whole gain of the LQR policy including the 
+/// floating base part is applied to the state error, i.e., 
+/// u = u_ref + K (x - x_ref), where the configuration error is computed by 
+/// Robot::subtractConfiguration(). The robot model is passed at each call 
+/// rather than stored in the policy. 
+///
+struct StateFeedbackPolicy {
+  using MatrixXdRowMajor 
+      = Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+
+  ///
+  /// @brief Constructs the policy. 
+  /// @param[in] robot Robot model. 
+  ///
+  StateFeedbackPolicy(const Robot& robot);
+
+  ///
+  /// @brief Constructs the policy from the OCP solver. 
+  /// @param[in] robot Robot model. 
+  /// @param[in] ocp_solver OCP solver. 
+  /// @param[in] t Inquired time of the control. 
+  ///
+  StateFeedbackPolicy(const Robot& robot, const OCPSolver& ocp_solver, 
+                      const double t);
+
+  ///
+  /// @brief Default constructor. 
+  ///
+  StateFeedbackPolicy();
+
+  ///
+  /// @brief Default destructor. 
+  ///
+  ~StateFeedbackPolicy() = default;
+
+  ///
+  /// @brief Default copy constructor. 
+  ///
+  StateFeedbackPolicy(const StateFeedbackPolicy&) = default;
+
+  ///
+  /// @brief Default copy assign operator. 
+  ///
+  StateFeedbackPolicy& operator=(const StateFeedbackPolicy&) = default;
+
+  ///
+  /// @brief Default move constructor. 
+  ///
+  StateFeedbackPolicy(StateFeedbackPolicy&&) noexcept = default;
+
+  ///
+  /// @brief Default move assign operator. 
+  ///
+  StateFeedbackPolicy& operator=(StateFeedbackPolicy&&) noexcept = default;
+
+  ///
+  /// @brief Sets the policy from the OCP solver. The grid interval is found 
+  /// by ControlPolicy::findInterval(). 
+  /// @param[in] robot Robot model. 
+  /// @param[in] ocp_solver OCP solver. 
+  /// @param[in] t Inquired time of the control. 
+  ///
+  void set(const Robot& robot, const OCPSolver& ocp_solver, const double t);
+
+  ///
+  /// @brief Computes the control input by the full-state feedback. 
+  /// @param[in] robot Robot model. 
+  /// @param[in] q Estimated configuration. Size must be Robot::dimq().
+  /// @param[in] v Estimated velocity. Size must be Robot::dimv().
+  /// @param[out] u Control input. Size must be Robot::dimu().
+  /// @remark The linear and angular velocities of the floating base are assumed
+  /// to be expressed in the body local coordinate.
+  ///
+  void computeControlInput(const Robot& robot, const Eigen::VectorXd& q, 
+                           const Eigen::VectorXd& v, Eigen::VectorXd& u);
+
+  ///
+  /// @brief Inquired time of the control. 
+  ///
+  double t;
+
+  ///
+  /// @brief Feedforward control input. Size must be Robot::dimu().
+  ///
+  Eigen::VectorXd u; 
+
+  ///
+  /// @brief Reference configuration. Size must be Robot::dimq().
+  ///
+  Eigen::VectorXd q; 
+
+  ///
+  /// @brief Reference velocity. Size must be Robot::dimv().
+  ///
+  Eigen::VectorXd v; 
+
+  ///
+  /// @brief State feedback gain. Size must be 
+  /// Robot::dimu() x 2 * Robot::dimv().
+  ///
+  MatrixXdRowMajor K; 
+
+  void disp(std::ostream& os) const;
+
+  friend std::ostream& operator<<(std::ostream& os, 
+                                  const StateFeedbackPolicy& policy);
+
+private:
+  Eigen::VectorXd dx_;
+
+};
+
+} // namespace robotoc 
+
+#endif // ROBOTOC_STATE_FEEDBACK_POLICY_HPP_
\ No newline at end of file
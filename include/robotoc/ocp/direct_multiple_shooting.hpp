@@ -17,6 +17,7 @@
 #include "robotoc/ocp/ocp.hpp"
 #include "robotoc/ocp/grid_info.hpp"
 #include "robotoc/ocp/time_discretization.hpp"
+#include "robotoc/ocp/move_blocking.hpp"
 #include "robotoc/ocp/intermediate_stage.hpp"
 #include "robotoc/ocp/impact_stage.hpp"
 #include "robotoc/ocp/terminal_stage.hpp"
@@ -87,6 +88,19 @@ public:
                        const TimeDiscretization& time_discretization, 
                        const Solution& s);
 
+  ///
+  /// @brief Initializes the priaml-dual interior point method for inequality 
+  /// constraints only on the grids whose structure changed at the last 
+  /// discretization (see TimeDiscretization::isStructureChanged()). The slack 
+  /// and dual variables on the other grids are kept as a warm-start.
+  /// @param[in, out] robots aligned_vector of Robot for paralle computing.
+  /// @param[in] time_discretization Time discretization. 
+  /// @param[in] s Solution. 
+  ///
+  void warmStartConstraints(aligned_vector<Robot>& robots,
+                            const TimeDiscretization& time_discretization, 
+                            const Solution& s);
+
   ///
   /// @brief Checks whether the solution is feasible under inequality constraints.
   /// @param[in, out] robots aligned_vector of Robot for paralle computing.
@@ -127,6 +141,17 @@ public:
                const Solution& s, KKTMatrix& kkt_matrix, 
                KKTResidual& kkt_residual);
 
+  ///
+  /// @brief Corrects the KKT error computed in evalKKT() for the move 
+  /// blocking, i.e., replaces the squared norms of the partial derivatives 
+  /// of the Lagrangian with respect to the blocked control inputs with that 
+  /// of their sum over each block. 
+  /// @param[in] time_discretization Time discretization. 
+  /// @param[in] move_blocking Move blocking. 
+  ///
+  void correctKKTError(const TimeDiscretization& time_discretization,
+                       const MoveBlocking& move_blocking);
+
   ///
   /// @brief Computes the initial state direction. 
   /// @param[in] robot Robot model.
@@ -133,13 +133,15 @@ public:
   ///
   /// @brief Expands the condensed dual variables, i.e., computes the Newton 
   /// direction of the condensed dual variables of this stage.
+  /// @param[in] robot Robot model. 
   /// @param[in] grid_info Grid info of this stage.
   /// @param[in, out] data Data of this stage. 
   /// @param[in] d_next Split direction of the next stage.
   /// @param[in, out] d Split direction of this stage.
   /// 
-  void expandDual(const GridInfo& grid_info, OCPData& data, 
-                  const SplitDirection& d_next, SplitDirection& d) const;
+  void expandDual(const Robot& robot, const GridInfo& grid_info, 
+                  OCPData& data, const SplitDirection& d_next, 
+                  SplitDirection& d) const;
 
   ///
   /// @brief Returns maximum stap size of the primal variables that satisfies 
@@ -0,0 +1,129 @@
+#ifndef ROBOTOC_MOVE_BLOCKING_HPP_
+#define ROBOTOC_MOVE_BLOCKING_HPP_
+
+#include <vector>
+
+#include "robotoc/core/solution.hpp"
+#include "robotoc/ocp/grid_info.hpp"
+#include "robotoc/ocp/time_discretization.hpp"
+
+
+namespace robotoc {
+
+///
+/// @class MoveBlocking
+/// @brief Move blocking of the control inputs, i.e., the control inputs of
+/// the consecutive grids in each block are tied to that of the first grid of
+/// the block. The blocks are counted over the grids except for the impact
+/// grids from the initial grid. A block is split at the grids that cannot
+/// be blocked, i.e., the impact and lift grids, the grids with the switching
+/// constraint, and the grids involved in the switching time optimization.
+///
+class MoveBlocking {
+public:
+  ///
+  /// @brief Constructor.
+  /// @param[in] block_sizes Sizes of the blocks, i.e., the numbers of the
+  /// consecutive grids whose control inputs are tied to each other. Each
+  /// element must be positive. Grids after the listed blocks are not blocked.
+  /// If empty, the move blocking is disabled.
+  ///
+  MoveBlocking(const std::vector<int>& block_sizes);
+
+  ///
+  /// @brief Default constructor. The move blocking is disabled.
+  ///
+  MoveBlocking();
+
+  ///
+  /// @brief Default destructor.
+  ///
+  ~MoveBlocking() = default;
+
+  ///
+  /// @brief Default copy constructor.
+  ///
+  MoveBlocking(const MoveBlocking&) = default;
+
+  ///
+  /// @brief Default copy assign operator.
+  ///
+  MoveBlocking& operator=(const MoveBlocking&) = default;
+
+  ///
+  /// @brief Default move constructor.
+  ///
+  MoveBlocking(MoveBlocking&&) noexcept = default;
+
+  ///
+  /// @brief Default move assign operator.
+  ///
+  MoveBlocking& operator=(MoveBlocking&&) noexcept = default;
+
+  ///
+  /// @brief Updates the blocked grids according to the time discretization.
+  /// @param[in] time_discretization Time discretization.
+  ///
+  void update(const TimeDiscretization& time_discretization);
+
+  ///
+  /// @brief Checks wheather the control input of the grid is tied to that of
+  /// the previous grid or not.
+  /// @param[in] grid Index of the grid of interest.
+  /// @return true if the control input is tied to that of the previous grid.
+  /// false if not.
+  ///
+  bool isBlocked(const int grid) const {
+    return (grid < is_blocked_.size() && is_blocked_[grid]);
+  }
+
+  ///
+  /// @brief Checks wheather the move blocking is enabled or not.
+  /// @return true if the move blocking is enabled. false if not.
+  ///
+  bool enabled() const {
+    return !block_sizes_.empty();
+  }
+
+  ///
+  /// @brief Returns the number of the grids whose control inputs are tied to
+  /// that of the previous grid.
+  /// @return The number of the blocked grids.
+  ///
+  int numBlockedGrids() const {
+    return num_blocked_grids_;
+  }
+
+  ///
+  /// @brief Returns the sizes of the blocks.
+  /// @return const reference to the sizes of the blocks.
+  ///
+  const std::vector<int>& blockSizes() const {
+    return block_sizes_;
+  }
+
+  ///
+  /// @brief Copies the control input of the first grid of each block to the
+  /// other grids of the block.
+  /// @param[in, out] s Solution.
+  ///
+  void projectSolution(Solution& s) const;
+
+  ///
+  /// @brief Checks wheather the control input of the grid can be tied to
+  /// that of the neighboring grids or not.
+  /// @param[in] grid_info Grid info of the grid of interest.
+  /// @return true if the control input can be tied. false if not.
+  ///
+  static bool isBlockable(const GridInfo& grid_info);
+
+private:
+  std::vector<int> block_sizes_;
+  std::vector<bool> is_blocked_;
+  int num_blocked_grids_;
+
+};
+
+} // namespace robotoc
+
+#endif // ROBOTOC_MOVE_BLOCKING_HPP_
\ No newline at end of file
@@ -146,6 +146,22 @@ struct OCP {
   ///
   int reserved_num_discrete_events = 0;
 
+  ///
+  /// @return Nominal time steps of the horizon used in the grid-based 
+  /// discretization. If empty, the horizon is divided uniformly, i.e., the 
+  /// time steps are T/N. Otherwise, the size must be N and the sum must be T.
+  /// See also TimeDiscretization::GeometricTimeSteps().
+  ///
+  std::vector<double> time_steps;
+
+  ///
+  /// @return Sizes of the blocks of the move blocking, i.e., the numbers of 
+  /// the consecutive grids from the initial grid whose control inputs are 
+  /// tied to each other. Grids after the listed blocks are not blocked. 
+  /// If empty, the move blocking is disabled. See also MoveBlocking.
+  ///
+  std::vector<int> move_blocking;
+
   void disp(std::ostream& os) const;
 
   friend std::ostream& operator<<(std::ostream& os, const OCP& ocp);
@@ -1,6 +1,8 @@
 #ifndef ROBOTOC_OCP_DATA_HPP_
 #define ROBOTOC_OCP_DATA_HPP_
 
+#include "Eigen/Core"
+
 #include "robotoc/core/performance_index.hpp"
 #include "robotoc/cost/cost_function_data.hpp"
 #include "robotoc/constraints/constraints_data.hpp"
@@ -46,6 +48,13 @@ struct OCPData {
   ///
   SwitchingConstraintData switching_constraint_data;
 
+  ///
+  /// @brief Partial derivative of the Lagrangian with respect to the control 
+  /// input before the condensing. Used to evaluate the KKT error of the 
+  /// move-blocked stages.
+  ///
+  Eigen::VectorXd lu;
+
   ///
   /// @brief Returns the lp norm of the primal feasibility, i.e., the constraint 
   /// violation. Default norm is l1-norm. You can also specify l-infty norm by 
@@ -126,6 +126,41 @@ public:
     return max_dt;
   }
 
+  ///
+  /// @brief Sets the nominal time steps of the horizon used in discretize(). 
+  /// The grids are placed at the partial sums of the time steps and the 
+  /// discrete events are inserted between them. By default, the time steps 
+  /// are uniform, i.e., T/N. 
+  /// @param[in] time_steps The nominal time steps. Each element must be 
+  /// positive and the sum must be T. The size is the new number of the time 
+  /// stages N().
+  /// @note The nominal time steps are ignored if correctTimeSteps() or 
+  /// remesh() is called after discretize(), i.e., in the phase-based 
+  /// discretization.
+  ///
+  void setTimeSteps(const std::vector<double>& time_steps);
+
+  ///
+  /// @brief Returns the nominal time steps of the horizon.
+  /// @return const reference to the nominal time steps.
+  ///
+  const std::vector<double>& timeSteps() const {
+    return time_steps_;
+  }
+
+  ///
+  /// @brief Returns the geometric time-step profile, i.e., the time steps 
+  /// that are multiplied by ratio at each stage and whose sum is T. 
+  /// If ratio > 1, the time steps are fine near the initial time and coarse 
+  /// toward the end of the horizon.
+  /// @param[in] T Length of the horizon. Must be positive.
+  /// @param[in] N Number of the time steps. Must be positive.
+  /// @param[in] ratio Ratio of the consecutive time steps. Must be positive. 
+  /// @return The geometric time steps.
+  ///
+  static std::vector<double> GeometricTimeSteps(const double T, const int N, 
+                                                const double ratio);
+
   ///
   /// @brief Reserve the discrete-event data. 
   /// @param[in] reserved_num_discrete_events Reserved size of discrete events  
@@ -154,6 +189,53 @@ public:
   ///
   void correctTimeSteps(const std::shared_ptr<ContactSequence>& contact_sequence, const double t);
 
+  ///
+  /// @brief Re-discretizes the finite horizon with the specified number of 
+  /// grids of each contact phase. The discrete events on the horizon are 
+  /// the same as those of the current discretization, and the grids are 
+  /// placed uniformly in each contact phase as in correctTimeSteps().
+  /// @param[in] contact_sequence Shared ptr to the contact sequence.
+  /// @param[in] t Initial time of the horizon.
+  /// @param[in] num_grids_in_phase Number of grids of each contact phase on  
+  /// the horizon. Size must be numPhases() and each element must be positive.
+  /// The grid of a lift event is counted in the contact phase after the lift, 
+  /// while the grid of an impact event is not counted in any phase. 
+  ///
+  void remesh(const std::shared_ptr<ContactSequence>& contact_sequence, 
+              const double t, const std::vector<int>& num_grids_in_phase);
+
+  ///
+  /// @brief Returns the number of the contact phases on the horizon. 
+  /// @return The number of the contact phases on the horizon.
+  ///
+  int numPhases() const {
+    return (grid_[num_grids_].phase - grid_[0].phase + 1);
+  }
+
+  ///
+  /// @brief Checks whether the structure of the grid, i.e., the grid type, 
+  /// phase, impact and lift indices, and the switching constraint flag, or 
+  /// the structure of the contact sequence changed at the last call of 
+  /// discretize(). Data that only depends on the structure, e.g., the contact 
+  /// status of the split solution, need not be updated on unchanged grids.
+  /// @param[in] i Stage of interest. 
+  /// @return true if the structure changed. false if not.
+  ///
+  inline bool isStructureChanged(const int i) const {
+    assert(i >= 0);
+    assert(i < size());
+    return structure_changed_[i];
+  }
+
+  ///
+  /// @brief Returns the number of grids whose structure changed at the last 
+  /// call of discretize(). 
+  /// @return The number of grids whose structure changed.
+  ///
+  int numStructureChangedGrids() const {
+    return num_structure_changed_grids_;
+  }
+
   ///
   /// @brief Displays the time discretization onto a ostream.
   ///
@@ -165,8 +247,24 @@ public:
 private:
   double T_, max_dt_, eps_;
   int N_, num_grids_, reserved_num_discrete_events_;
-  std::vector<GridInfo> grid_;
-  std::vector<bool> sto_event_, sto_phase_;
+  std::vector<double> time_steps_;
+  std::vector<GridInfo> grid_, grid_prev_;
+  std::vector<bool> sto_event_, sto_phase_, structure_changed_;
+  int num_structure_changed_grids_;
+  const ContactSequence* contact_sequence_ptr_;
+  unsigned long contact_sequence_version_;
+
+  void setGridInfo(const double t);
+
+  void updateStructureChanges(
+      const std::shared_ptr<ContactSequence>& contact_sequence);
+
+  static bool isStructureEqual(const GridInfo& grid, const GridInfo& other) {
+    return (grid.type == other.type && grid.phase == other.phase 
+            && grid.impact_index == other.impact_index 
+            && grid.lift_index == other.lift_index
+            && grid.switching_constraint == other.switching_constraint);
+  }
 };
 
 } // namespace robotoc
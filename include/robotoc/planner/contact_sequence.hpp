@@ -1,7 +1,6 @@
 #ifndef ROBOTOC_CONTACT_SEQUENCE_HPP_
 #define ROBOTOC_CONTACT_SEQUENCE_HPP_ 
 
-#include <deque>
 #include <iostream>
 #include <memory>
 #include <cassert>
@@ -9,6 +8,7 @@
 #include "robotoc/robot/robot.hpp"
 #include "robotoc/robot/se3.hpp"
 #include "robotoc/utils/aligned_vector.hpp"
+#include "robotoc/utils/ring_buffer.hpp"
 #include "robotoc/robot/contact_status.hpp"
 #include "robotoc/robot/impact_status.hpp"
 #include "robotoc/planner/discrete_event.hpp"
@@ -19,6 +19,11 @@ namespace robotoc {
 ///
 /// @class ContactSequence
 /// @brief The sequence of contact status and discrete events (impact and lift). 
+/// The contact phases and discrete events are stored in ring buffers whose 
+/// capacities are given by the reserved number of discrete events. Therefore, 
+/// push_back(), pop_back(), and pop_front() do not allocate memory once the 
+/// sequence is constructed, as long as the number of each discrete events 
+/// does not exceed reservedNumDiscreteEvents().
 ///
 class ContactSequence {
 public:
@@ -282,7 +287,7 @@ public:
   /// @brief Returns the event times of each event. 
   /// @return const reference to the event times.
   ///
-  const std::deque<double>& eventTimes() const {
+  const RingBuffer<double>& eventTimes() const {
     return event_time_;
   }
 
@@ -298,6 +303,14 @@ public:
   ///
   int reservedNumDiscreteEvents() const;
 
+  ///
+  /// @brief Returns the version stamp of the structure of this contact 
+  /// sequence. The stamp changes each time contact phases or discrete events 
+  /// are added or removed, but not when only the event times are modified.
+  /// @return Version stamp of the structure.
+  ///
+  unsigned long structureVersion() const;
+
   ///
   /// @brief Displays the contact sequence onto a ostream.
   ///
@@ -313,13 +326,24 @@ public:
 private:
   int reserved_num_discrete_events_;
   ContactStatus default_contact_status_;
-  std::deque<ContactStatus> contact_statuses_;
-  std::deque<DiscreteEvent> impact_events_;
-  std::deque<int> event_index_impact_, event_index_lift_;
-  std::deque<double> event_time_, impact_time_, lift_time_;
-  std::deque<bool> is_impact_event_, sto_impact_, sto_lift_;
+  DiscreteEvent discrete_event_;
+  RingBuffer<ContactStatus> contact_statuses_;
+  RingBuffer<DiscreteEvent> impact_events_;
+  RingBuffer<int> event_index_impact_, event_index_lift_;
+  RingBuffer<double> event_time_, impact_time_, lift_time_;
+  RingBuffer<bool> is_impact_event_, sto_impact_, sto_lift_;
+  int event_index_offset_;
+  unsigned long structure_version_;
 
   void clear();
+
+  int impactEventIndex(const int impact_index) const {
+    return event_index_impact_[impact_index] - event_index_offset_;
+  }
+
+  int liftEventIndex(const int lift_index) const {
+    return event_index_lift_[lift_index] - event_index_offset_;
+  }
 };
  
 } // namespace robotoc 
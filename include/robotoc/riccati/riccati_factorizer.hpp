@@ -145,6 +145,38 @@ public:
                                 SplitRiccatiFactorization& riccati,
                                 const bool sto);
 
+  ///
+  /// @brief Accumulates the KKT matrix and residual of the next stage whose 
+  /// control input is tied to that of this stage (move blocking) into those 
+  /// of this stage. Must be called before the backward Riccati recursion of 
+  /// this stage. 
+  /// @param[in] kkt_matrix_next Split KKT matrix of the next stage, which is 
+  /// already accumulated in the backward Riccati recursion. 
+  /// @param[in] kkt_residual_next Split KKT residual of the next stage, which 
+  /// is already accumulated in the backward Riccati recursion. 
+  /// @param[in, out] kkt_matrix Split KKT matrix of this stage. 
+  /// @param[in, out] kkt_residual Split KKT residual of this stage. 
+  ///
+  void accumulateMoveBlockedKKT(const SplitKKTMatrix& kkt_matrix_next, 
+                                const SplitKKTResidual& kkt_residual_next,
+                                SplitKKTMatrix& kkt_matrix, 
+                                SplitKKTResidual& kkt_residual);
+
+  ///
+  /// @brief Performs the backward Riccati recursion of the stage whose 
+  /// control input is tied to that of the previous stage (move blocking). 
+  /// The control input is not eliminated and the partial derivatives of the 
+  /// cost-to-go with respect to the control input are accumulated in 
+  /// kkt_matrix.Qxu, kkt_matrix.Quu, and kkt_residual.lu.
+  /// @param[in] riccati_next Riccati factorization of the next stage. 
+  /// @param[in, out] kkt_matrix Split KKT matrix of this stage. 
+  /// @param[in, out] kkt_residual Split KKT residual of this stage. 
+  /// @param[in, out] riccati Riccati factorization of this stage. 
+  ///
+  void backwardRiccatiRecursionMoveBlocked(
+      const SplitRiccatiFactorization& riccati_next, SplitKKTMatrix& kkt_matrix, 
+      SplitKKTResidual& kkt_residual, SplitRiccatiFactorization& riccati);
+
 private:
   bool has_floating_base_;
   int dimv_, dimu_;
@@ -153,6 +185,7 @@ private:
   LQRPolicy lqr_policy_;
   BackwardRiccatiRecursionFactorizer backward_recursion_;
   SplitConstrainedRiccatiFactorization c_riccati_;
+  Eigen::MatrixXd BtQxu_;
 
 };
 
@@ -188,6 +221,22 @@ void forwardRiccatiRecursion(const SplitKKTMatrix& kkt_matrix,
                             const SplitDirection& d, 
                             SplitDirection& d_next);
 
+///
+/// @brief Performs the forward Riccati recursion of the stage whose control 
+/// input is tied to that of the previous stage (move blocking) and computes 
+/// the state direction. 
+/// @param[in] kkt_matrix Split KKT matrix of this stage. 
+/// @param[in] kkt_residual Split KKT residual of this stage. 
+/// @param[in] d_prev Split direction of the previous stage. 
+/// @param[in, out] d Split direction of this stage. 
+/// @param[in, out] d_next Split direction of the next stage. 
+///
+void forwardRiccatiRecursionMoveBlocked(const SplitKKTMatrix& kkt_matrix, 
+                                        const SplitKKTResidual& kkt_residual,
+                                        const SplitDirection& d_prev, 
+                                        SplitDirection& d, 
+                                        SplitDirection& d_next);
+
 /// 
 /// @brief Computes the switching time direction. 
 /// @param[in, out] sto_policy STO policy. 
@@ -220,6 +269,17 @@ void computeCostateDirection(const SplitRiccatiFactorization& riccati,
 void computeCostateDirection(const SplitRiccatiFactorization& riccati, 
                              SplitDirection& d, const bool sto);
 
+///
+/// @brief Computes the Newton direction of the costate of the stage whose 
+/// control input is tied to that of the previous stage (move blocking). 
+/// @param[in] riccati Riccati factorization of this stage. 
+/// @param[in] kkt_matrix Split KKT matrix of this stage. 
+/// @param[in, out] d Split direction of this stage. 
+///
+void computeCostateDirectionMoveBlocked(const SplitRiccatiFactorization& riccati, 
+                                        const SplitKKTMatrix& kkt_matrix, 
+                                        SplitDirection& d);
+
 ///
 /// @brief Computes the Newton direction of the Lagrange multiplier with 
 /// respect to the switching constraint. 
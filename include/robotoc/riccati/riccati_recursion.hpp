@@ -13,6 +13,7 @@
 #include "robotoc/riccati/riccati_factorizer.hpp"
 #include "robotoc/ocp/ocp.hpp"
 #include "robotoc/ocp/time_discretization.hpp"
+#include "robotoc/ocp/move_blocking.hpp"
 
 
 namespace robotoc {
@@ -84,6 +85,25 @@ public:
                                 KKTResidual& kkt_residual, 
                                 RiccatiFactorization& factorization);
 
+  ///
+  /// @brief Performs the backward Riccati recursion with the move blocking. 
+  /// The KKT matrix and residual of the blocked stages are accumulated into 
+  /// those of the first stage of each block, where the control input is 
+  /// eliminated. The LQR policy of each blocked stage is that of the first 
+  /// stage of the block.
+  /// @param[in] time_discretization Time discretization. 
+  /// @param[in] move_blocking Move blocking. Must be updated by 
+  /// time_discretization.
+  /// @param[in, out] kkt_matrix KKT matrix. 
+  /// @param[in, out] kkt_residual KKT residual. 
+  /// @param[in, out] factorization Riccati factorization. 
+  ///
+  void backwardRiccatiRecursion(const TimeDiscretization& time_discretization, 
+                                const MoveBlocking& move_blocking,
+                                KKTMatrix& kkt_matrix, 
+                                KKTResidual& kkt_residual, 
+                                RiccatiFactorization& factorization);
+
   ///
   /// @brief Performs the backward Riccati recursion. 
   /// @param[in] time_discretization Time discretization. 
@@ -98,9 +118,30 @@ public:
                                const RiccatiFactorization& factorization,
                                Direction& d) const;
 
+  ///
+  /// @brief Performs the forward Riccati recursion with the move blocking. 
+  /// @param[in] time_discretization Time discretization. 
+  /// @param[in] move_blocking Move blocking. Must be updated by 
+  /// time_discretization.
+  /// @param[in] kkt_matrix KKT matrix. 
+  /// @param[in] kkt_residual KKT residual. 
+  /// @param[in, out] factorization Riccati factorization. 
+  /// @param[in] d Direction. 
+  ///
+  void forwardRiccatiRecursion(const TimeDiscretization& time_discretization, 
+                               const MoveBlocking& move_blocking,
+                               const KKTMatrix& kkt_matrix, 
+                               const KKTResidual& kkt_residual, 
+                               const RiccatiFactorization& factorization,
+                               Direction& d) const;
+
   ///
   /// @brief Gets of the LQR policies over the horizon. 
   /// @return const reference to the LQR policies.
+  /// @remark With the move blocking, the policy of each blocked grid (see 
+  /// MoveBlocking::isBlocked()) is a copy of that of the first grid of the 
+  /// block. Its feedback gain therefore maps the state deviation at the first
+  /// grid of the block, not at the blocked grid itself.
   ///
   const aligned_vector<LQRPolicy>& getLQRPolicy() const;
 
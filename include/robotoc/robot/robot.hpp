@@ -5,6 +5,7 @@
 #include <vector>
 #include <utility>
 #include <iostream>
+#include <memory>
 
 #include "Eigen/Core"
 #include "pinocchio/multibody/model.hpp"
@@ -239,7 +240,9 @@ public:
 
   ///
   /// @brief Updates the frame kinematics of the robot. The frame placements, 
-  /// velocities, and accelerations are calculated. 
+  /// velocities, and accelerations are calculated. Unlike updateKinematics(), 
+  /// no Jacobians or kinematics derivatives are computed, so this is the 
+  /// value-only path used when evaluating the OCP, e.g., in the line search.
   /// @param[in] q Configuration. Size must be Robot::dimq().
   /// @param[in] v Generalized velocity. Size must be Robot::dimv().
   /// @param[in] a Generalized acceleration. Size must be Robot::dimv().
@@ -262,7 +265,8 @@ public:
 
   ///
   /// @brief Updates the frame kinematics of the robot. The frame placements 
-  /// are calculated. 
+  /// are calculated. Does nothing if the cached kinematics were already 
+  /// computed at q.
   /// @param[in] q Configuration. Size must be Robot::dimq().
   ///
   template <typename ConfigVectorType>
@@ -644,6 +648,34 @@ public:
   void computeMinv(const Eigen::MatrixBase<MatrixType1>& M, 
                    const Eigen::MatrixBase<MatrixType2>& Minv);
 
+  ///
+  /// @brief Factorizes the contact dynamics matrix [[M J^T], [J O]], i.e., 
+  /// computes the sparse Cholesky factorization M = U D U^T and the Cholesky 
+  /// factor of the Schur complement J M^{-1} J^T. The inverse is not formed. 
+  /// Use Robot::solveMJtJ() to apply the inverse.
+  /// @param[in] M Joint inertia matrix. Size must be 
+  /// Robot::dimv() x Robot::dimv().
+  /// @param[in] J Contact Jacobian. Size must be 
+  /// ContactStatus::dimf() x Robot::dimv().
+  ///   
+  template <typename MatrixType1, typename MatrixType2>
+  void factorizeMJtJ(const Eigen::MatrixBase<MatrixType1>& M, 
+                     const Eigen::MatrixBase<MatrixType2>& J);
+
+  ///
+  /// @brief Factorizes the contact dynamics matrix [[M J^T], [J O]] with the 
+  /// contact dimension fixed at compile time. The Schur complement 
+  /// J M^{-1} J^T and its factorization are then fixed-size and allocation-free.
+  /// @tparam Dimf Dimension of the active contacts. Must be positive and equal
+  /// to J.rows().
+  /// @param[in] M Joint inertia matrix. Size must be
+  /// Robot::dimv() x Robot::dimv().
+  /// @param[in] J Contact Jacobian. Size must be Dimf x Robot::dimv().
+  ///
+  template <int Dimf, typename MatrixType1, typename MatrixType2>
+  void factorizeMJtJ(const Eigen::MatrixBase<MatrixType1>& M,
+                     const Eigen::MatrixBase<MatrixType2>& J);
+
   ///
   /// @brief Computes the inverse of the contact dynamics matrix [[M J^T], [J O]].
   /// @param[in] M Joint inertia matrix. Size must be 
@@ -659,6 +691,50 @@ public:
                       const Eigen::MatrixBase<MatrixType2>& J,
                       const Eigen::MatrixBase<MatrixType3>& MJtJinv);
 
+  ///
+  /// @brief Applies the inverse of the contact dynamics matrix 
+  /// [[M J^T], [J O]] to X in place via the factorization computed in the 
+  /// last call of Robot::factorizeMJtJ(), Robot::computeMJtJinv(), or 
+  /// Robot::computeMinv(). 
+  /// @param[in, out] X Right-hand side overwritten by the solution. 
+  /// Row size must be Robot::dimv() + ContactStatus::dimf().
+  ///
+  template <typename MatrixType>
+  void solveMJtJ(const Eigen::MatrixBase<MatrixType>& X) const;
+
+  ///
+  /// @brief Applies the inverse of the contact dynamics matrix 
+  /// [[M J^T], [J O]] to X in place with a factorization that was moved out 
+  /// of the robot by Robot::swapMJtJFactorization().
+  /// @param[in] U Unit upper-triangular factor of M = U D U^T.
+  /// @param[in] D Diagonal factor of M = U D U^T.
+  /// @param[in] sDUiJt D^{-1/2} U^{-1} J^T stored in the leading columns.
+  /// @param[in] L Lower-triangular Cholesky factor of J M^{-1} J^T stored in
+  /// the top-left corner.
+  /// @param[in, out] X Right-hand side overwritten by the solution. 
+  /// Row size must be Robot::dimv() + ContactStatus::dimf().
+  ///
+  template <typename MatrixType>
+  void solveMJtJ(const Eigen::MatrixXd& U, const Eigen::VectorXd& D, 
+                 const Eigen::MatrixXd& sDUiJt, const Eigen::MatrixXd& L,
+                 const Eigen::MatrixBase<MatrixType>& X) const;
+
+  ///
+  /// @brief Exchanges the factorization computed in the last call of 
+  /// Robot::factorizeMJtJ(), Robot::computeMJtJinv(), or Robot::computeMinv()
+  /// with the given buffers. Only the buffers are swapped, so the cost is O(1).
+  /// @param[in, out] U Unit upper-triangular factor of M = U D U^T. Size 
+  /// must be Robot::dimv() x Robot::dimv().
+  /// @param[in, out] D Diagonal factor of M = U D U^T. Size must be 
+  /// Robot::dimv().
+  /// @param[in, out] sDUiJt D^{-1/2} U^{-1} J^T. Size must be 
+  /// Robot::dimv() x Robot::max_dimf().
+  /// @param[in, out] L Cholesky factor of J M^{-1} J^T. Size must be 
+  /// Robot::max_dimf() x Robot::max_dimf().
+  ///
+  void swapMJtJFactorization(Eigen::MatrixXd& U, Eigen::VectorXd& D, 
+                             Eigen::MatrixXd& sDUiJt, Eigen::MatrixXd& L);
+
   ///
   /// @brief Generates feasible configuration randomly.
   /// @return The random and feasible configuration. Size is Robot::dimq().
@@ -912,7 +988,7 @@ private:
   // Robot model info
   RobotModelInfo info_;
   // Pinocchio models and datas, and runtime variables
-  pinocchio::Model model_, impact_model_;
+  std::shared_ptr<const pinocchio::Model> model_, impact_model_;
   pinocchio::Data data_, impact_data_;
   pinocchio::container::aligned_vector<pinocchio::Force> fjoint_;
   Eigen::MatrixXd dimpact_dv_; 
@@ -924,6 +1000,15 @@ private:
   RobotProperties properties_;
   Eigen::VectorXd joint_effort_limit_, joint_velocity_limit_, 
                   lower_joint_position_limit_, upper_joint_position_limit_;
+  // Kinematics cache
+  Eigen::VectorXd q_kinematics_;
+  bool has_frame_kinematics_;
+
+  template <typename ConfigVectorType>
+  void setKinematicsCache(const Eigen::MatrixBase<ConfigVectorType>& q);
+
+  template <typename ConfigVectorType>
+  void invalidateKinematicsCache(const Eigen::MatrixBase<ConfigVectorType>& q);
 };
 
 } // namespace robotoc
@@ -28,7 +28,7 @@ inline void Robot::integrateConfiguration(
   assert(q.size() == dimq_);
   if (info_.base_joint_type == BaseJointType::FloatingBase) {
     const Eigen::VectorXd q_tmp = q;
-    pinocchio::integrate(model_, q_tmp, integration_length*v, 
+    pinocchio::integrate(*model_, q_tmp, integration_length*v, 
                          const_cast<Eigen::MatrixBase<ConfigVectorType>&>(q));
   }
   else {
@@ -49,7 +49,7 @@ inline void Robot::integrateConfiguration(
   assert(v.size() == dimv_);
   assert(q_integrated.size() == dimq_);
   pinocchio::integrate(
-      model_, q, integration_length*v, 
+      *model_, q, integration_length*v, 
       const_cast<Eigen::MatrixBase<ConfigVectorType2>&>(q_integrated));
 }
 
@@ -67,7 +67,7 @@ inline void Robot::dIntegrateTransport_dq(
   assert(Jout.rows() == Jin.rows());
   assert(Jout.cols() == Jin.cols());
   pinocchio::dIntegrateTransport(
-      model_, q, v, Jin.transpose(), 
+      *model_, q, v, Jin.transpose(), 
       const_cast<Eigen::MatrixBase<MatrixType2>&>(Jout).transpose(),
       pinocchio::ARG0);
 }
@@ -86,7 +86,7 @@ inline void Robot::dIntegrateTransport_dv(
   assert(Jout.rows() == Jin.rows());
   assert(Jout.cols() == Jin.cols());
   pinocchio::dIntegrateTransport(
-      model_, q, v, Jin.transpose(), 
+      *model_, q, v, Jin.transpose(), 
       const_cast<Eigen::MatrixBase<MatrixType2>&>(Jout).transpose(),
       pinocchio::ARG1);
 }
@@ -102,7 +102,7 @@ inline void Robot::subtractConfiguration(
   assert(q0.size() == dimq_);
   assert(qdiff.size() == dimv_);
   pinocchio::difference(
-      model_, q0, qf, 
+      *model_, q0, qf, 
       const_cast<Eigen::MatrixBase<TangentVectorType>&>(qdiff));
 }
 
@@ -117,7 +117,7 @@ inline void Robot::dSubtractConfiguration_dqf(
   assert(q0.size() == dimq_);
   assert(dqdiff_dqf.rows() == dimv_);
   assert(dqdiff_dqf.cols() == dimv_);
-  pinocchio::dDifference(model_, q0, qf, 
+  pinocchio::dDifference(*model_, q0, qf, 
                          const_cast<Eigen::MatrixBase<MatrixType>&>(dqdiff_dqf),
                          pinocchio::ARG1);
 }
@@ -133,7 +133,7 @@ inline void Robot::dSubtractConfiguration_dq0(
   assert(q0.size() == dimq_);
   assert(dqdiff_dq0.rows() == dimv_);
   assert(dqdiff_dq0.cols() == dimv_);
-  pinocchio::dDifference(model_, q0, qf, 
+  pinocchio::dDifference(*model_, q0, qf, 
                          const_cast<Eigen::MatrixBase<MatrixType>&>(dqdiff_dq0),
                          pinocchio::ARG0);
 }
@@ -150,7 +150,7 @@ inline void Robot::interpolateConfiguration(
   assert(qout.size() == dimq_);
   assert(t >= 0.0);
   assert(t <= 1.0);
-  pinocchio::interpolate(model_, q1, q2, t, 
+  pinocchio::interpolate(*model_, q1, q2, t, 
                          const_cast<Eigen::MatrixBase<ConfigVectorType3>&>(qout));
 }
 
@@ -162,7 +162,7 @@ inline void Robot::integrateCoeffWiseJacobian(
   assert(q.size() == dimq_);
   assert(J.rows() == dimq_);
   assert(J.cols() == dimv_);
-  pinocchio::integrateCoeffWiseJacobian(model_, q, 
+  pinocchio::integrateCoeffWiseJacobian(*model_, q, 
                                         const_cast<Eigen::MatrixBase<MatrixType>&>(J));
 }
 
@@ -176,10 +176,11 @@ inline void Robot::updateKinematics(
   assert(q.size() == dimq_);
   assert(v.size() == dimv_);
   assert(a.size() == dimv_);
-  pinocchio::forwardKinematics(model_, data_, q, v, a);
-  pinocchio::updateFramePlacements(model_, data_);
-  pinocchio::computeForwardKinematicsDerivatives(model_, data_, q, v, a);
-  pinocchio::jacobianCenterOfMass(model_, data_, false);
+  pinocchio::forwardKinematics(*model_, data_, q, v, a);
+  pinocchio::updateFramePlacements(*model_, data_);
+  pinocchio::computeForwardKinematicsDerivatives(*model_, data_, q, v, a);
+  pinocchio::jacobianCenterOfMass(*model_, data_, false);
+  setKinematicsCache(q);
 }
 
 
@@ -189,11 +190,12 @@ inline void Robot::updateKinematics(
     const Eigen::MatrixBase<TangentVectorType>& v) {
   assert(q.size() == dimq_);
   assert(v.size() == dimv_);
-  pinocchio::forwardKinematics(model_, data_, q, v);
-  pinocchio::updateFramePlacements(model_, data_);
-  pinocchio::computeForwardKinematicsDerivatives(model_, data_, q, v, 
+  pinocchio::forwardKinematics(*model_, data_, q, v);
+  pinocchio::updateFramePlacements(*model_, data_);
+  pinocchio::computeForwardKinematicsDerivatives(*model_, data_, q, v, 
                                                  Eigen::VectorXd::Zero(dimv_));
-  pinocchio::jacobianCenterOfMass(model_, data_, false);
+  pinocchio::jacobianCenterOfMass(*model_, data_, false);
+  setKinematicsCache(q);
 }
 
 
@@ -201,9 +203,10 @@ template <typename ConfigVectorType>
 inline void Robot::updateKinematics(
     const Eigen::MatrixBase<ConfigVectorType>& q) {
   assert(q.size() == dimq_);
-  pinocchio::framesForwardKinematics(model_, data_, q);
-  pinocchio::computeJointJacobians(model_, data_, q);
-  pinocchio::jacobianCenterOfMass(model_, data_, false);
+  pinocchio::framesForwardKinematics(*model_, data_, q);
+  pinocchio::computeJointJacobians(*model_, data_, q);
+  pinocchio::jacobianCenterOfMass(*model_, data_, false);
+  setKinematicsCache(q);
 }
 
 
@@ -216,9 +219,10 @@ inline void Robot::updateFrameKinematics(
   assert(q.size() == dimq_);
   assert(v.size() == dimv_);
   assert(a.size() == dimv_);
-  pinocchio::forwardKinematics(model_, data_, q, v, a);
-  pinocchio::updateFramePlacements(model_, data_);
-  pinocchio::centerOfMass(model_, data_, q, v, a, false);
+  pinocchio::forwardKinematics(*model_, data_, q, v, a);
+  pinocchio::updateFramePlacements(*model_, data_);
+  pinocchio::centerOfMass(*model_, data_, q, v, a, false);
+  setKinematicsCache(q);
 }
 
 
@@ -228,9 +232,10 @@ inline void Robot::updateFrameKinematics(
     const Eigen::MatrixBase<TangentVectorType>& v) {
   assert(q.size() == dimq_);
   assert(v.size() == dimv_);
-  pinocchio::forwardKinematics(model_, data_, q, v);
-  pinocchio::updateFramePlacements(model_, data_);
-  pinocchio::centerOfMass(model_, data_, q, v, false);
+  pinocchio::forwardKinematics(*model_, data_, q, v);
+  pinocchio::updateFramePlacements(*model_, data_);
+  pinocchio::centerOfMass(*model_, data_, q, v, false);
+  setKinematicsCache(q);
 }
 
 
@@ -238,8 +243,30 @@ template <typename ConfigVectorType>
 inline void Robot::updateFrameKinematics(
     const Eigen::MatrixBase<ConfigVectorType>& q) {
   assert(q.size() == dimq_);
-  pinocchio::framesForwardKinematics(model_, data_, q);
-  pinocchio::centerOfMass(model_, data_, q, false);
+  if (has_frame_kinematics_ && q == q_kinematics_) return;
+  pinocchio::framesForwardKinematics(*model_, data_, q);
+  pinocchio::centerOfMass(*model_, data_, q, false);
+  setKinematicsCache(q);
+}
+
+
+template <typename ConfigVectorType>
+inline void Robot::setKinematicsCache(
+    const Eigen::MatrixBase<ConfigVectorType>& q) {
+  if (!has_frame_kinematics_ || q != q_kinematics_) {
+    q_kinematics_ = q;
+    has_frame_kinematics_ = true;
+  }
+}
+
+
+template <typename ConfigVectorType>
+inline void Robot::invalidateKinematicsCache(
+    const Eigen::MatrixBase<ConfigVectorType>& q) {
+  // Algorithms run at another configuration overwrite the joint placements.
+  if (has_frame_kinematics_ && q != q_kinematics_) {
+    has_frame_kinematics_ = false;
+  }
 }
 
 
@@ -248,7 +275,7 @@ inline void Robot::getFrameJacobian(const int frame_id,
                                     const Eigen::MatrixBase<MatrixType>& J) {
   assert(J.rows() == 6);
   assert(J.cols() == dimv_);
-  pinocchio::getFrameJacobian(model_, data_, frame_id, pinocchio::LOCAL, 
+  pinocchio::getFrameJacobian(*model_, data_, frame_id, pinocchio::LOCAL, 
                               const_cast<Eigen::MatrixBase<MatrixType>&>(J));
 }
 
@@ -298,7 +325,7 @@ inline void Robot::computeBaumgarteResidual(
   for (int i=0; i<num_point_contacts; ++i) {
     if (contact_status.isContactActive(i)) {
       point_contacts_[i].computeBaumgarteResidual(
-          model_, data_, contact_status.contactPosition(i),
+          *model_, data_, contact_status.contactPosition(i),
           (const_cast<Eigen::MatrixBase<VectorType>&>(baumgarte_residual))
               .template segment<3>(dimf));
       dimf += 3;
@@ -307,7 +334,7 @@ inline void Robot::computeBaumgarteResidual(
   for (int i=0; i<num_surface_contacts; ++i) {
     if (contact_status.isContactActive(i+num_point_contacts)) {
       surface_contacts_[i].computeBaumgarteResidual(
-          model_, data_, contact_status.contactPlacement(i+num_point_contacts),
+          *model_, data_, contact_status.contactPlacement(i+num_point_contacts),
           (const_cast<Eigen::MatrixBase<VectorType>&>(baumgarte_residual))
               .template segment<6>(dimf));
       dimf += 6;
@@ -335,7 +362,7 @@ inline void Robot::computeBaumgarteDerivatives(
   for (int i=0; i<num_point_contacts; ++i) {
     if (contact_status.isContactActive(i)) {
       point_contacts_[i].computeBaumgarteDerivatives(
-          model_, data_, 
+          *model_, data_, 
           (const_cast<Eigen::MatrixBase<MatrixType1>&>(baumgarte_partial_dq))
               .block(dimf, 0, 3, dimv_),
           (const_cast<Eigen::MatrixBase<MatrixType2>&>(baumgarte_partial_dv))
@@ -348,7 +375,7 @@ inline void Robot::computeBaumgarteDerivatives(
   for (int i=0; i<num_surface_contacts; ++i) {
     if (contact_status.isContactActive(i+num_point_contacts)) {
       surface_contacts_[i].computeBaumgarteDerivatives(
-          model_, data_, 
+          *model_, data_, 
           (const_cast<Eigen::MatrixBase<MatrixType1>&>(baumgarte_partial_dq))
               .block(dimf, 0, 6, dimv_),
           (const_cast<Eigen::MatrixBase<MatrixType2>&>(baumgarte_partial_dv))
@@ -373,7 +400,7 @@ inline void Robot::computeImpactVelocityResidual(
   for (int i=0; i<num_point_contacts; ++i) {
     if (impact_status.isImpactActive(i)) {
       point_contacts_[i].computeContactVelocityResidual(
-          model_, data_, 
+          *model_, data_, 
           (const_cast<Eigen::MatrixBase<VectorType>&>(velocity_residual))
               .template segment<3>(dimf));
       dimf += 3;
@@ -382,7 +409,7 @@ inline void Robot::computeImpactVelocityResidual(
   for (int i=0; i<num_surface_contacts; ++i) {
     if (impact_status.isImpactActive(i+num_point_contacts)) {
       surface_contacts_[i].computeContactVelocityResidual(
-          model_, data_, 
+          *model_, data_, 
           (const_cast<Eigen::MatrixBase<VectorType>&>(velocity_residual))
               .template segment<6>(dimf));
       dimf += 6;
@@ -407,7 +434,7 @@ inline void Robot::computeImpactVelocityDerivatives(
   for (int i=0; i<num_point_contacts; ++i) {
     if (impact_status.isImpactActive(i)) {
       point_contacts_[i].computeContactVelocityDerivatives(
-          model_, data_, 
+          *model_, data_, 
           (const_cast<Eigen::MatrixBase<MatrixType1>&>(velocity_partial_dq))
               .block(dimf, 0, 3, dimv_),
           (const_cast<Eigen::MatrixBase<MatrixType2>&>(velocity_partial_dv))
@@ -418,7 +445,7 @@ inline void Robot::computeImpactVelocityDerivatives(
   for (int i=0; i<num_surface_contacts; ++i) {
     if (impact_status.isImpactActive(i+num_point_contacts)) {
       surface_contacts_[i].computeContactVelocityDerivatives(
-          model_, data_, 
+          *model_, data_, 
           (const_cast<Eigen::MatrixBase<MatrixType1>&>(velocity_partial_dq))
               .block(dimf, 0, 6, dimv_),
           (const_cast<Eigen::MatrixBase<MatrixType2>&>(velocity_partial_dv))
@@ -441,7 +468,7 @@ inline void Robot::computeContactPositionResidual(
   for (int i=0; i<num_point_contacts; ++i) {
     if (impact_status.isImpactActive(i)) {
       point_contacts_[i].computeContactPositionResidual(
-          model_, data_, impact_status.contactPosition(i),
+          *model_, data_, impact_status.contactPosition(i),
           (const_cast<Eigen::MatrixBase<VectorType>&>(position_residual))
               .template segment<3>(dimf));
       dimf += 3;
@@ -450,7 +477,7 @@ inline void Robot::computeContactPositionResidual(
   for (int i=0; i<num_surface_contacts; ++i) {
     if (impact_status.isImpactActive(i+num_point_contacts)) {
       surface_contacts_[i].computeContactPositionResidual(
-          model_, data_, impact_status.contactPlacement(i+num_point_contacts),
+          *model_, data_, impact_status.contactPlacement(i+num_point_contacts),
           (const_cast<Eigen::MatrixBase<VectorType>&>(position_residual))
               .template segment<6>(dimf));
       dimf += 6;
@@ -472,7 +499,7 @@ inline void Robot::computeContactPositionDerivative(
   for (int i=0; i<num_point_contacts; ++i) {
     if (impact_status.isImpactActive(i)) {
       point_contacts_[i].computeContactPositionDerivative(
-          model_, data_, 
+          *model_, data_, 
         (const_cast<Eigen::MatrixBase<MatrixType>&>(position_partial_dq))
             .block(dimf, 0, 3, dimv_));
       dimf += 3;
@@ -481,7 +508,7 @@ inline void Robot::computeContactPositionDerivative(
   for (int i=0; i<num_surface_contacts; ++i) {
     if (impact_status.isImpactActive(i+num_point_contacts)) {
       surface_contacts_[i].computeContactPositionDerivative(
-          model_, data_, 
+          *model_, data_, 
         (const_cast<Eigen::MatrixBase<MatrixType>&>(position_partial_dq))
             .block(dimf, 0, 6, dimv_));
       dimf += 6;
@@ -529,13 +556,14 @@ inline void Robot::RNEA(const Eigen::MatrixBase<ConfigVectorType>& q,
   assert(v.size() == dimv_);
   assert(a.size() == dimv_);
   assert(tau.size() == dimv_);
+  invalidateKinematicsCache(q);
   if (max_num_contacts_) {
     const_cast<Eigen::MatrixBase<TangentVectorType3>&>(tau)
-        = pinocchio::rnea(model_, data_, q, v, a, fjoint_);
+        = pinocchio::rnea(*model_, data_, q, v, a, fjoint_);
   }
   else {
     const_cast<Eigen::MatrixBase<TangentVectorType3>&>(tau)
-        = pinocchio::rnea(model_, data_, q, v, a);
+        = pinocchio::rnea(*model_, data_, q, v, a);
   }
   if (properties_.has_generalized_momentum_bias) {
     const_cast<Eigen::MatrixBase<TangentVectorType3>&>(tau).noalias()
@@ -563,16 +591,17 @@ inline void Robot::RNEADerivatives(
   assert(dRNEA_partial_dv.rows() == dimv_);
   assert(dRNEA_partial_da.cols() == dimv_);
   assert(dRNEA_partial_da.rows() == dimv_);
+  invalidateKinematicsCache(q);
   if (max_num_contacts_) {
     pinocchio::computeRNEADerivatives(
-        model_, data_, q, v, a, fjoint_,
+        *model_, data_, q, v, a, fjoint_,
         const_cast<Eigen::MatrixBase<MatrixType1>&>(dRNEA_partial_dq),
         const_cast<Eigen::MatrixBase<MatrixType2>&>(dRNEA_partial_dv),
         const_cast<Eigen::MatrixBase<MatrixType3>&>(dRNEA_partial_da));
   }
   else {
     pinocchio::computeRNEADerivatives(
-        model_, data_, q, v, a, 
+        *model_, data_, q, v, a, 
         const_cast<Eigen::MatrixBase<MatrixType1>&>(dRNEA_partial_dq),
         const_cast<Eigen::MatrixBase<MatrixType2>&>(dRNEA_partial_dv),
         const_cast<Eigen::MatrixBase<MatrixType3>&>(dRNEA_partial_da));
@@ -594,7 +623,7 @@ inline void Robot::RNEAImpact(
   assert(dv.size() == dimv_);
   assert(res.size() == dimv_);
   const_cast<Eigen::MatrixBase<TangentVectorType2>&>(res)
-      = pinocchio::rnea(impact_model_, impact_data_, q, 
+      = pinocchio::rnea(*impact_model_, impact_data_, q, 
                         Eigen::VectorXd::Zero(dimv_),  dv, fjoint_);
 }
 
@@ -613,7 +642,7 @@ inline void Robot::RNEAImpactDerivatives(
   assert(dRNEA_partial_ddv.cols() == dimv_);
   assert(dRNEA_partial_ddv.rows() == dimv_);
   pinocchio::computeRNEADerivatives(
-      impact_model_, impact_data_, q, Eigen::VectorXd::Zero(dimv_), dv, 
+      *impact_model_, impact_data_, q, Eigen::VectorXd::Zero(dimv_), dv, 
       fjoint_, const_cast<Eigen::MatrixBase<MatrixType1>&>(dRNEA_partial_dq),
       dimpact_dv_,
       const_cast<Eigen::MatrixBase<MatrixType2>&>(dRNEA_partial_ddv));
@@ -632,58 +661,137 @@ inline void Robot::computeMinv(const Eigen::MatrixBase<MatrixType1>& M,
   assert(Minv.rows() == dimv_);
   assert(Minv.cols() == dimv_);
   data_.M = M;
-  pinocchio::cholesky::decompose(model_, data_);
+  pinocchio::cholesky::decompose(*model_, data_);
   pinocchio::cholesky::computeMinv(
-      model_, data_, const_cast<Eigen::MatrixBase<MatrixType2>&>(Minv));
+      *model_, data_, const_cast<Eigen::MatrixBase<MatrixType2>&>(Minv));
 }
 
 
-template <typename MatrixType1, typename MatrixType2, typename MatrixType3>
-inline void Robot::computeMJtJinv(
-    const Eigen::MatrixBase<MatrixType1>& M, 
-    const Eigen::MatrixBase<MatrixType2>& J, 
-    const Eigen::MatrixBase<MatrixType3>& MJtJinv) {
+template <typename MatrixType1, typename MatrixType2>
+inline void Robot::factorizeMJtJ(const Eigen::MatrixBase<MatrixType1>& M, 
+                                 const Eigen::MatrixBase<MatrixType2>& J) {
   assert(M.rows() == dimv_);
   assert(M.cols() == dimv_);
   assert(J.rows() <= max_dimf_);
   assert(J.cols() == dimv_);
-  assert(MJtJinv.rows() == M.rows()+J.rows());
-  assert(MJtJinv.cols() == M.rows()+J.rows());
   const int dimf = J.rows();
   data_.M = M;
-  pinocchio::cholesky::decompose(model_, data_);
+  pinocchio::cholesky::decompose(*model_, data_);
+  if (dimf == 0) return;
   data_.sDUiJt.leftCols(dimf) = J.transpose();
-  pinocchio::cholesky::Uiv(model_, data_, data_.sDUiJt.leftCols(dimf));
+  pinocchio::cholesky::Uiv(*model_, data_, data_.sDUiJt.leftCols(dimf));
   for (Eigen::DenseIndex k=0; k<dimv_; ++k) {
     data_.sDUiJt.leftCols(dimf).row(k) /= std::sqrt(data_.D[k]);
   }
-  data_.JMinvJt.topLeftCorner(dimf, dimf).noalias() 
+  Eigen::Ref<Eigen::MatrixXd> JMinvJt = data_.JMinvJt.topLeftCorner(dimf, dimf);
+  JMinvJt.noalias() 
       = data_.sDUiJt.leftCols(dimf).transpose() * data_.sDUiJt.leftCols(dimf);
   if (info_.contact_inv_damping > 0.) {
-    data_.JMinvJt.diagonal().array() += info_.contact_inv_damping;
-  }
-  data_.llt_JMinvJt.compute(data_.JMinvJt.topLeftCorner(dimf, dimf));
-  assert(data_.llt_JMinvJt.info() == Eigen::Success);
-  Eigen::Block<MatrixType3> topLeft 
-      = const_cast<Eigen::MatrixBase<MatrixType3>&>(MJtJinv).topLeftCorner(dimv_, dimv_);
-  Eigen::Block<MatrixType3> topRight 
-      = const_cast<Eigen::MatrixBase<MatrixType3>&>(MJtJinv).topRightCorner(dimv_, dimf);
-  Eigen::Block<MatrixType3> bottomLeft 
-      = const_cast<Eigen::MatrixBase<MatrixType3>&>(MJtJinv).bottomLeftCorner(dimf, dimv_);
-  Eigen::Block<MatrixType3> bottomRight 
-      = const_cast<Eigen::MatrixBase<MatrixType3>&>(MJtJinv).bottomRightCorner(dimf, dimf);
-  bottomRight = - pinocchio::Data::MatrixXs::Identity(dimf, dimf);
-  topLeft.setIdentity();
-  data_.llt_JMinvJt.solveInPlace(bottomRight);
-  pinocchio::cholesky::solve(model_, data_, topLeft);
-  bottomLeft.noalias() = J * topLeft;
-  topRight.noalias() = bottomLeft.transpose() * (-bottomRight);
-  topLeft.noalias() -= topRight*bottomLeft;
-  bottomLeft = topRight.transpose();
+    JMinvJt.diagonal().array() += info_.contact_inv_damping;
+  }
+  // in-place factorization: the lower triangle of JMinvJt is overwritten by L
+  const Eigen::LLT<Eigen::Ref<Eigen::MatrixXd>> llt_JMinvJt(JMinvJt);
+  assert(llt_JMinvJt.info() == Eigen::Success);
+}
+
+
+template <int Dimf, typename MatrixType1, typename MatrixType2>
+inline void Robot::factorizeMJtJ(const Eigen::MatrixBase<MatrixType1>& M,
+                                 const Eigen::MatrixBase<MatrixType2>& J) {
+  static_assert(Dimf > 0, "Dimf must be positive");
+  assert(M.rows() == dimv_);
+  assert(M.cols() == dimv_);
+  assert(J.rows() == Dimf);
+  assert(J.rows() <= max_dimf_);
+  assert(J.cols() == dimv_);
+  using MatrixDimf = Eigen::Matrix<double, Dimf, Dimf>;
+  data_.M = M;
+  pinocchio::cholesky::decompose(*model_, data_);
+  data_.sDUiJt.template leftCols<Dimf>() = J.transpose();
+  pinocchio::cholesky::Uiv(*model_, data_, data_.sDUiJt.template leftCols<Dimf>());
+  for (Eigen::DenseIndex k=0; k<dimv_; ++k) {
+    data_.sDUiJt.template leftCols<Dimf>().row(k) /= std::sqrt(data_.D[k]);
+  }
+  MatrixDimf JMinvJt;
+  JMinvJt.noalias() = data_.sDUiJt.template leftCols<Dimf>().transpose()
+                        * data_.sDUiJt.template leftCols<Dimf>();
+  if (info_.contact_inv_damping > 0.) {
+    JMinvJt.diagonal().array() += info_.contact_inv_damping;
+  }
+  const Eigen::LLT<MatrixDimf> llt_JMinvJt(JMinvJt);
+  assert(llt_JMinvJt.info() == Eigen::Success);
+  data_.JMinvJt.template topLeftCorner<Dimf, Dimf>() = llt_JMinvJt.matrixLLT();
+}
+
+
+template <typename MatrixType1, typename MatrixType2, typename MatrixType3>
+inline void Robot::computeMJtJinv(
+    const Eigen::MatrixBase<MatrixType1>& M, 
+    const Eigen::MatrixBase<MatrixType2>& J, 
+    const Eigen::MatrixBase<MatrixType3>& MJtJinv) {
+  assert(MJtJinv.rows() == M.rows()+J.rows());
+  assert(MJtJinv.cols() == M.rows()+J.rows());
+  factorizeMJtJ(M, J);
+  const_cast<Eigen::MatrixBase<MatrixType3>&>(MJtJinv).setIdentity();
+  solveMJtJ(MJtJinv);
   assert(!MJtJinv.hasNaN());
 }
 
 
+template <typename MatrixType>
+inline void Robot::solveMJtJ(const Eigen::MatrixBase<MatrixType>& X) const {
+  solveMJtJ(data_.U, data_.D, data_.sDUiJt, data_.JMinvJt, X);
+}
+
+
+template <typename MatrixType>
+inline void Robot::solveMJtJ(const Eigen::MatrixXd& U, const Eigen::VectorXd& D, 
+                             const Eigen::MatrixXd& sDUiJt, 
+                             const Eigen::MatrixXd& L,
+                             const Eigen::MatrixBase<MatrixType>& X) const {
+  assert(U.rows() == dimv_);
+  assert(U.cols() == dimv_);
+  assert(D.size() == dimv_);
+  assert(sDUiJt.rows() == dimv_);
+  assert(X.rows() >= dimv_);
+  const int dimf = X.rows() - dimv_;
+  assert(sDUiJt.cols() >= dimf);
+  assert(L.rows() >= dimf);
+  assert(L.cols() >= dimf);
+  auto Xv = const_cast<Eigen::MatrixBase<MatrixType>&>(X).topRows(dimv_);
+  auto Xf = const_cast<Eigen::MatrixBase<MatrixType>&>(X).bottomRows(dimf);
+  // The nonzeros of U in row k are restricted to the subtree rooted at k.
+  const std::vector<int>& nvSubtree = data_.nvSubtree_fromRow;
+  // w = D^{-1/2} U^{-1} b
+  for (int k=dimv_-2; k>=0; --k) {
+    const int nvt = nvSubtree[k] - 1;
+    Xv.row(k).noalias() 
+        -= U.row(k).segment(k+1, nvt) * Xv.middleRows(k+1, nvt);
+  }
+  for (Eigen::DenseIndex k=0; k<dimv_; ++k) {
+    Xv.row(k) /= std::sqrt(D[k]);
+  }
+  if (dimf > 0) {
+    // y = (J M^{-1} J^T)^{-1} (J M^{-1} b - c) = L^{-T} L^{-1} (S^T w - c)
+    Xf = - Xf;
+    Xf.noalias() += sDUiJt.leftCols(dimf).transpose() * Xv;
+    const auto Lf = L.topLeftCorner(dimf, dimf);
+    Lf.template triangularView<Eigen::Lower>().solveInPlace(Xf);
+    Lf.transpose().template triangularView<Eigen::Upper>().solveInPlace(Xf);
+    // x = M^{-1} (b - J^T y)
+    Xv.noalias() -= sDUiJt.leftCols(dimf) * Xf;
+  }
+  for (Eigen::DenseIndex k=0; k<dimv_; ++k) {
+    Xv.row(k) /= std::sqrt(D[k]);
+  }
+  for (int k=0; k<dimv_-1; ++k) {
+    const int nvt = nvSubtree[k] - 1;
+    Xv.middleRows(k+1, nvt).noalias() 
+        -= U.row(k).segment(k+1, nvt).transpose() * Xv.row(k);
+  }
+}
+
+
 template <typename ConfigVectorType>
 inline void Robot::normalizeConfiguration(
     const Eigen::MatrixBase<ConfigVectorType>& q) const {
@@ -693,7 +801,7 @@ inline void Robot::normalizeConfiguration(
           <= std::numeric_limits<double>::epsilon()) {
       (const_cast<Eigen::MatrixBase<ConfigVectorType>&> (q)).coeffRef(3) = 1;
     }
-    pinocchio::normalize(model_, 
+    pinocchio::normalize(*model_, 
                          const_cast<Eigen::MatrixBase<ConfigVectorType>&>(q));
   }
 }
@@ -3,6 +3,9 @@
 
 #include <string>
 #include <vector>
+#include <map>
+
+#include "Eigen/Core"
 
 #include "robotoc/robot/contact_model_info.hpp"
 
@@ -94,6 +97,25 @@ struct RobotModelInfo {
   ///
   double contact_inv_damping = 0.0;
 
+  ///
+  /// @brief Directory of the binary model cache. If not empty, the model 
+  /// built from the URDF is serialized into this directory and is directly 
+  /// loaded in the later constructions of Robot instead of parsing the URDF. 
+  /// The cache file is keyed by the URDF path, the hash of the URDF content, 
+  /// and the base joint type. Default is empty, i.e., no cache is used.
+  ///
+  std::string model_cache_dir;
+
+  ///
+  /// @brief Joints locked at the given configurations. The key is the name 
+  /// of the joint and the value is its configuration, whose size must be the 
+  /// dimension of the configuration of the joint. The locked joints are 
+  /// removed from the model by pinocchio::buildReducedModel, i.e., dimq, 
+  /// dimv, and dimu of Robot are reduced accordingly. The base joint cannot 
+  /// be locked. Default is empty.
+  ///
+  std::map<std::string, Eigen::VectorXd> locked_joints;
+
   ///
   /// @brief Creates a simple robot manipulator model info.
   /// @param[in] urdf_path Path to the URDF file.
@@ -6,10 +6,14 @@ namespace robotoc {
 /// 
 /// @enum InterpolationOrder
 /// @brief Order of the interpolation.
+/// LQRRollout is the linear interpolation of the previous solution that is 
+/// corrected by rolling out the previous LQR policy from the newly measured
+/// initial state through the previous linearized dynamics.
 ///
 enum class InterpolationOrder {
   Linear,
   Zero,
+  LQRRollout,
 };
 
 } // namespace robotoc
@@ -0,0 +1,126 @@
+#ifndef ROBOTOC_MESH_REFINER_HPP_
+#define ROBOTOC_MESH_REFINER_HPP_
+
+#include <vector>
+
+#include "robotoc/core/split_solution.hpp"
+#include "robotoc/core/solution.hpp"
+#include "robotoc/ocp/grid_info.hpp"
+#include "robotoc/ocp/time_discretization.hpp"
+
+
+namespace robotoc {
+
+///
+/// @class MeshRefiner
+/// @brief Error-driven local mesh refinement of the switching time
+/// optimization (STO) problem. The local integration error of the forward
+/// Euler discretization is estimated on each stage and the number of grids
+/// of each contact phase is increased or decreased so that the maximum
+/// error estimate in the phase lies in [coarsening_ratio*tol, tol].
+///
+class MeshRefiner {
+public:
+  ///
+  /// @brief Constructor.
+  /// @param[in] tol Tolerance of the local integration error estimate.
+  /// Must be positive. Default is 1.0e-03.
+  /// @param[in] coarsening_ratio Contact phases whose maximum error estimate
+  /// is less than coarsening_ratio*tol are coarsened. Must be in [0, 1).
+  /// Default is 0.1.
+  ///
+  MeshRefiner(const double tol=1.0e-03, const double coarsening_ratio=0.1);
+
+  ///
+  /// @brief Default destructor.
+  ///
+  ~MeshRefiner() = default;
+
+  ///
+  /// @brief Default copy constructor.
+  ///
+  MeshRefiner(const MeshRefiner&) = default;
+
+  ///
+  /// @brief Default copy assign operator.
+  ///
+  MeshRefiner& operator=(const MeshRefiner&) = default;
+
+  ///
+  /// @brief Default move constructor.
+  ///
+  MeshRefiner(MeshRefiner&&) noexcept = default;
+
+  ///
+  /// @brief Default move assign operator.
+  ///
+  MeshRefiner& operator=(MeshRefiner&&) noexcept = default;
+
+  ///
+  /// @brief Sets the tolerances.
+  /// @param[in] tol Tolerance of the local integration error estimate.
+  /// Must be positive.
+  /// @param[in] coarsening_ratio Contact phases whose maximum error estimate
+  /// is less than coarsening_ratio*tol are coarsened. Must be in [0, 1).
+  ///
+  void setTolerance(const double tol, const double coarsening_ratio);
+
+  ///
+  /// @brief Estimates the local integration errors and computes the number
+  /// of grids of each contact phase.
+  /// @param[in] time_discretization Time discretization.
+  /// @param[in] s Solution.
+  /// @param[in] max_dt Maximum time step. If positive, the number of grids
+  /// of each phase is chosen so that the time step does not exceed this value.
+  /// @return true if the number of grids of any contact phase changed.
+  /// false if not.
+  ///
+  bool refine(const TimeDiscretization& time_discretization,
+              const Solution& s, const double max_dt=0);
+
+  ///
+  /// @brief Gets the number of grids of each contact phase computed at the
+  /// last call of refine().
+  /// @return const reference to the number of grids of each contact phase.
+  ///
+  const std::vector<int>& numGridsInPhase() const {
+    return num_grids_in_phase_;
+  }
+
+  ///
+  /// @brief Gets the maximum error estimate of each contact phase computed
+  /// at the last call of refine().
+  /// @return const reference to the maximum error estimate of each phase.
+  ///
+  const std::vector<double>& phaseErrors() const {
+    return phase_error_;
+  }
+
+  ///
+  /// @brief Estimates the local integration error of the forward Euler
+  /// discretization over a stage, i.e.,
+  /// 0.5 * dt * (dt * ||a|| + ||a_next - a||), where the norms are the
+  /// infinity norms.
+  /// @param[in] grid_info Grid info of the stage.
+  /// @param[in] s Split solution of the stage.
+  /// @param[in] grid_info_next Grid info of the next stage.
+  /// @param[in] s_next Split solution of the next stage. The acceleration
+  /// is only used if the next stage is an intermediate stage in the same
+  /// contact phase.
+  /// @return Local integration error estimate.
+  ///
+  static double estimateError(const GridInfo& grid_info,
+                              const SplitSolution& s,
+                              const GridInfo& grid_info_next,
+                              const SplitSolution& s_next);
+
+private:
+  double tol_, coarsening_ratio_;
+  std::vector<int> num_grids_in_phase_;
+  std::vector<double> phase_error_, phase_duration_;
+
+};
+
+} // namespace robotoc
+
+#endif // ROBOTOC_MESH_REFINER_HPP_
\ No newline at end of file
@@ -19,6 +19,7 @@
 #include "robotoc/core/kkt_matrix.hpp"
 #include "robotoc/core/kkt_residual.hpp"
 #include "robotoc/ocp/direct_multiple_shooting.hpp"
+#include "robotoc/ocp/move_blocking.hpp"
 #include "robotoc/riccati/riccati_recursion.hpp"
 #include "robotoc/riccati/riccati_factorization.hpp"
 #include "robotoc/line_search/line_search.hpp"
@@ -27,6 +28,7 @@
 #include "robotoc/sto/sto_cost_function.hpp"
 #include "robotoc/sto/sto_constraints.hpp"
 #include "robotoc/solver/solution_interpolator.hpp"
+#include "robotoc/solver/mesh_refiner.hpp"
 #include "robotoc/solver/solver_options.hpp"
 #include "robotoc/solver/solver_statistics.hpp"
 #include "robotoc/utils/timer.hpp"
@@ -147,6 +149,10 @@ public:
   ///
   /// @brief Gets of the local LQR policies over the horizon. 
   /// @return const reference to the local LQR policies.
+  /// @remark With the move blocking, the policy of each blocked grid (see 
+  /// getMoveBlocking()) is a copy of that of the first grid of the block. 
+  /// Its feedback gain therefore maps the state deviation at the first grid 
+  /// of the block, not at the blocked grid itself.
   ///
   const aligned_vector<LQRPolicy>& getLQRPolicy() const;
 
@@ -158,13 +164,15 @@ public:
   const RiccatiFactorization& getRiccatiFactorization() const;
 
   ///
-  /// @brief Sets the solution guess over the horizon. 
+  /// @brief Sets the solution guess over the horizon. The solution of the 
+  /// previous solve is kept for the interpolation of the next solve.
   /// @param[in] s Solution. 
   ///
   void setSolution(const Solution& s);
 
   ///
-  /// @brief Sets the solution guess over the horizon. 
+  /// @brief Sets the solution guess over the horizon. The solution of the 
+  /// previous solve is kept for the interpolation of the next solve.
   /// @param[in] name Name of the variable. 
   /// @param[in] value Value of the specified variable. 
   ///
@@ -196,6 +204,13 @@ public:
   ///
   const TimeDiscretization& getTimeDiscretization() const;
 
+  ///
+  /// @brief Gets the move blocking, i.e., which grids have the control input
+  /// tied to that of the previous grid, on the current time discretization. 
+  /// @return Returns const reference to the move blocking. 
+  ///
+  const MoveBlocking& getMoveBlocking() const;
+
   ///
   ///
   /// @brief Sets a collection of the properties for robot model in this solver. 
@@ -215,6 +230,7 @@ private:
   aligned_vector<Robot> robots_;
   std::shared_ptr<ContactSequence> contact_sequence_;
   TimeDiscretization time_discretization_;
+  MoveBlocking move_blocking_;
   DirectMultipleShooting dms_;
   SwitchingTimeOptimization sto_;
   RiccatiRecursion riccati_recursion_;
@@ -226,9 +242,11 @@ private:
   Direction d_;
   RiccatiFactorization riccati_factorization_;
   SolutionInterpolator solution_interpolator_;
+  MeshRefiner mesh_refiner_;
   SolverOptions solver_options_;
   SolverStatistics solver_statistics_;
   Timer timer_;
+  bool update_all_contact_status_;
 
   ///
   /// @brief Performs single Newton-type iteration and updates the solution.
@@ -241,8 +259,39 @@ private:
   void updateSolution(const double t, const Eigen::VectorXd& q, 
                       const Eigen::VectorXd& v);
 
+  ///
+  /// @brief Performs the local mesh-refinement based on the local integration 
+  /// error estimates. 
+  /// @param[in] t Initial time of the horizon. 
+  /// @return true if the mesh is refined. false if not.
+  ///
+  bool refineMesh(const double t);
+
+  ///
+  /// @brief Rolls out the LQR policy of the previous solve from the initial 
+  /// state through the linearized dynamics of the previous solve and 
+  /// corrects the previous solution by the resultant state and control input
+  /// deviations. The solution stored in the solution interpolator is 
+  /// corrected in place so that the corrected one is interpolated.
+  /// @param[in] t Initial time of the horizon. 
+  /// @param[in] q Initial configuration. Size must be Robot::dimq().
+  /// @param[in] v Initial velocity. Size must be Robot::dimv().
+  ///
+  void rolloutLQRPolicy(const double t, const Eigen::VectorXd& q, 
+                        const Eigen::VectorXd& v);
+
   void resizeData();
 
+  ///
+  /// @brief Sets the contact status and the switching constraint dimension of
+  /// the solution according to the current time discretization. 
+  /// @param[in] all_grids If true, updates all the grids. If false, updates 
+  /// only the grids whose structure changed at the last discretization 
+  /// (see TimeDiscretization::isStructureChanged()), or all the grids if the
+  /// solution has been replaced by setSolution() since the last update.
+  ///
+  void setContactStatus(const bool all_grids);
+
 };
 
 } // namespace robotoc 
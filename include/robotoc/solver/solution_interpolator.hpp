@@ -1,6 +1,8 @@
 #ifndef ROBOTOC_SOLUTION_INTERPOLATOR_HPP_
 #define ROBOTOC_SOLUTION_INTERPOLATOR_HPP_
 
+#include <algorithm>
+
 #include "robotoc/robot/robot.hpp"
 #include "robotoc/core/solution.hpp"
 #include "robotoc/ocp/time_discretization.hpp"
@@ -50,22 +52,51 @@ public:
   void setInterpolationOrder(const InterpolationOrder order);
 
   ///
-  /// @brief Stores the current time discretization and solution. 
+  /// @brief Stores the current time discretization and a copy of the 
+  /// solution. 
   /// @param[in] time_discretization Time discretization. 
-  /// @param[out] solution Solution. 
+  /// @param[in] solution Solution. 
   ///
   void store(const TimeDiscretization& time_discretization,
              const Solution& solution);
 
   ///
-  /// @brief Interpolates the solution. 
+  /// @brief Stores the current time discretization and the contact status 
+  /// and switching constraint dimension of the solution without copying the 
+  /// values of the solution. The solution passed to the next call of 
+  /// interpolate() is then regarded as the stored solution and is swapped 
+  /// with the internal buffer there. The values of the solution therefore 
+  /// must not be modified until interpolate() is called, while its contact 
+  /// status and switching constraint dimension can be updated. Call 
+  /// detachStoredSolution() before modifying the values otherwise. 
+  /// Modifications that are meant to be interpolated, e.g., the LQR rollout 
+  /// of OCPSolver, can be applied to the solution directly.
+  /// @param[in] time_discretization Time discretization. 
+  /// @param[in] solution Solution. 
+  ///
+  void storeBySwap(const TimeDiscretization& time_discretization,
+                   const Solution& solution);
+
+  ///
+  /// @brief Copies the values of the solution passed to storeBySwap() into 
+  /// the internal buffer so that the solution can be modified without 
+  /// changing the stored solution. Does nothing if the stored solution has 
+  /// been stored by store() or already been swapped by interpolate().
+  /// @param[in] solution Solution passed to storeBySwap(). 
+  ///
+  void detachStoredSolution(const Solution& solution);
+
+  ///
+  /// @brief Interpolates the solution. The contact status and the switching
+  /// constraint dimension of the interpolated solution are not updated 
+  /// according to time_discretization and must be set by the caller. 
   /// @param[in] robot Robot model.
   /// @param[in] time_discretization Time discretization. 
-  /// @param[out] solution Solution. 
+  /// @param[in, out] solution Solution. 
   ///
   void interpolate(const Robot& robot, 
                    const TimeDiscretization& time_discretization, 
-                   Solution& solution) const;
+                   Solution& solution);
 
   ///
   /// @brief Check if this has a stored solution. 
@@ -76,49 +107,71 @@ public:
 private:
   InterpolationOrder order_;
   TimeDiscretization stored_time_discretization_;
-  Solution stored_solution_;
+  Solution stored_solution_, stored_contact_status_;
   bool has_stored_solution_;
 
-  int findStoredGridIndexAtImpactByTime(const double t) const {
-    const int N = stored_time_discretization_.size() - 1;
-    constexpr double eps = 1.0e-06;
-    for (int i=1; i<N; ++i) {
-      if ((stored_time_discretization_[i].type == GridType::Impact)
-            && (numerics::isApprox(t, stored_time_discretization_[i].t, eps))) {
-        return i;
+  bool swap_stored_solution_;
+
+  ///
+  /// @brief Binary search of the stored grids. 
+  /// @param[in] t Time. 
+  /// @return The largest index of the stored grids whose time is not greater 
+  /// than t. -1 if t is before the initial grid. 
+  ///
+  int upperStoredGridIndex(const double t) const {
+    if (t < stored_time_discretization_[0].t) return -1;
+    int lower = 0;
+    int upper = stored_time_discretization_.size();
+    // invariant: stored[lower].t <= t < stored[upper].t
+    while (upper - lower > 1) {
+      const int middle = (lower + upper) / 2;
+      if (stored_time_discretization_[middle].t <= t) {
+        lower = middle;
+      }
+      else {
+        upper = middle;
       }
     }
-    return -1;
+    return lower;
   }
 
-  int findStoredGridIndexAtLiftByTime(const double t) const {
+  int findStoredGridIndexAtEventByTime(const GridType type, 
+                                       const double t) const {
     const int N = stored_time_discretization_.size() - 1;
     constexpr double eps = 1.0e-06;
-    for (int i=1; i<N; ++i) {
-      if ((stored_time_discretization_[i].type == GridType::Lift)
+    int index = -1;
+    for (int i=std::min(upperStoredGridIndex(t+eps), N-1); i>=1; --i) {
+      if (stored_time_discretization_[i].t <= t-eps) break;
+      if ((stored_time_discretization_[i].type == type)
             && (numerics::isApprox(t, stored_time_discretization_[i].t, eps))) {
-        return i;
+        index = i;
       }
     }
-    return -1;
+    return index;
+  }
+
+  int findStoredGridIndexAtImpactByTime(const double t) const {
+    return findStoredGridIndexAtEventByTime(GridType::Impact, t);
+  }
+
+  int findStoredGridIndexAtLiftByTime(const double t) const {
+    return findStoredGridIndexAtEventByTime(GridType::Lift, t);
   }
 
   int findStoredGridIndexBeforeTime(const double t) const {
-    if (t < stored_time_discretization_[0].t) return -1;
     const int N = stored_time_discretization_.size() - 1;
-    for (int i=0; i<N; ++i) {
-      if (t < stored_time_discretization_[i+1].t) {
-        if (stored_time_discretization_[i].type == GridType::Impact) {
-          return i+1;
-        }
-        else {
-          return i;
-        }
-      }
+    const int i = upperStoredGridIndex(t);
+    if ((i >= 0) && (i < N) 
+          && (stored_time_discretization_[i].type == GridType::Impact)) {
+      return i+1;
     }
-    return N;
+    return i;
   }
 
+  void swapStoredSolution(Solution& solution);
+
+  void restoreStoredContactStatus();
+
   static void interpolate(const Robot& robot, const SplitSolution& s1, 
                           const SplitSolution& s2, const double alpha, 
                           SplitSolution& s);
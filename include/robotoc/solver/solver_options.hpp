@@ -118,6 +118,29 @@ struct SolverOptions {
   ///
   double max_dt_mesh = 0.0;
 
+  ///
+  /// @brief If true, the mesh-refinement in the STO problem is performed 
+  /// locally based on the local integration error estimate of each stage 
+  /// (see MeshRefiner) instead of the uniform re-discretization. The new grids 
+  /// are warm-started by the solution interpolation and the slack and dual 
+  /// variables of the unchanged grids are kept. If max_dt_mesh is positive, 
+  /// it is used as the upper bound of the time steps. Default is false.
+  ///
+  bool enable_adaptive_mesh_refinement = false;
+
+  ///
+  /// @brief Tolerance of the local integration error estimate in the adaptive 
+  /// mesh-refinement. Must be positive. Default is 1.0e-03.
+  ///
+  double mesh_refinement_tol = 1.0e-03;
+
+  ///
+  /// @brief Contact phases whose local integration error estimates are less 
+  /// than mesh_coarsening_ratio*mesh_refinement_tol are coarsened in the 
+  /// adaptive mesh-refinement. Must be in [0, 1). Default is 0.1.
+  ///
+  double mesh_coarsening_ratio = 0.1;
+
   ///
   /// @brief Maximum magnitude of the nominal direction of the switching time 
   /// computed by the Riccati recursion algorithm. Used in a heuristic 
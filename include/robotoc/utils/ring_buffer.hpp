@@ -0,0 +1,222 @@
+#ifndef ROBOTOC_RING_BUFFER_HPP_
+#define ROBOTOC_RING_BUFFER_HPP_
+
+#include <vector>
+#include <iterator>
+#include <cstddef>
+#include <cassert>
+
+#include "Eigen/StdVector"
+
+
+namespace robotoc {
+
+///
+/// @class RingBuffer
+/// @brief Fixed-capacity double-ended queue on a contiguous circular storage.
+/// The elements of the storage are constructed once and are reused by copy
+/// assignment afterwards, so that push_back(), pop_back(), and pop_front()
+/// do not allocate memory as long as the size does not exceed the capacity.
+/// If it does, the capacity is doubled.
+/// @tparam T Type of the element.
+///
+template <typename T>
+class RingBuffer {
+private:
+  using Storage = std::vector<T, Eigen::aligned_allocator<T>>;
+
+public:
+  using value_type = T;
+  using reference = typename Storage::reference;
+  using const_reference = typename Storage::const_reference;
+  using size_type = std::size_t;
+
+  ///
+  /// @class ConstIterator
+  /// @brief Forward iterator over the elements from the front to the back.
+  ///
+  class ConstIterator {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T*;
+    using reference = typename Storage::const_reference;
+
+    ConstIterator(const RingBuffer* buffer, const size_type index)
+      : buffer_(buffer), index_(index) {}
+
+    reference operator*() const { return (*buffer_)[index_]; }
+
+    ConstIterator& operator++() { ++index_; return *this; }
+
+    ConstIterator operator++(int) {
+      ConstIterator tmp = *this; ++index_; return tmp;
+    }
+
+    bool operator==(const ConstIterator& other) const {
+      return (buffer_ == other.buffer_ && index_ == other.index_);
+    }
+
+    bool operator!=(const ConstIterator& other) const {
+      return !(*this == other);
+    }
+
+  private:
+    const RingBuffer* buffer_;
+    size_type index_;
+  };
+
+  using const_iterator = ConstIterator;
+
+  ///
+  /// @brief Constructor.
+  /// @param[in] capacity Capacity of the buffer.
+  /// @param[in] value Value used to construct the elements of the storage.
+  /// Default is T().
+  ///
+  explicit RingBuffer(const size_type capacity, const T& value=T())
+    : data_(capacity, value),
+      head_(0),
+      size_(0) {
+  }
+
+  ///
+  /// @brief Default constructor.
+  ///
+  RingBuffer()
+    : data_(),
+      head_(0),
+      size_(0) {
+  }
+
+  ///
+  /// @brief Default destructor.
+  ///
+  ~RingBuffer() = default;
+
+  ///
+  /// @brief Default copy constructor.
+  ///
+  RingBuffer(const RingBuffer&) = default;
+
+  ///
+  /// @brief Default copy assign operator.
+  ///
+  RingBuffer& operator=(const RingBuffer&) = default;
+
+  ///
+  /// @brief Default move constructor.
+  ///
+  RingBuffer(RingBuffer&&) noexcept = default;
+
+  ///
+  /// @brief Default move assign operator.
+  ///
+  RingBuffer& operator=(RingBuffer&&) noexcept = default;
+
+  ///
+  /// @brief Appends an element to the back by copy assignment to the
+  /// existing storage.
+  /// @param[in] value Value of the appended element.
+  ///
+  void push_back(const T& value) {
+    if (size_ == data_.size()) {
+      grow(value);
+    }
+    data_[physicalIndex(size_)] = value;
+    ++size_;
+  }
+
+  ///
+  /// @brief Removes the back element. The storage is retained.
+  ///
+  void pop_back() {
+    assert(size_ > 0);
+    --size_;
+  }
+
+  ///
+  /// @brief Removes the front element. The storage is retained.
+  ///
+  void pop_front() {
+    assert(size_ > 0);
+    head_ = physicalIndex(1);
+    --size_;
+  }
+
+  ///
+  /// @brief Removes all the elements. The storage is retained.
+  ///
+  void clear() {
+    head_ = 0;
+    size_ = 0;
+  }
+
+  ///
+  /// @brief Reserves the storage. Does nothing if capacity is not larger
+  /// than the current capacity.
+  /// @param[in] capacity The reserved capacity.
+  ///
+  void reserve(const size_type capacity) {
+    if (capacity > data_.size()) {
+      relocate(capacity, data_.empty() ? T() : data_[physicalIndex(0)]);
+    }
+  }
+
+  reference operator[](const size_type i) {
+    assert(i < size_);
+    return data_[physicalIndex(i)];
+  }
+
+  const_reference operator[](const size_type i) const {
+    assert(i < size_);
+    return data_[physicalIndex(i)];
+  }
+
+  reference front() { return (*this)[0]; }
+
+  const_reference front() const { return (*this)[0]; }
+
+  reference back() { return (*this)[size_-1]; }
+
+  const_reference back() const { return (*this)[size_-1]; }
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+
+  const_iterator end() const { return const_iterator(this, size_); }
+
+  size_type size() const { return size_; }
+
+  size_type capacity() const { return data_.size(); }
+
+  bool empty() const { return (size_ == 0); }
+
+private:
+  Storage data_;
+  size_type head_, size_;
+
+  size_type physicalIndex(const size_type i) const {
+    const size_type index = head_ + i;
+    return (index < data_.size()) ? index : (index - data_.size());
+  }
+
+  void grow(const T& value) {
+    relocate((data_.empty() ? 1 : 2*data_.size()), value);
+  }
+
+  void relocate(const size_type capacity, const T& value) {
+    assert(capacity > data_.size());
+    Storage data(capacity, value);
+    for (size_type i=0; i<size_; ++i) {
+      data[i] = data_[physicalIndex(i)];
+    }
+    data_.swap(data);
+    head_ = 0;
+  }
+
+};
+
+} // namespace robotoc
+
+#endif // ROBOTOC_RING_BUFFER_HPP_
\ No newline at end of file
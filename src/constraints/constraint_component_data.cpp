@@ -1,6 +1,9 @@
 #include "robotoc/constraints/constraint_component_data.hpp"
 
 #include <cmath>
+#include <new>
+#include <algorithm>
+#include <utility>
 #include <stdexcept>
 #include <iostream>
 
@@ -9,17 +12,22 @@ namespace robotoc {
 
 ConstraintComponentData::ConstraintComponentData(const int dimc,
                                                  const double barrier_param)
-  : slack(Eigen::VectorXd::Constant(dimc, std::sqrt(barrier_param))),
-    dual(Eigen::VectorXd::Constant(dimc, std::sqrt(barrier_param))),
-    residual(Eigen::VectorXd::Zero(dimc)),
-    cmpl(Eigen::VectorXd::Zero(dimc)),
-    dslack(Eigen::VectorXd::Zero(dimc)),
-    ddual(Eigen::VectorXd::Zero(dimc)),
-    cond(Eigen::VectorXd::Zero(dimc)),
+  : slack(nullptr, 0),
+    dual(nullptr, 0),
+    residual(nullptr, 0),
+    cmpl(nullptr, 0),
+    dslack(nullptr, 0),
+    ddual(nullptr, 0),
+    cond(nullptr, 0),
     log_barrier(0),
     r(),
     J(),
-    dimc_(dimc) {
+    dimc_(dimc),
+    stride_(0),
+    storage_(),
+    extra_data_(),
+    extra_vector_layout_(),
+    extra_matrix_layout_() {
   if (dimc <= 0) {
     throw std::out_of_range(
         "[ConstraintComponentData] invalid argment: 'dimc' must be positive!");
@@ -28,33 +36,180 @@ ConstraintComponentData::ConstraintComponentData(const int dimc,
     throw std::out_of_range(
         "[ConstraintComponentData] invalid argment: 'barrier_param' must be positive!");
   }
+  storage_.setZero(numBufferVectors()*dimc);
+  bindVectors(storage_.data(), dimc);
+  slack.fill(std::sqrt(barrier_param));
+  dual.fill(std::sqrt(barrier_param));
 }
 
 
 ConstraintComponentData::ConstraintComponentData()
-  : slack(),
-    dual(),
-    residual(),
-    cmpl(),
-    dslack(),
-    ddual(),
-    cond(),
+  : slack(nullptr, 0),
+    dual(nullptr, 0),
+    residual(nullptr, 0),
+    cmpl(nullptr, 0),
+    dslack(nullptr, 0),
+    ddual(nullptr, 0),
+    cond(nullptr, 0),
     log_barrier(0),
     r(),
     J(),
-    dimc_(0) {
+    dimc_(0),
+    stride_(0),
+    storage_(),
+    extra_data_(),
+    extra_vector_layout_(),
+    extra_matrix_layout_() {
+}
+
+
+ConstraintComponentData::ConstraintComponentData(
+    const ConstraintComponentData& other)
+  : slack(nullptr, 0),
+    dual(nullptr, 0),
+    residual(nullptr, 0),
+    cmpl(nullptr, 0),
+    dslack(nullptr, 0),
+    ddual(nullptr, 0),
+    cond(nullptr, 0),
+    log_barrier(other.log_barrier),
+    r(other.r),
+    J(other.J),
+    dimc_(other.dimc_),
+    stride_(0),
+    storage_(Eigen::VectorXd::Zero(numBufferVectors()*other.dimc_)),
+    extra_data_(other.extra_data_),
+    extra_vector_layout_(other.extra_vector_layout_),
+    extra_matrix_layout_(other.extra_matrix_layout_) {
+  bindVectors(storage_.data(), dimc_);
+  copyVectors(other);
+}
+
+
+ConstraintComponentData& ConstraintComponentData::operator=(
+    const ConstraintComponentData& other) {
+  if (this == &other) {
+    return *this;
+  }
+  if (dimc_ != other.dimc_) {
+    dimc_ = other.dimc_;
+    storage_.resize(numBufferVectors()*dimc_);
+    bindVectors(storage_.data(), dimc_);
+  }
+  copyVectors(other);
+  copyExtraData(other);
+  return *this;
+}
+
+
+ConstraintComponentData::ConstraintComponentData(
+    ConstraintComponentData&& other) noexcept
+  : slack(nullptr, 0),
+    dual(nullptr, 0),
+    residual(nullptr, 0),
+    cmpl(nullptr, 0),
+    dslack(nullptr, 0),
+    ddual(nullptr, 0),
+    cond(nullptr, 0),
+    log_barrier(other.log_barrier),
+    r(std::move(other.r)),
+    J(std::move(other.J)),
+    dimc_(other.dimc_),
+    stride_(0),
+    storage_(std::move(other.storage_)),
+    extra_data_(std::move(other.extra_data_)),
+    extra_vector_layout_(std::move(other.extra_vector_layout_)),
+    extra_matrix_layout_(std::move(other.extra_matrix_layout_)) {
+  // The views keep pointing to the moved storage or to the external buffer.
+  bindVectors(other.slack.data(), other.stride_);
+  other.dimc_ = 0;
+  other.storage_.resize(0);
+  other.bindVectors(nullptr, 0);
+}
+
+
+ConstraintComponentData& ConstraintComponentData::operator=(
+    ConstraintComponentData&& other) noexcept {
+  if (this == &other) {
+    return *this;
+  }
+  if (isBoundToBuffer() && dimc_ == other.dimc_) {
+    copyVectors(other);
+  }
+  else {
+    dimc_ = other.dimc_;
+    storage_ = std::move(other.storage_);
+    bindVectors(other.slack.data(), other.stride_);
+    other.dimc_ = 0;
+    other.storage_.resize(0);
+    other.bindVectors(nullptr, 0);
+  }
+  log_barrier = other.log_barrier;
+  r = std::move(other.r);
+  J = std::move(other.J);
+  extra_data_ = std::move(other.extra_data_);
+  extra_vector_layout_ = std::move(other.extra_vector_layout_);
+  extra_matrix_layout_ = std::move(other.extra_matrix_layout_);
+  return *this;
 }
 
 
 void ConstraintComponentData::resize(const int dimc) {
   assert(dimc >= 0);
-  slack.conservativeResize(dimc);
-  dual.conservativeResize(dimc);
-  residual.resize(dimc);
-  cmpl.resize(dimc);
-  dslack.resize(dimc);
-  ddual.resize(dimc);
-  cond.resize(dimc);
+  if (dimc == dimc_ && !isBoundToBuffer()) {
+    return;
+  }
+  Eigen::VectorXd storage = Eigen::VectorXd::Zero(numBufferVectors()*dimc);
+  const int dim = std::min(dimc, dimc_);
+  storage.head(dim) = slack.head(dim);
+  storage.segment(dimc, dim) = dual.head(dim);
+  storage_.swap(storage);
+  dimc_ = dimc;
+  bindVectors(storage_.data(), dimc);
+}
+
+
+void ConstraintComponentData::bindToBuffer(double* buffer, const int stride) {
+  assert(buffer != nullptr);
+  assert(stride >= dimc_);
+  for (int i=0; i<numBufferVectors(); ++i) {
+    Eigen::Map<Eigen::VectorXd>(buffer+i*stride, dimc_) 
+        = Eigen::Map<const Eigen::VectorXd>(slack.data()+i*stride_, dimc_);
+  }
+  bindVectors(buffer, stride);
+  storage_.resize(0);
+}
+
+
+int ConstraintComponentData::allocateExtraVector(const int size) {
+  assert(size >= 0);
+  const int offset = extra_data_.size();
+  extra_data_.conservativeResize(offset+size);
+  extra_data_.tail(size).setZero();
+  extra_vector_layout_.push_back(offset);
+  extra_vector_layout_.push_back(size);
+  return (static_cast<int>(extra_vector_layout_.size())/2 - 1);
+}
+
+
+int ConstraintComponentData::allocateExtraMatrix(const int rows, 
+                                                 const int cols) {
+  assert(rows >= 0);
+  assert(cols >= 0);
+  const int offset = extra_data_.size();
+  extra_data_.conservativeResize(offset+rows*cols);
+  extra_data_.tail(rows*cols).setZero();
+  extra_matrix_layout_.push_back(offset);
+  extra_matrix_layout_.push_back(rows);
+  extra_matrix_layout_.push_back(cols);
+  return (static_cast<int>(extra_matrix_layout_.size())/3 - 1);
+}
+
+
+void ConstraintComponentData::clearExtraData() {
+  extra_data_.resize(0);
+  extra_vector_layout_.clear();
+  extra_matrix_layout_.clear();
 }
 
 
@@ -116,4 +271,40 @@ bool ConstraintComponentData::isApprox(
   return true;
 }
 
+
+void ConstraintComponentData::bindVectors(double* buffer, const int stride) {
+  // Eigen::Map cannot be reassigned, so the views are reconstructed in place.
+  const int dimc = (buffer != nullptr) ? dimc_ : 0;
+  stride_ = stride;
+  new (&slack) Eigen::Map<Eigen::VectorXd>(buffer, dimc);
+  new (&dual) Eigen::Map<Eigen::VectorXd>(buffer ? buffer+stride : nullptr, dimc);
+  new (&residual) Eigen::Map<Eigen::VectorXd>(buffer ? buffer+2*stride : nullptr, dimc);
+  new (&cmpl) Eigen::Map<Eigen::VectorXd>(buffer ? buffer+3*stride : nullptr, dimc);
+  new (&dslack) Eigen::Map<Eigen::VectorXd>(buffer ? buffer+4*stride : nullptr, dimc);
+  new (&ddual) Eigen::Map<Eigen::VectorXd>(buffer ? buffer+5*stride : nullptr, dimc);
+  new (&cond) Eigen::Map<Eigen::VectorXd>(buffer ? buffer+6*stride : nullptr, dimc);
+}
+
+
+void ConstraintComponentData::copyVectors(const ConstraintComponentData& other) {
+  assert(dimc_ == other.dimc_);
+  slack = other.slack;
+  dual = other.dual;
+  residual = other.residual;
+  cmpl = other.cmpl;
+  dslack = other.dslack;
+  ddual = other.ddual;
+  cond = other.cond;
+}
+
+
+void ConstraintComponentData::copyExtraData(const ConstraintComponentData& other) {
+  log_barrier = other.log_barrier;
+  r = other.r;
+  J = other.J;
+  extra_data_ = other.extra_data_;
+  extra_vector_layout_ = other.extra_vector_layout_;
+  extra_matrix_layout_ = other.extra_matrix_layout_;
+}
+
 } // namespace robotoc
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "robotoc/constraints/constraints.hpp"
 #include "robotoc/constraints/constraints_impl.hpp"
+#include "robotoc/constraints/pdipm.hpp"
 
 #include <stdexcept>
 #include <cassert>
@@ -18,7 +19,8 @@ Constraints::Constraints(const double barrier_param,
     acceleration_level_constraint_names_(),
     impact_level_constraint_names_(),
     barrier_(barrier_param), 
-    fraction_to_boundary_rule_(fraction_to_boundary_rule) {
+    fraction_to_boundary_rule_(fraction_to_boundary_rule),
+    screening_ratio_(0.0) {
   if (barrier_param <= 0) {
     throw std::out_of_range(
         "[Constraints] invalid argment: 'barrier_param' must be positive!");
@@ -49,6 +51,7 @@ void Constraints::add(const std::string& name,
   }
   constraint->setBarrierParam(barrier_);
   constraint->setFractionToBoundaryRule(fraction_to_boundary_rule_);
+  constraint->setScreeningRatio(screening_ratio_);
   if (constraint->kinematicsLevel() 
         == KinematicsLevel::PositionLevel) {
     position_level_constraint_names_.emplace(name, position_level_constraints_.size());
@@ -74,6 +77,7 @@ void Constraints::add(const std::string& name,
   }
   constraint->setBarrierParam(barrier_);
   constraint->setFractionToBoundaryRule(fraction_to_boundary_rule_);
+  constraint->setScreeningRatio(screening_ratio_);
   if (constraint->kinematicsLevel() 
               == KinematicsLevel::AccelerationLevel) {
     impact_level_constraint_names_.emplace(name, impact_level_constraints_.size());
@@ -170,6 +174,7 @@ ConstraintsData Constraints::createConstraintsData(const Robot& robot,
                                          data.acceleration_level_data);
   constraintsimpl::createConstraintsData(impact_level_constraints_, 
                                          data.impact_level_data);
+  data.bindComponentsToBuffer();
   return data;
 }
 
@@ -390,6 +395,10 @@ void Constraints::expandSlackAndDual(const ImpactStatus& impact_status,
 
 
 double Constraints::maxSlackStepSize(const ConstraintsData& data) const {
+  if (data.isBoundToBuffer()) {
+    return pdipm::fractionToBoundary(fraction_to_boundary_rule_, 
+                                     data.slack(), data.dslack());
+  }
   double min_step_size = 1;
   if (data.isPositionLevelValid()) {
     const double step_size = constraintsimpl::maxSlackStepSize(
@@ -424,6 +433,10 @@ double Constraints::maxSlackStepSize(const ConstraintsData& data) const {
 
 
 double Constraints::maxDualStepSize(const ConstraintsData& data) const {
+  if (data.isBoundToBuffer()) {
+    return pdipm::fractionToBoundary(fraction_to_boundary_rule_, 
+                                     data.dual(), data.ddual());
+  }
   double min_step_size = 1;
   if (data.isPositionLevelValid()) {
     const double step_size = constraintsimpl::maxDualStepSize(
@@ -460,6 +473,10 @@ double Constraints::maxDualStepSize(const ConstraintsData& data) const {
 void Constraints::updateSlack(ConstraintsData& data, const double step_size) {
   assert(step_size >= 0);
   assert(step_size <= 1);
+  if (data.isBoundToBuffer()) {
+    data.slack().noalias() += step_size * data.dslack();
+    return;
+  }
   if (data.isPositionLevelValid()) {
     constraintsimpl::updateSlack(data.position_level_data, step_size);
   }
@@ -478,6 +495,10 @@ void Constraints::updateSlack(ConstraintsData& data, const double step_size) {
 void Constraints::updateDual(ConstraintsData& data, const double step_size) {
   assert(step_size >= 0);
   assert(step_size <= 1);
+  if (data.isBoundToBuffer()) {
+    data.dual().noalias() += step_size * data.ddual();
+    return;
+  }
   if (data.isPositionLevelValid()) {
     constraintsimpl::updateDual(data.position_level_data, step_size);
   }
@@ -528,6 +549,19 @@ void Constraints::setFractionToBoundaryRule(
 }
 
 
+void Constraints::setScreeningRatio(const double screening_ratio) {
+  if (screening_ratio < 0) {
+    throw std::out_of_range(
+        "[Constraints] invalid argment: 'screening_ratio' must be non-negative");
+  }
+  constraintsimpl::setScreeningRatio(position_level_constraints_, screening_ratio);
+  constraintsimpl::setScreeningRatio(velocity_level_constraints_, screening_ratio);
+  constraintsimpl::setScreeningRatio(acceleration_level_constraints_, screening_ratio);
+  constraintsimpl::setScreeningRatio(impact_level_constraints_, screening_ratio);
+  screening_ratio_ = screening_ratio;
+}
+
+
 double Constraints::getBarrierParam() const {
   return barrier_;
 }
@@ -538,6 +572,11 @@ double Constraints::getFractionToBoundaryRule() const {
 }
 
 
+double Constraints::getScreeningRatio() const {
+  return screening_ratio_;
+}
+
+
 std::vector<std::string> Constraints::getPositionLevelConstraintList() const {
   std::vector<std::string> constraint_list;
   for (std::pair<std::string, size_t> e : position_level_constraint_names_) {
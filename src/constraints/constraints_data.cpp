@@ -1,5 +1,7 @@
 #include "robotoc/constraints/constraints_data.hpp"
 
+#include <initializer_list>
+
 
 namespace robotoc {
 
@@ -13,7 +15,62 @@ ConstraintsData::ConstraintsData()
   : is_position_level_valid_(false), 
     is_velocity_level_valid_(false),
     is_acceleration_level_valid_(false),
-    is_impact_level_valid_(false) {
+    is_impact_level_valid_(false),
+    is_bound_to_buffer_(false),
+    buffer_(),
+    dimc_position_level_(0), 
+    dimc_velocity_level_(0), 
+    dimc_acceleration_level_(0),
+    dimc_impact_level_(0), 
+    dimc_(0) {
+}
+
+
+ConstraintsData::ConstraintsData(const ConstraintsData& other)
+  : position_level_data(other.position_level_data),
+    velocity_level_data(other.velocity_level_data),
+    acceleration_level_data(other.acceleration_level_data),
+    impact_level_data(other.impact_level_data),
+    is_position_level_valid_(other.is_position_level_valid_), 
+    is_velocity_level_valid_(other.is_velocity_level_valid_),
+    is_acceleration_level_valid_(other.is_acceleration_level_valid_),
+    is_impact_level_valid_(other.is_impact_level_valid_),
+    is_bound_to_buffer_(false),
+    buffer_(),
+    dimc_position_level_(0), 
+    dimc_velocity_level_(0), 
+    dimc_acceleration_level_(0),
+    dimc_impact_level_(0), 
+    dimc_(0) {
+  if (other.is_bound_to_buffer_) {
+    bindComponentsToBuffer();
+  }
+}
+
+
+ConstraintsData& ConstraintsData::operator=(const ConstraintsData& other) {
+  if (this == &other) {
+    return *this;
+  }
+  // With the same dimensions, the element-wise copies keep the views of the 
+  // components into buffer_.
+  const bool keep_buffer = is_bound_to_buffer_ && other.is_bound_to_buffer_ 
+                            && hasSameDimensions(other);
+  position_level_data = other.position_level_data;
+  velocity_level_data = other.velocity_level_data;
+  acceleration_level_data = other.acceleration_level_data;
+  impact_level_data = other.impact_level_data;
+  is_position_level_valid_ = other.is_position_level_valid_;
+  is_velocity_level_valid_ = other.is_velocity_level_valid_;
+  is_acceleration_level_valid_ = other.is_acceleration_level_valid_;
+  is_impact_level_valid_ = other.is_impact_level_valid_;
+  if (!keep_buffer) {
+    is_bound_to_buffer_ = false;
+    if (other.is_bound_to_buffer_) {
+      bindComponentsToBuffer();
+    }
+  }
+  return *this;
 }
 
 
@@ -44,4 +101,58 @@ void ConstraintsData::setTimeStage(const int time_stage) {
   }
 }
 
+
+
+void ConstraintsData::bindComponentsToBuffer() {
+  auto sumDimc = [](const std::vector<ConstraintComponentData>& data) {
+    int dimc = 0;
+    for (const auto& e : data) {
+      dimc += e.dimc();
+    }
+    return dimc;
+  };
+  dimc_position_level_ = sumDimc(position_level_data);
+  dimc_velocity_level_ = sumDimc(velocity_level_data);
+  dimc_acceleration_level_ = sumDimc(acceleration_level_data);
+  dimc_impact_level_ = sumDimc(impact_level_data);
+  dimc_ = dimc_position_level_ + dimc_velocity_level_ 
+            + dimc_acceleration_level_ + dimc_impact_level_;
+  // The components are moved into the new buffer before the current one, 
+  // which they may be bound to, is released.
+  Eigen::VectorXd buffer 
+      = Eigen::VectorXd::Zero(ConstraintComponentData::numBufferVectors()*dimc_);
+  int offset = 0;
+  for (auto data : {&position_level_data, &velocity_level_data, 
+                    &acceleration_level_data, &impact_level_data}) {
+    for (auto& e : *data) {
+      if (e.dimc() > 0) {
+        e.bindToBuffer(buffer.data()+offset, dimc_);
+      }
+      offset += e.dimc();
+    }
+  }
+  buffer_.swap(buffer);
+  is_bound_to_buffer_ = true;
+}
+
+
+bool ConstraintsData::hasSameDimensions(const ConstraintsData& other) const {
+  auto isSame = [](const std::vector<ConstraintComponentData>& data, 
+                   const std::vector<ConstraintComponentData>& other_data) {
+    if (data.size() != other_data.size()) {
+      return false;
+    }
+    for (int i=0; i<data.size(); ++i) {
+      if (data[i].dimc() != other_data[i].dimc()) {
+        return false;
+      }
+    }
+    return true;
+  };
+  return (isSame(position_level_data, other.position_level_data)
+          && isSame(velocity_level_data, other.velocity_level_data)
+          && isSame(acceleration_level_data, other.acceleration_level_data)
+          && isSame(impact_level_data, other.impact_level_data));
+}
+
 } // namespace robotoc
\ No newline at end of file
@@ -67,14 +67,16 @@ KinematicsLevel ContactWrenchCone::kinematicsLevel() const {
 
 
 void ContactWrenchCone::allocateExtraData(ConstraintComponentData& data) const {
-  data.r.clear();
-  data.r.push_back(Eigen::VectorXd::Zero(17));
+  // All the extra data are stored contiguously: the 17-dimensional scratch 
+  // vector and then the cone of each contact.
+  data.clearExtraData();
+  data.allocateExtraVector(17);
   const double mu = 0.7;
   Eigen::MatrixXd cone = Eigen::MatrixXd::Zero(17, 6);
   computeCone(mu, cone);
-  data.J.clear();
   for (int i=0; i<max_num_contacts_; ++i) {
-    data.J.push_back(cone);
+    const int idx = data.allocateExtraMatrix(17, 6);
+    data.extraMatrix(idx) = cone;
   }
 }
 
@@ -91,7 +93,7 @@ bool ContactWrenchCone::isFeasible(Robot& robot,
         break;
       case ContactType::SurfaceContact:
         if (contact_status.isContactActive(i)) {
-          Eigen::MatrixXd& cone_i = data.J[i];
+          auto cone_i = data.extraMatrix(i);
           updateCone(contact_status.frictionCoefficient(i), cone_i);
           data.residual.template segment<17>(c_begin).noalias() 
               += cone_i * s.f[i];
@@ -122,7 +124,7 @@ void ContactWrenchCone::setSlack(Robot& robot,
         break;
       case ContactType::SurfaceContact:
         if (contact_status.isContactActive(i)) {
-          Eigen::MatrixXd& cone_i = data.J[i];
+          auto cone_i = data.extraMatrix(i);
           updateCone(contact_status.frictionCoefficient(i), cone_i);
           data.residual.template segment<17>(c_begin).noalias() = cone_i * s.f[i];
           data.slack.template segment<17>(c_begin)
@@ -151,7 +153,7 @@ void ContactWrenchCone::evalConstraint(Robot& robot,
         break;
       case ContactType::SurfaceContact:
         if (contact_status.isContactActive(i)) {
-          Eigen::MatrixXd& cone_i = data.J[i];
+          auto cone_i = data.extraMatrix(i);
           updateCone(contact_status.frictionCoefficient(i), cone_i);
           data.residual.template segment<17>(c_begin).noalias() 
               = cone_i * s.f[i] + data.slack.template segment<17>(c_begin);
@@ -183,7 +185,7 @@ void ContactWrenchCone::evalDerivatives(Robot& robot,
         break;
       case ContactType::SurfaceContact:
         if (contact_status.isContactActive(i)) {
-          const Eigen::MatrixXd& cone_i = data.J[i];
+          const auto cone_i = data.extraMatrix(i);
           kkt_residual.lf().template segment<6>(dimf_stack).noalias()
               += cone_i.transpose() * data.dual.template segment<17>(c_begin);
           dimf_stack += 6;
@@ -213,11 +215,12 @@ void ContactWrenchCone::condenseSlackAndDual(const ContactStatus& contact_status
         break;
       case ContactType::SurfaceContact:
         if (contact_status.isContactActive(i)) {
-          const Eigen::MatrixXd& cone_i = data.J[i];
-          data.r[0].array() = data.dual.template segment<17>(c_begin).array() 
-                                / data.slack.template segment<17>(c_begin).array();
+          const auto cone_i = data.extraMatrix(i);
+          auto r = data.extraVector(0);
+          r.array() = data.dual.template segment<17>(c_begin).array() 
+                        / data.slack.template segment<17>(c_begin).array();
           kkt_matrix.Qff().template block<6, 6>(dimf_stack, dimf_stack).noalias()
-              += cone_i.transpose() * data.r[0].asDiagonal() * cone_i;
+              += cone_i.transpose() * r.asDiagonal() * cone_i;
           computeCondensingCoeffcient<17>(data, c_begin);
           kkt_residual.lf().template segment<6>(dimf_stack).noalias()
               += cone_i.transpose() * data.cond.template segment<17>(c_begin);
@@ -251,7 +254,7 @@ void ContactWrenchCone::expandSlackAndDual(const ContactStatus& contact_status,
         break;
       case ContactType::SurfaceContact:
         if (contact_status.isContactActive(i)) {
-          const Eigen::MatrixXd& cone_i = data.J[i];
+          const auto cone_i = data.extraMatrix(i);
           data.dslack.template segment<17>(c_begin).noalias()
               = - cone_i * d.df().template segment<6>(dimf_stack) 
                 - data.residual.template segment<17>(c_begin);
@@ -295,7 +298,8 @@ void ContactWrenchCone::computeCone(const double mu, Eigen::MatrixXd& cone) cons
 }
 
 
-void ContactWrenchCone::updateCone(const double mu, Eigen::MatrixXd& cone) const {
+void ContactWrenchCone::updateCone(const double mu, 
+                                   Eigen::Map<Eigen::MatrixXd>& cone) const {
   for (int i=1; i<5; ++i) {
     cone.coeffRef(i, 2) = -mu;
   }
@@ -40,37 +40,37 @@ KinematicsLevel FrictionCone::kinematicsLevel() const {
 
 
 void FrictionCone::allocateExtraData(ConstraintComponentData& data) const {
-  data.r.clear();
+  // All the extra data are stored contiguously in the order of the indices 
+  // used by the accessors, e.g., fW(), r(), and dg_dq().
+  data.clearExtraData();
   for (int i=0; i<max_num_contacts_; ++i) {
-    data.r.push_back(Eigen::VectorXd::Zero(3)); // fWi
+    data.allocateExtraVector(3); // fWi
   }
   for (int i=0; i<max_num_contacts_; ++i) {
-    data.r.push_back(Eigen::VectorXd::Zero(5)); // ri
+    data.allocateExtraVector(5); // ri
   }
-  data.J.clear();
   for (int i=0; i<max_num_contacts_; ++i) {
-    data.J.push_back(Eigen::MatrixXd::Zero(5, dimv_)); // dgi_dq
+    data.allocateExtraMatrix(5, dimv_); // dgi_dq
   }
   for (int i=0; i<max_num_contacts_; ++i) {
-    data.J.push_back(Eigen::MatrixXd::Zero(5, 3)); // dgi_df
+    data.allocateExtraMatrix(5, 3); // dgi_df
   }
   for (int i=0; i<max_num_contacts_; ++i) {
-    data.J.push_back(Eigen::MatrixXd::Zero(6, dimv_)); // dfWi_dq
+    data.allocateExtraMatrix(6, dimv_); // dfWi_dq
   }
   for (int i=0; i<max_num_contacts_; ++i) {
-    data.J.push_back(Eigen::MatrixXd::Zero(5, 3)); // r_dgi_df
+    data.allocateExtraMatrix(5, 3); // r_dgi_df
   }
   for (int i=0; i<max_num_contacts_; ++i) {
-    data.J.push_back(Eigen::MatrixXd::Zero(5, 3)); // cone_local
+    data.allocateExtraMatrix(5, 3); // cone_local
   }
   for (int i=0; i<max_num_contacts_; ++i) {
-    Eigen::MatrixXd cone_world = Eigen::MatrixXd::Zero(5, 3);
-    cone_world <<  0,  0, -1, 
-                   1,  0,  0,
-                  -1,  0,  0,
-                   0,  1,  0,
-                   0, -1,  0;
-    data.J.push_back(cone_world); 
+    const int idx = data.allocateExtraMatrix(5, 3); // cone_world
+    data.extraMatrix(idx) <<  0,  0, -1, 
+                              1,  0,  0,
+                             -1,  0,  0,
+                              0,  1,  0,
+                              0, -1,  0;
   }
 }
 
@@ -82,7 +82,7 @@ bool FrictionCone::isFeasible(Robot& robot, const ContactStatus& contact_status,
   for (int i=0; i<max_num_contacts_; ++i) {
     if (contact_status.isContactActive(i)) {
       const int idx = 5*i;
-      Eigen::VectorXd& fWi = fW(data, i);
+      auto fWi = fW(data, i);
       robot.transformFromLocalToWorld(contact_frame_[i], 
                                       s.f[i].template head<3>(), fWi);
       frictionConeResidual(contact_status.frictionCoefficient(i), fWi, 
@@ -103,7 +103,7 @@ void FrictionCone::setSlack(Robot& robot, const ContactStatus& contact_status,
   robot.updateFrameKinematics(s.q);
   for (int i=0; i<max_num_contacts_; ++i) {
     const int idx = 5*i;
-    Eigen::VectorXd& fWi = fW(data, i);
+    auto fWi = fW(data, i);
     robot.transformFromLocalToWorld(contact_frame_[i], 
                                     s.f[i].template head<3>(), fWi);
     frictionConeResidual(contact_status.frictionCoefficient(i), fWi, 
@@ -126,7 +126,7 @@ void FrictionCone::evalConstraint(Robot& robot,
     if (contact_status.isContactActive(i)) {
       const int idx = 5*i;
       // Contact force expressed in the world frame.
-      Eigen::VectorXd& fWi = fW(data, i);
+      auto fWi = fW(data, i);
       robot.transformFromLocalToWorld(contact_frame_[i], 
                                       s.f[i].template head<3>(), fWi);
       frictionConeResidual(contact_status.frictionCoefficient(i), fWi, 
@@ -151,28 +151,28 @@ void FrictionCone::evalDerivatives(Robot& robot,
     if (contact_status.isContactActive(i)) {
       const int idx = 5*i;
       // Contact force expressed in the world frame.
-      const Eigen::VectorXd& fWi = fW(data, i);
+      const auto fWi = fW(data, i);
       // Friction cone in the world frame.
-      Eigen::MatrixXd& cone_world_i = cone_world(data, i);
+      auto cone_world_i = cone_world(data, i);
       for (int j=0; j<4; ++j) {
         cone_world_i.coeffRef(j+1, 2) = - (contact_status.frictionCoefficient(i)/std::sqrt(2));
       }
       // Friction cone in the local frame of the contact surface.
-      Eigen::MatrixXd& cone_local_i = cone_local(data, i);
+      auto cone_local_i = cone_local(data, i);
       cone_local_i.noalias() = cone_world_i * contact_status.contactRotation(i).transpose();
       // Jacobian of the contact force expressed in the world frame fWi 
       // with respect to the configuration q.
-      Eigen::MatrixXd& dfWi_dq = dfW_dq(data, i);
+      auto dfWi_dq = dfW_dq(data, i);
       robot.getJacobianTransformFromLocalToWorld(contact_frame_[i], fWi, dfWi_dq);
       // Jacobian of the frition cone constraint with respect to the 
       // configuration, i.e., s.q.
-      Eigen::MatrixXd& dgi_dq = dg_dq(data, i);
+      auto dgi_dq = dg_dq(data, i);
       dgi_dq.noalias() = cone_local_i * dfWi_dq.template topRows<3>();
       kkt_residual.lq().noalias()
           += dgi_dq.transpose() * data.dual.template segment<5>(idx);
       // Jacobian of the frition cone constraint with respect to the contact
       // force expressed in the local frame, i.e., s.f[i].
-      Eigen::MatrixXd& dgi_df = dg_df(data, i);
+      auto dgi_df = dg_df(data, i);
       dgi_df.noalias() = cone_local_i * robot.frameRotation(contact_frame_[i]);
       kkt_residual.lf().template segment<3>(dimf_stack).noalias()
           += dgi_df.transpose() * data.dual.template segment<5>(idx);
@@ -202,24 +202,29 @@ void FrictionCone::condenseSlackAndDual(const ContactStatus& contact_status,
       const int idx = 5*i;
       computeCondensingCoeffcient<5>(data, idx);
       const Vector5d& condi = data.cond.template segment<5>(idx);
-      const Eigen::MatrixXd& dgi_dq = dg_dq(data, i);
-      const Eigen::MatrixXd& dgi_df = dg_df(data, i);
+      const auto dgi_dq = dg_dq(data, i);
+      const auto dgi_df = dg_df(data, i);
       kkt_residual.lq().noalias() += dgi_dq.transpose() * condi;
       kkt_residual.lf().template segment<3>(dimf_stack).noalias()
           += dgi_df.transpose() * condi;
-      Eigen::MatrixXd& dfWi_dq = dfW_dq(data, i);
-      Eigen::MatrixXd& r_dgi_df = r_dg_df(data, i);
-      Eigen::VectorXd& ri = r(data, i);
+      auto r_dgi_df = r_dg_df(data, i);
+      auto ri = r(data, i);
       ri.array() = data.dual.template segment<5>(idx).array() 
                     / data.slack.template segment<5>(idx).array();
-      dfWi_dq.template topRows<5>().noalias() = ri.asDiagonal() * dgi_dq;
       r_dgi_df.noalias() = ri.asDiagonal() * dgi_df;
-      kkt_matrix.Qqq().noalias()
-          += dgi_dq.transpose() * dfWi_dq.template topRows<5>();
-      kkt_matrix.Qqf().template middleCols<3>(dimf_stack).noalias()
-          += dgi_dq.transpose() * r_dgi_df; 
       kkt_matrix.Qff().template block<3, 3>(dimf_stack, dimf_stack).noalias()
           += dgi_df.transpose() * r_dgi_df;
+      // The Hessian of the block far from active with respect to q is 
+      // negligible and its O(dimv^2) condensing is skipped if the screening 
+      // is enabled. Qqf is skipped together to keep the Hessian PSD.
+      if (!isFarFromActive<5>(data, idx)) {
+        auto dfWi_dq = dfW_dq(data, i);
+        dfWi_dq.template topRows<5>().noalias() = ri.asDiagonal() * dgi_dq;
+        kkt_matrix.Qqq().noalias()
+            += dgi_dq.transpose() * dfWi_dq.template topRows<5>();
+        kkt_matrix.Qqf().template middleCols<3>(dimf_stack).noalias()
+            += dgi_dq.transpose() * r_dgi_df; 
+      }
       switch (contact_types_[i]) {
         case ContactType::PointContact:
           dimf_stack += 3;
@@ -247,8 +252,8 @@ void FrictionCone::expandSlackAndDual(const ContactStatus& contact_status,
   for (int i=0; i<max_num_contacts_; ++i) {
     if (contact_status.isContactActive(i)) {
       const int idx = 5*i;
-      Eigen::MatrixXd& dgi_dq = dg_dq(data, i);
-      Eigen::MatrixXd& dgi_df = dg_df(data, i);
+      auto dgi_dq = dg_dq(data, i);
+      auto dgi_df = dg_df(data, i);
       data.dslack.template segment<5>(idx).noalias()
           = - dgi_dq * d.dq() - dgi_df * d.df().template segment<3>(dimf_stack) 
             - data.residual.template segment<5>(idx);
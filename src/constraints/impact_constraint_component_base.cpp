@@ -11,7 +11,8 @@ namespace robotoc {
 ImpactConstraintComponentBase::ImpactConstraintComponentBase(
     const double barrier_param, const double fraction_to_boundary_rule) 
   : barrier_(barrier_param),
-    fraction_to_boundary_rule_(fraction_to_boundary_rule) {
+    fraction_to_boundary_rule_(fraction_to_boundary_rule),
+    screening_ratio_(0.0) {
   if (barrier_param <= 0) {
     throw std::out_of_range(
         "[ImpactConstraintComponentBase] invalid argment: 'barrier_param' must be positive");
@@ -60,6 +61,20 @@ void ImpactConstraintComponentBase::setFractionToBoundaryRule(
 }
 
 
+double ImpactConstraintComponentBase::getScreeningRatio() const {
+  return screening_ratio_;
+}
+
+
+void ImpactConstraintComponentBase::setScreeningRatio(const double screening_ratio) {
+  if (screening_ratio < 0) {
+    throw std::out_of_range(
+        "[ImpactConstraintComponentBase] invalid argment: 'screening_ratio' must be non-negative");
+  }
+  screening_ratio_ = screening_ratio;
+}
+
+
 void ImpactConstraintComponentBase::setSlackAndDualPositive(
     ConstraintComponentData& data) const {
   pdipm::setSlackAndDualPositive(barrier_, data);
@@ -66,14 +66,16 @@ KinematicsLevel ImpactWrenchCone::kinematicsLevel() const {
 
 
 void ImpactWrenchCone::allocateExtraData(ConstraintComponentData& data) const {
-  data.r.clear();
-  data.r.push_back(Eigen::VectorXd::Zero(17));
+  // All the extra data are stored contiguously: the 17-dimensional scratch 
+  // vector and then the cone of each contact.
+  data.clearExtraData();
+  data.allocateExtraVector(17);
   const double mu = 0.7;
   Eigen::MatrixXd cone = Eigen::MatrixXd::Zero(17, 6);
   computeCone(mu, cone);
-  data.J.clear();
   for (int i=0; i<max_num_contacts_; ++i) {
-    data.J.push_back(cone);
+    const int idx = data.allocateExtraMatrix(17, 6);
+    data.extraMatrix(idx) = cone;
   }
 }
 
@@ -90,7 +92,7 @@ bool ImpactWrenchCone::isFeasible(Robot& robot,
         break;
       case ContactType::SurfaceContact:
         if (impact_status.isImpactActive(i)) {
-          Eigen::MatrixXd& cone_i = data.J[i];
+          auto cone_i = data.extraMatrix(i);
           updateCone(impact_status.frictionCoefficient(i), cone_i);
           data.residual.template segment<17>(c_begin).noalias() 
               += cone_i * s.f[i];
@@ -121,7 +123,7 @@ void ImpactWrenchCone::setSlack(Robot& robot,
         break;
       case ContactType::SurfaceContact:
         if (impact_status.isImpactActive(i)) {
-          Eigen::MatrixXd& cone_i = data.J[i];
+          auto cone_i = data.extraMatrix(i);
           updateCone(impact_status.frictionCoefficient(i), cone_i);
           data.residual.template segment<17>(c_begin).noalias() = cone_i * s.f[i];
           data.slack.template segment<17>(c_begin)
@@ -150,7 +152,7 @@ void ImpactWrenchCone::evalConstraint(Robot& robot,
         break;
       case ContactType::SurfaceContact:
         if (impact_status.isImpactActive(i)) {
-          Eigen::MatrixXd& cone_i = data.J[i];
+          auto cone_i = data.extraMatrix(i);
           updateCone(impact_status.frictionCoefficient(i), cone_i);
           data.residual.template segment<17>(c_begin).noalias() 
               = cone_i * s.f[i] + data.slack.template segment<17>(c_begin);
@@ -182,7 +184,7 @@ void ImpactWrenchCone::evalDerivatives(Robot& robot,
         break;
       case ContactType::SurfaceContact:
         if (impact_status.isImpactActive(i)) {
-          const Eigen::MatrixXd& cone_i = data.J[i];
+          const auto cone_i = data.extraMatrix(i);
           kkt_residual.lf().template segment<6>(dimf_stack).noalias()
               += cone_i.transpose() * data.dual.template segment<17>(c_begin);
           dimf_stack += 6;
@@ -212,11 +214,12 @@ void ImpactWrenchCone::condenseSlackAndDual(const ImpactStatus& impact_status,
         break;
       case ContactType::SurfaceContact:
         if (impact_status.isImpactActive(i)) {
-          const Eigen::MatrixXd& cone_i = data.J[i];
-          data.r[0].array() = data.dual.template segment<17>(c_begin).array() 
-                                / data.slack.template segment<17>(c_begin).array();
+          const auto cone_i = data.extraMatrix(i);
+          auto r = data.extraVector(0);
+          r.array() = data.dual.template segment<17>(c_begin).array() 
+                        / data.slack.template segment<17>(c_begin).array();
           kkt_matrix.Qff().template block<6, 6>(dimf_stack, dimf_stack).noalias()
-              += cone_i.transpose() * data.r[0].asDiagonal() * cone_i;
+              += cone_i.transpose() * r.asDiagonal() * cone_i;
           computeCondensingCoeffcient<17>(data, c_begin);
           kkt_residual.lf().template segment<6>(dimf_stack).noalias()
               += cone_i.transpose() * data.cond.template segment<17>(c_begin);
@@ -250,7 +253,7 @@ void ImpactWrenchCone::expandSlackAndDual(const ImpactStatus& impact_status,
         break;
       case ContactType::SurfaceContact:
         if (impact_status.isImpactActive(i)) {
-          const Eigen::MatrixXd& cone_i = data.J[i];
+          const auto cone_i = data.extraMatrix(i);
           data.dslack.template segment<17>(c_begin).noalias()
               = - cone_i * d.df().template segment<6>(dimf_stack) 
                 - data.residual.template segment<17>(c_begin);
@@ -294,7 +297,8 @@ void ImpactWrenchCone::computeCone(const double mu, Eigen::MatrixXd& cone) const
 }
 
 
-void ImpactWrenchCone::updateCone(const double mu, Eigen::MatrixXd& cone) const {
+void ImpactWrenchCone::updateCone(const double mu, 
+                                   Eigen::Map<Eigen::MatrixXd>& cone) const {
   for (int i=1; i<5; ++i) {
     cone.coeffRef(i, 2) = -mu;
   }
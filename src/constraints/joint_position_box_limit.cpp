@@ -0,0 +1,94 @@
+#include "robotoc/constraints/joint_position_box_limit.hpp"
+
+
+namespace robotoc {
+
+JointPositionBoxLimit::JointPositionBoxLimit(const Robot& robot)
+  : ConstraintComponentBase(),
+    dimc_(2*robot.lowerJointPositionLimit().size()),
+    dim_(robot.lowerJointPositionLimit().size()),
+    qmin_(robot.lowerJointPositionLimit()),
+    qmax_(robot.upperJointPositionLimit()) {
+}
+
+
+JointPositionBoxLimit::JointPositionBoxLimit()
+  : ConstraintComponentBase(),
+    dimc_(0),
+    dim_(0),
+    qmin_(),
+    qmax_() {
+}
+
+
+JointPositionBoxLimit::~JointPositionBoxLimit() {
+}
+
+
+KinematicsLevel JointPositionBoxLimit::kinematicsLevel() const {
+  return KinematicsLevel::PositionLevel;
+}
+
+
+bool JointPositionBoxLimit::isFeasible(Robot& robot, 
+                                       const ContactStatus& contact_status,
+                                       ConstraintComponentData& data, 
+                                       const SplitSolution& s) const {
+  return ((s.q.tail(dim_).array() >= qmin_.array()).all() 
+          && (s.q.tail(dim_).array() <= qmax_.array()).all());
+}
+
+
+void JointPositionBoxLimit::setSlack(Robot& robot, 
+                                     const ContactStatus& contact_status,
+                                     ConstraintComponentData& data, 
+                                     const SplitSolution& s) const {
+  data.slack.head(dim_) = s.q.tail(dim_) - qmin_;
+  data.slack.tail(dim_) = qmax_ - s.q.tail(dim_);
+}
+
+
+void JointPositionBoxLimit::evalConstraint(Robot& robot, 
+                                           const ContactStatus& contact_status,
+                                           ConstraintComponentData& data, 
+                                           const SplitSolution& s) const {
+  data.residual.head(dim_) = qmin_ - s.q.tail(dim_) + data.slack.head(dim_);
+  data.residual.tail(dim_) = s.q.tail(dim_) - qmax_ + data.slack.tail(dim_);
+  computeComplementarySlackness(data);
+  data.log_barrier = logBarrier(data.slack);
+}
+
+
+void JointPositionBoxLimit::evalDerivatives(
+    Robot& robot, const ContactStatus& contact_status,
+    ConstraintComponentData& data, const SplitSolution& s, 
+    SplitKKTResidual& kkt_residual) const {
+  kkt_residual.lq().tail(dim_).noalias() += data.dual.tail(dim_) - data.dual.head(dim_);
+}
+
+
+void JointPositionBoxLimit::condenseSlackAndDual(
+    const ContactStatus& contact_status, ConstraintComponentData& data, 
+    SplitKKTMatrix& kkt_matrix, SplitKKTResidual& kkt_residual) const {
+  kkt_matrix.Qqq().diagonal().tail(dim_).array()
+      += data.dual.head(dim_).array() / data.slack.head(dim_).array()
+          + data.dual.tail(dim_).array() / data.slack.tail(dim_).array();
+  computeCondensingCoeffcient(data);
+  kkt_residual.lq().tail(dim_).noalias() += data.cond.tail(dim_) - data.cond.head(dim_);
+}
+
+
+void JointPositionBoxLimit::expandSlackAndDual(
+    const ContactStatus& contact_status, ConstraintComponentData& data, 
+    const SplitDirection& d) const {
+  data.dslack.head(dim_) = d.dq().tail(dim_) - data.residual.head(dim_);
+  data.dslack.tail(dim_) = - d.dq().tail(dim_) - data.residual.tail(dim_);
+  computeDualDirection(data);
+}
+
+
+int JointPositionBoxLimit::dimc() const {
+  return dimc_;
+}
+
+} // namespace robotoc
\ No newline at end of file
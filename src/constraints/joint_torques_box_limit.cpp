@@ -0,0 +1,94 @@
+#include "robotoc/constraints/joint_torques_box_limit.hpp"
+
+
+namespace robotoc {
+
+JointTorquesBoxLimit::JointTorquesBoxLimit(const Robot& robot)
+  : ConstraintComponentBase(),
+    dimc_(2*robot.jointEffortLimit().size()),
+    dim_(robot.jointEffortLimit().size()),
+    umin_(-robot.jointEffortLimit()),
+    umax_(robot.jointEffortLimit()) {
+}
+
+
+JointTorquesBoxLimit::JointTorquesBoxLimit()
+  : ConstraintComponentBase(),
+    dimc_(0),
+    dim_(0),
+    umin_(),
+    umax_() {
+}
+
+
+JointTorquesBoxLimit::~JointTorquesBoxLimit() {
+}
+
+
+KinematicsLevel JointTorquesBoxLimit::kinematicsLevel() const {
+  return KinematicsLevel::AccelerationLevel;
+}
+
+
+bool JointTorquesBoxLimit::isFeasible(Robot& robot, 
+                                      const ContactStatus& contact_status,
+                                      ConstraintComponentData& data, 
+                                      const SplitSolution& s) const {
+  return ((s.u.array() >= umin_.array()).all() 
+          && (s.u.array() <= umax_.array()).all());
+}
+
+
+void JointTorquesBoxLimit::setSlack(Robot& robot, 
+                                    const ContactStatus& contact_status,
+                                    ConstraintComponentData& data, 
+                                    const SplitSolution& s) const {
+  data.slack.head(dim_) = s.u - umin_;
+  data.slack.tail(dim_) = umax_ - s.u;
+}
+
+
+void JointTorquesBoxLimit::evalConstraint(Robot& robot, 
+                                          const ContactStatus& contact_status,
+                                          ConstraintComponentData& data, 
+                                          const SplitSolution& s) const {
+  data.residual.head(dim_) = umin_ - s.u + data.slack.head(dim_);
+  data.residual.tail(dim_) = s.u - umax_ + data.slack.tail(dim_);
+  computeComplementarySlackness(data);
+  data.log_barrier = logBarrier(data.slack);
+}
+
+
+void JointTorquesBoxLimit::evalDerivatives(
+    Robot& robot, const ContactStatus& contact_status,
+    ConstraintComponentData& data, const SplitSolution& s, 
+    SplitKKTResidual& kkt_residual) const {
+  kkt_residual.lu.noalias() += data.dual.tail(dim_) - data.dual.head(dim_);
+}
+
+
+void JointTorquesBoxLimit::condenseSlackAndDual(
+    const ContactStatus& contact_status, ConstraintComponentData& data, 
+    SplitKKTMatrix& kkt_matrix, SplitKKTResidual& kkt_residual) const {
+  kkt_matrix.Quu.diagonal().array()
+      += data.dual.head(dim_).array() / data.slack.head(dim_).array()
+          + data.dual.tail(dim_).array() / data.slack.tail(dim_).array();
+  computeCondensingCoeffcient(data);
+  kkt_residual.lu.noalias() += data.cond.tail(dim_) - data.cond.head(dim_);
+}
+
+
+void JointTorquesBoxLimit::expandSlackAndDual(
+    const ContactStatus& contact_status, ConstraintComponentData& data, 
+    const SplitDirection& d) const {
+  data.dslack.head(dim_) = d.du - data.residual.head(dim_);
+  data.dslack.tail(dim_) = - d.du - data.residual.tail(dim_);
+  computeDualDirection(data);
+}
+
+
+int JointTorquesBoxLimit::dimc() const {
+  return dimc_;
+}
+
+} // namespace robotoc
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "robotoc/constraints/joint_velocity_box_limit.hpp"
+
+
+namespace robotoc {
+
+JointVelocityBoxLimit::JointVelocityBoxLimit(const Robot& robot)
+  : ConstraintComponentBase(),
+    dimc_(2*robot.jointVelocityLimit().size()),
+    dim_(robot.jointVelocityLimit().size()),
+    vmin_(-robot.jointVelocityLimit()),
+    vmax_(robot.jointVelocityLimit()) {
+}
+
+
+JointVelocityBoxLimit::JointVelocityBoxLimit()
+  : ConstraintComponentBase(),
+    dimc_(0),
+    dim_(0),
+    vmin_(),
+    vmax_() {
+}
+
+
+JointVelocityBoxLimit::~JointVelocityBoxLimit() {
+}
+
+
+KinematicsLevel JointVelocityBoxLimit::kinematicsLevel() const {
+  return KinematicsLevel::VelocityLevel;
+}
+
+
+bool JointVelocityBoxLimit::isFeasible(Robot& robot, 
+                                       const ContactStatus& contact_status,
+                                       ConstraintComponentData& data, 
+                                       const SplitSolution& s) const {
+  return ((s.v.tail(dim_).array() >= vmin_.array()).all() 
+          && (s.v.tail(dim_).array() <= vmax_.array()).all());
+}
+
+
+void JointVelocityBoxLimit::setSlack(Robot& robot, 
+                                     const ContactStatus& contact_status,
+                                     ConstraintComponentData& data, 
+                                     const SplitSolution& s) const {
+  data.slack.head(dim_) = s.v.tail(dim_) - vmin_;
+  data.slack.tail(dim_) = vmax_ - s.v.tail(dim_);
+}
+
+
+void JointVelocityBoxLimit::evalConstraint(Robot& robot, 
+                                           const ContactStatus& contact_status,
+                                           ConstraintComponentData& data, 
+                                           const SplitSolution& s) const {
+  data.residual.head(dim_) = vmin_ - s.v.tail(dim_) + data.slack.head(dim_);
+  data.residual.tail(dim_) = s.v.tail(dim_) - vmax_ + data.slack.tail(dim_);
+  computeComplementarySlackness(data);
+  data.log_barrier = logBarrier(data.slack);
+}
+
+
+void JointVelocityBoxLimit::evalDerivatives(
+    Robot& robot, const ContactStatus& contact_status,
+    ConstraintComponentData& data, const SplitSolution& s, 
+    SplitKKTResidual& kkt_residual) const {
+  kkt_residual.lv().tail(dim_).noalias() += data.dual.tail(dim_) - data.dual.head(dim_);
+}
+
+
+void JointVelocityBoxLimit::condenseSlackAndDual(
+    const ContactStatus& contact_status, ConstraintComponentData& data, 
+    SplitKKTMatrix& kkt_matrix, SplitKKTResidual& kkt_residual) const {
+  kkt_matrix.Qvv().diagonal().tail(dim_).array()
+      += data.dual.head(dim_).array() / data.slack.head(dim_).array()
+          + data.dual.tail(dim_).array() / data.slack.tail(dim_).array();
+  computeCondensingCoeffcient(data);
+  kkt_residual.lv().tail(dim_).noalias() += data.cond.tail(dim_) - data.cond.head(dim_);
+}
+
+
+void JointVelocityBoxLimit::expandSlackAndDual(
+    const ContactStatus& contact_status, ConstraintComponentData& data, 
+    const SplitDirection& d) const {
+  data.dslack.head(dim_) = d.dv().tail(dim_) - data.residual.head(dim_);
+  data.dslack.tail(dim_) = - d.dv().tail(dim_) - data.residual.tail(dim_);
+  computeDualDirection(data);
+}
+
+
+int JointVelocityBoxLimit::dimc() const {
+  return dimc_;
+}
+
+} // namespace robotoc
\ No newline at end of file
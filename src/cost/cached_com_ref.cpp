@@ -0,0 +1,68 @@
+#include "robotoc/cost/cached_com_ref.hpp"
+
+#include <stdexcept>
+
+
+namespace robotoc {
+
+CachedCoMRef::CachedCoMRef(
+    const std::shared_ptr<CoMRefBase>& ref)
+  : CoMRefBase(),
+    ref_(ref),
+    cache_(3) {
+  if (ref == nullptr) {
+    throw std::invalid_argument("[CachedCoMRef] invalid argument: 'ref' must not be nullptr!");
+  }
+}
+
+
+CachedCoMRef::~CachedCoMRef() {
+}
+
+
+void CachedCoMRef::updateCache(
+    const TimeDiscretization& time_discretization) {
+  const int num_grids = time_discretization.size();
+  cache_.reset(num_grids);
+  for (int i=0; i<num_grids; ++i) {
+    const GridInfo& grid_info = time_discretization[i];
+    const bool is_active = ref_->isActive(grid_info);
+    cache_.cache(grid_info, is_active);
+    if (is_active) {
+      ref_->updateRef(grid_info, cache_.ref(grid_info.stage));
+    }
+  }
+}
+
+
+void CachedCoMRef::clearCache() {
+  cache_.clear();
+}
+
+
+const std::shared_ptr<CoMRefBase>& CachedCoMRef::getRef() const {
+  return ref_;
+}
+
+
+void CachedCoMRef::updateRef(const GridInfo& grid_info, 
+                             Eigen::VectorXd& com_ref) const {
+  if (cache_.isCached(grid_info)) {
+    com_ref = cache_.ref(grid_info.stage);
+  }
+  else {
+    ref_->updateRef(grid_info, com_ref);
+  }
+}
+
+
+bool CachedCoMRef::isActive(const GridInfo& grid_info) const {
+  if (cache_.isCached(grid_info)) {
+    return cache_.isActive(grid_info.stage);
+  }
+  else {
+    return ref_->isActive(grid_info);
+  }
+}
+
+} // namespace robotoc
\ No newline at end of file
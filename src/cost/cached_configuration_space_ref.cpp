@@ -0,0 +1,70 @@
+#include "robotoc/cost/cached_configuration_space_ref.hpp"
+
+#include <stdexcept>
+
+
+namespace robotoc {
+
+CachedConfigurationSpaceRef::CachedConfigurationSpaceRef(
+    const std::shared_ptr<ConfigurationSpaceRefBase>& ref, const Robot& robot)
+  : ConfigurationSpaceRefBase(),
+    ref_(ref),
+    cache_(robot.dimq()) {
+  if (ref == nullptr) {
+    throw std::invalid_argument("[CachedConfigurationSpaceRef] invalid argument: 'ref' must not be nullptr!");
+  }
+}
+
+
+CachedConfigurationSpaceRef::~CachedConfigurationSpaceRef() {
+}
+
+
+void CachedConfigurationSpaceRef::updateCache(
+    const Robot& robot, const TimeDiscretization& time_discretization) {
+  const int num_grids = time_discretization.size();
+  cache_.reset(num_grids);
+  for (int i=0; i<num_grids; ++i) {
+    const GridInfo& grid_info = time_discretization[i];
+    const bool is_active = ref_->isActive(grid_info);
+    cache_.cache(grid_info, is_active);
+    if (is_active) {
+      ref_->updateRef(robot, grid_info, cache_.ref(grid_info.stage));
+    }
+  }
+}
+
+
+void CachedConfigurationSpaceRef::clearCache() {
+  cache_.clear();
+}
+
+
+const std::shared_ptr<ConfigurationSpaceRefBase>& 
+CachedConfigurationSpaceRef::getRef() const {
+  return ref_;
+}
+
+
+void CachedConfigurationSpaceRef::updateRef(const Robot& robot, 
+                                            const GridInfo& grid_info, 
+                                            Eigen::VectorXd& q_ref) const {
+  if (cache_.isCached(grid_info)) {
+    q_ref = cache_.ref(grid_info.stage);
+  }
+  else {
+    ref_->updateRef(robot, grid_info, q_ref);
+  }
+}
+
+
+bool CachedConfigurationSpaceRef::isActive(const GridInfo& grid_info) const {
+  if (cache_.isCached(grid_info)) {
+    return cache_.isActive(grid_info.stage);
+  }
+  else {
+    return ref_->isActive(grid_info);
+  }
+}
+
+} // namespace robotoc
\ No newline at end of file
@@ -0,0 +1,69 @@
+#include "robotoc/cost/cached_task_space_3d_ref.hpp"
+
+#include <stdexcept>
+
+
+namespace robotoc {
+
+CachedTaskSpace3DRef::CachedTaskSpace3DRef(
+    const std::shared_ptr<TaskSpace3DRefBase>& ref)
+  : TaskSpace3DRefBase(),
+    ref_(ref),
+    cache_(3) {
+  if (ref == nullptr) {
+    throw std::invalid_argument("[CachedTaskSpace3DRef] invalid argument: 'ref' must not be nullptr!");
+  }
+}
+
+
+CachedTaskSpace3DRef::~CachedTaskSpace3DRef() {
+}
+
+
+void CachedTaskSpace3DRef::updateCache(
+    const TimeDiscretization& time_discretization) {
+  const int num_grids = time_discretization.size();
+  cache_.reset(num_grids);
+  for (int i=0; i<num_grids; ++i) {
+    const GridInfo& grid_info = time_discretization[i];
+    const bool is_active = ref_->isActive(grid_info);
+    cache_.cache(grid_info, is_active);
+    if (is_active) {
+      ref_->updateRef(grid_info, cache_.ref(grid_info.stage));
+    }
+  }
+}
+
+
+void CachedTaskSpace3DRef::clearCache() {
+  cache_.clear();
+}
+
+
+const std::shared_ptr<TaskSpace3DRefBase>& 
+CachedTaskSpace3DRef::getRef() const {
+  return ref_;
+}
+
+
+void CachedTaskSpace3DRef::updateRef(const GridInfo& grid_info, 
+                                     Eigen::VectorXd& x3d_ref) const {
+  if (cache_.isCached(grid_info)) {
+    x3d_ref = cache_.ref(grid_info.stage);
+  }
+  else {
+    ref_->updateRef(grid_info, x3d_ref);
+  }
+}
+
+
+bool CachedTaskSpace3DRef::isActive(const GridInfo& grid_info) const {
+  if (cache_.isCached(grid_info)) {
+    return cache_.isActive(grid_info.stage);
+  }
+  else {
+    return ref_->isActive(grid_info);
+  }
+}
+
+} // namespace robotoc
\ No newline at end of file
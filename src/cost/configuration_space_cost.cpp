@@ -247,198 +247,4 @@ void ConfigurationSpaceCost::set_dv_weight_impact(
   enable_dv_cost_impact_ = (!dv_weight_impact.isZero());
 }
 
-
-double ConfigurationSpaceCost::evalStageCost(Robot& robot, 
-                                             const ContactStatus& contact_status, 
-                                             CostFunctionData& data, 
-                                             const GridInfo& grid_info,
-                                             const SplitSolution& s) const {
-  double l = 0;
-  if (enable_q_cost_ && isCostConfigActive(grid_info)) {
-    evalConfigDiff(robot, data, grid_info, s.q);
-    l += (q_weight_.array()*(data.qdiff).array()*(data.qdiff).array()).sum();
-  }
-  if (enable_v_cost_) {
-    l += (v_weight_.array()*(s.v-v_ref_).array()*(s.v-v_ref_).array()).sum();
-  }
-  if (enable_a_cost_) {
-    l += (a_weight_.array()*s.a.array()*s.a.array()).sum();
-  }
-  if (enable_u_cost_) {
-    l += (u_weight_.array()*(s.u-u_ref_).array()*(s.u-u_ref_).array()).sum();
-  }
-  return 0.5 * grid_info.dt * l;
-}
-
-
-void ConfigurationSpaceCost::evalStageCostDerivatives(
-    Robot& robot, const ContactStatus& contact_status, CostFunctionData& data, 
-    const GridInfo& grid_info, const SplitSolution& s, 
-    SplitKKTResidual& kkt_residual) const {
-  if (enable_q_cost_ && isCostConfigActive(grid_info)) {
-    if (robot.hasFloatingBase()) {
-      evalConfigDiffJac(robot, data, grid_info, s.q);
-      kkt_residual.lq().noalias()
-          += grid_info.dt * data.J_qdiff.transpose() * q_weight_.asDiagonal() * data.qdiff;
-    }
-    else {
-      kkt_residual.lq().array() += grid_info.dt * q_weight_.array() * data.qdiff.array();
-    }
-  }
-  if (enable_v_cost_) {
-    kkt_residual.lv().array()
-        += grid_info.dt * v_weight_.array() * (s.v.array()-v_ref_.array());
-  }
-  if (enable_a_cost_) {
-    kkt_residual.la.array() += grid_info.dt * a_weight_.array() * s.a.array();
-  }
-  if (enable_u_cost_) {
-    kkt_residual.lu.array() 
-        += grid_info.dt * u_weight_.array() * (s.u.array()-u_ref_.array());
-  }
-}
-
-
-void ConfigurationSpaceCost::evalStageCostHessian(
-    Robot& robot, const ContactStatus& contact_status, CostFunctionData& data, 
-    const GridInfo& grid_info, const SplitSolution& s, 
-    SplitKKTMatrix& kkt_matrix) const {
-  if (enable_q_cost_ && isCostConfigActive(grid_info)) {
-    if (robot.hasFloatingBase()) {
-      kkt_matrix.Qqq().noalias()
-          += grid_info.dt * data.J_qdiff.transpose() * q_weight_.asDiagonal() * data.J_qdiff;
-    }
-    else {
-      kkt_matrix.Qqq().diagonal().noalias() += grid_info.dt * q_weight_;
-    }
-  }
-  if (enable_v_cost_) {
-    kkt_matrix.Qvv().diagonal().noalias() += grid_info.dt * v_weight_;
-  }
-  if (enable_a_cost_) {
-    kkt_matrix.Qaa.diagonal().noalias() += grid_info.dt * a_weight_;
-  }
-  if (enable_u_cost_) {
-    kkt_matrix.Quu.diagonal().noalias() += grid_info.dt * u_weight_;
-  }
-}
-
-
-double ConfigurationSpaceCost::evalTerminalCost(Robot& robot, 
-                                                CostFunctionData& data, 
-                                                const GridInfo& grid_info, 
-                                                const SplitSolution& s) const {
-  double l = 0;
-  if (enable_q_cost_terminal_ && isCostConfigActive(grid_info)) {
-    evalConfigDiff(robot, data, grid_info, s.q);
-    l += (q_weight_terminal_.array()*(data.qdiff).array()*(data.qdiff).array()).sum();
-  }
-  if (enable_v_cost_terminal_) {
-    l += (v_weight_terminal_.array()*(s.v-v_ref_).array()*(s.v-v_ref_).array()).sum();
-  }
-  return 0.5 * l;
-}
-
-
-void ConfigurationSpaceCost::evalTerminalCostDerivatives(
-    Robot& robot, CostFunctionData& data, const GridInfo& grid_info, 
-    const SplitSolution& s, SplitKKTResidual& kkt_residual) const {
-  if (enable_q_cost_terminal_ && isCostConfigActive(grid_info)) {
-    if (robot.hasFloatingBase()) {
-      evalConfigDiffJac(robot, data, grid_info, s.q);
-      kkt_residual.lq().noalias()
-          += data.J_qdiff.transpose() * q_weight_terminal_.asDiagonal() * data.qdiff;
-    }
-    else {
-      kkt_residual.lq().array() += q_weight_terminal_.array() * data.qdiff.array();
-    }
-  }
-  if (enable_v_cost_terminal_) {
-    kkt_residual.lv().array()
-        += v_weight_terminal_.array() * (s.v.array()-v_ref_.array());
-  }
-}
-
-
-void ConfigurationSpaceCost::evalTerminalCostHessian(
-    Robot& robot, CostFunctionData& data, const GridInfo& grid_info,
-    const SplitSolution& s, SplitKKTMatrix& kkt_matrix) const {
-  if (enable_q_cost_terminal_ && isCostConfigActive(grid_info)) {
-    if (robot.hasFloatingBase()) {
-      kkt_matrix.Qqq().noalias()
-          += data.J_qdiff.transpose() * q_weight_terminal_.asDiagonal() * data.J_qdiff;
-    }
-    else {
-      kkt_matrix.Qqq().diagonal().noalias() += q_weight_terminal_;
-    }
-  }
-  if (enable_v_cost_terminal_) {
-    kkt_matrix.Qvv().diagonal().noalias() += v_weight_terminal_;
-  }
-}
-
-
-double ConfigurationSpaceCost::evalImpactCost(
-    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
-    const GridInfo& grid_info, const SplitSolution& s) const {
-  double l = 0;
-  if (enable_q_cost_impact_ && isCostConfigActive(grid_info)) {
-    evalConfigDiff(robot, data, grid_info, s.q);
-    l += (q_weight_impact_.array()*(data.qdiff).array()*(data.qdiff).array()).sum();
-  }
-  if (enable_v_cost_impact_) {
-    l += (v_weight_impact_.array()*(s.v-v_ref_).array()*(s.v-v_ref_).array()).sum();
-  }
-  if (enable_dv_cost_impact_) {
-    l += (dv_weight_impact_.array()*s.dv.array()*s.dv.array()).sum();
-  }
-  return 0.5 * l;
-}
-
-
-void ConfigurationSpaceCost::evalImpactCostDerivatives(
-    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
-    const GridInfo& grid_info, const SplitSolution& s, 
-    SplitKKTResidual& kkt_residual) const {
-  if (enable_q_cost_impact_ && isCostConfigActive(grid_info)) {
-    if (robot.hasFloatingBase()) {
-      evalConfigDiffJac(robot, data, grid_info, s.q);
-      kkt_residual.lq().noalias()
-          += data.J_qdiff.transpose() * q_weight_impact_.asDiagonal() * data.qdiff;
-    }
-    else {
-      kkt_residual.lq().array() += q_weight_impact_.array() * data.qdiff.array();
-    }
-  }
-  if (enable_v_cost_impact_) {
-    kkt_residual.lv().array()
-        += v_weight_impact_.array() * (s.v.array()-v_ref_.array());
-  }
-  if (enable_dv_cost_impact_) {
-    kkt_residual.ldv.array() += dv_weight_impact_.array() * s.dv.array();
-  }
-}
-
-
-void ConfigurationSpaceCost::evalImpactCostHessian(
-    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
-    const GridInfo& grid_info, const SplitSolution& s, 
-    SplitKKTMatrix& kkt_matrix) const {
-  if (enable_q_cost_impact_ && isCostConfigActive(grid_info)) {
-    if (robot.hasFloatingBase()) {
-      kkt_matrix.Qqq().noalias()
-          += data.J_qdiff.transpose() * q_weight_impact_.asDiagonal() * data.J_qdiff;
-    }
-    else {
-      kkt_matrix.Qqq().diagonal().noalias() += q_weight_impact_;
-    }
-  }
-  if (enable_v_cost_impact_) {
-    kkt_matrix.Qvv().diagonal().noalias() += v_weight_impact_;
-  }
-  if (enable_dv_cost_impact_) {
-    kkt_matrix.Qdvdv.diagonal().noalias() += dv_weight_impact_;
-  }
-}
-
 } // namespace robotoc
\ No newline at end of file
@@ -113,6 +113,12 @@ void CostFunction::clear() {
 
 CostFunctionData CostFunction::createCostFunctionData(const Robot& robot) const {
   auto data = CostFunctionData(robot);
+  for (const auto e : costs_) {
+    if (e->hasFusedEvaluation()) {
+      data.kkt_residual = SplitKKTResidual(robot);
+      break;
+    }
+  }
   return data;
 }
 
@@ -144,6 +150,11 @@ double CostFunction::linearizeStageCost(Robot& robot,
   assert(grid_info.dt > 0);
   double l = 0;
   for (const auto e : costs_) {
+    if (e->hasFusedEvaluation()) {
+      l += e->linearizeStageCost(robot, contact_status, data, grid_info, s, 
+                                 kkt_residual);
+      continue;
+    }
     l += e->evalStageCost(robot, contact_status, data, grid_info, s);
     e->evalStageCostDerivatives(robot, contact_status, data, grid_info, s,
                                 kkt_residual);
@@ -172,6 +183,11 @@ double CostFunction::quadratizeStageCost(Robot& robot,
   assert(grid_info.dt > 0);
   double l = 0;
   for (const auto e : costs_) {
+    if (e->hasFusedEvaluation()) {
+      l += e->quadratizeStageCost(robot, contact_status, data, grid_info, s, 
+                                  kkt_residual, kkt_matrix);
+      continue;
+    }
     l += e->evalStageCost(robot, contact_status, data, grid_info, s);
     e->evalStageCostDerivatives(robot, contact_status, data, grid_info, s,
                                 kkt_residual);
@@ -219,6 +235,10 @@ double CostFunction::linearizeTerminalCost(Robot& robot, CostFunctionData& data,
                                            SplitKKTResidual& kkt_residual) const {
   double l = 0;
   for (const auto e : costs_) {
+    if (e->hasFusedEvaluation()) {
+      l += e->linearizeTerminalCost(robot, data, grid_info, s, kkt_residual);
+      continue;
+    }
     l += e->evalTerminalCost(robot, data, grid_info, s);
     e->evalTerminalCostDerivatives(robot, data, grid_info, s, kkt_residual);
   }
@@ -239,6 +259,11 @@ double CostFunction::quadratizeTerminalCost(Robot& robot,
                                             SplitKKTMatrix& kkt_matrix) const {
   double l = 0;
   for (const auto e : costs_) {
+    if (e->hasFusedEvaluation()) {
+      l += e->quadratizeTerminalCost(robot, data, grid_info, s, kkt_residual, 
+                                     kkt_matrix);
+      continue;
+    }
     l += e->evalTerminalCost(robot, data, grid_info, s);
     e->evalTerminalCostDerivatives(robot, data, grid_info, s, kkt_residual);
     e->evalTerminalCostHessian(robot, data, grid_info, s, kkt_matrix);
@@ -278,6 +303,11 @@ double CostFunction::linearizeImpactCost(Robot& robot,
                                           SplitKKTResidual& kkt_residual) const {
   double l = 0;
   for (const auto e : costs_) {
+    if (e->hasFusedEvaluation()) {
+      l += e->linearizeImpactCost(robot, impact_status, data, grid_info, s, 
+                                  kkt_residual);
+      continue;
+    }
     l += e->evalImpactCost(robot, impact_status, data, grid_info, s);
     e->evalImpactCostDerivatives(robot, impact_status, data, grid_info, s, 
                                   kkt_residual);
@@ -304,6 +334,11 @@ double CostFunction::quadratizeImpactCost(Robot& robot,
                                            SplitKKTMatrix& kkt_matrix) const {
   double l = 0;
   for (const auto e : costs_) {
+    if (e->hasFusedEvaluation()) {
+      l += e->quadratizeImpactCost(robot, impact_status, data, grid_info, s, 
+                                   kkt_residual, kkt_matrix);
+      continue;
+    }
     l += e->evalImpactCost(robot, impact_status, data, grid_info, s);
     e->evalImpactCostDerivatives(robot, impact_status, data, grid_info, s, 
                                   kkt_residual);
@@ -15,7 +15,8 @@ CostFunctionData::CostFunctionData(const Robot& robot)
     J_6d(Eigen::MatrixXd::Zero(6, robot.dimv())),
     J_3d(Eigen::MatrixXd::Zero(3, robot.dimv())),
     J_66(Eigen::MatrixXd::Zero(6, 6)),
-    JJ_6d(Eigen::MatrixXd::Zero(6, robot.dimv())) {
+    JJ_6d(Eigen::MatrixXd::Zero(6, robot.dimv())),
+    kkt_residual() {
   if (robot.hasFloatingBase()) {
     qdiff.resize(robot.dimv());
     qdiff.setZero();
@@ -38,7 +39,8 @@ CostFunctionData::CostFunctionData()
     J_6d(),
     J_3d(),
     J_66(),
-    JJ_6d() {
+    JJ_6d(),
+    kkt_residual() {
 }
 
 } // namespace robotoc
\ No newline at end of file
@@ -0,0 +1,63 @@
+#include "robotoc/cost/grid_ref_cache.hpp"
+
+#include <stdexcept>
+#include <algorithm>
+#include <string>
+
+
+namespace robotoc {
+
+GridRefCache::GridRefCache(const int dim)
+  : dim_(dim),
+    num_grids_(0),
+    grids_(),
+    refs_(),
+    is_active_(),
+    is_cached_() {
+  if (dim < 0) {
+    throw std::out_of_range("[GridRefCache] invalid argument: 'dim' must be non-negative!");
+  }
+}
+
+
+GridRefCache::GridRefCache()
+  : dim_(0),
+    num_grids_(0),
+    grids_(),
+    refs_(),
+    is_active_(),
+    is_cached_() {
+}
+
+
+void GridRefCache::reset(const int num_grids) {
+  if (num_grids < 0) {
+    throw std::out_of_range("[GridRefCache] invalid argument: 'num_grids' must be non-negative!");
+  }
+  if (num_grids > static_cast<int>(refs_.size())) {
+    grids_.resize(num_grids);
+    refs_.resize(num_grids, Eigen::VectorXd::Zero(dim_));
+    is_active_.resize(num_grids, false);
+    is_cached_.resize(num_grids, false);
+  }
+  num_grids_ = num_grids;
+  clear();
+}
+
+
+void GridRefCache::clear() {
+  std::fill(is_cached_.begin(), is_cached_.end(), false);
+}
+
+
+void GridRefCache::cache(const GridInfo& grid_info, const bool is_active) {
+  const int stage = grid_info.stage;
+  if (stage < 0 || stage >= num_grids_) {
+    throw std::out_of_range("[GridRefCache] invalid argument: 'grid_info.stage' must be in [0, " + std::to_string(num_grids_) + ")!");
+  }
+  grids_[stage] = grid_info;
+  is_active_[stage] = is_active;
+  is_cached_[stage] = true;
+}
+
+} // namespace robotoc
\ No newline at end of file
@@ -114,128 +114,4 @@ void TaskSpace3DCost::set_weight_impact(const Eigen::Vector3d& weight_impact) {
   enable_cost_impact_ = (!weight_impact.isZero());
 }
 
-
-double TaskSpace3DCost::evalStageCost(Robot& robot, 
-                                      const ContactStatus& contact_status, 
-                                      CostFunctionData& data, 
-                                      const GridInfo& grid_info, 
-                                      const SplitSolution& s) const {
-  if (enable_cost_ && isCostActive(grid_info)) {
-    evalDiff(robot, data, grid_info);
-    const double l = (weight_.array()*data.diff_3d.array()*data.diff_3d.array()).sum();
-    return 0.5 * grid_info.dt * l;
-  }
-  else {
-    return 0.0;
-  }
-}
-
-
-void TaskSpace3DCost::evalStageCostDerivatives(
-    Robot& robot, const ContactStatus& contact_status, CostFunctionData& data, 
-    const GridInfo& grid_info, const SplitSolution& s, 
-    SplitKKTResidual& kkt_residual) const {
-  if (enable_cost_ && isCostActive(grid_info)) {
-    data.J_6d.setZero();
-    robot.getFrameJacobian(frame_id_, data.J_6d);
-    data.J_3d.noalias() 
-        = robot.frameRotation(frame_id_) * data.J_6d.template topRows<3>();
-    kkt_residual.lq().noalias() 
-        += grid_info.dt * data.J_3d.transpose() * weight_.asDiagonal() * data.diff_3d;
-  }
-}
-
-
-void TaskSpace3DCost::evalStageCostHessian(Robot& robot, 
-                                           const ContactStatus& contact_status, 
-                                           CostFunctionData& data, 
-                                           const GridInfo& grid_info, 
-                                           const SplitSolution& s, 
-                                           SplitKKTMatrix& kkt_matrix) const {
-  if (enable_cost_ && isCostActive(grid_info)) {
-    kkt_matrix.Qqq().noalias()
-        += grid_info.dt * data.J_3d.transpose() * weight_.asDiagonal() * data.J_3d;
-  }
-}
-
-
-double TaskSpace3DCost::evalTerminalCost(Robot& robot, CostFunctionData& data, 
-                                         const GridInfo& grid_info, 
-                                         const SplitSolution& s) const {
-  if (enable_cost_terminal_ && isCostActive(grid_info)) {
-    evalDiff(robot, data, grid_info);
-    const double l = (weight_terminal_.array()*data.diff_3d.array()*data.diff_3d.array()).sum();
-    return 0.5 * l;
-  }
-  else {
-    return 0.0;
-  }
-}
-
-
-void TaskSpace3DCost::evalTerminalCostDerivatives(
-    Robot& robot, CostFunctionData& data, const GridInfo& grid_info, 
-    const SplitSolution& s, SplitKKTResidual& kkt_residual) const {
-  if (enable_cost_terminal_ && isCostActive(grid_info)) {
-    data.J_6d.setZero();
-    robot.getFrameJacobian(frame_id_, data.J_6d);
-    data.J_3d.noalias() 
-        = robot.frameRotation(frame_id_) * data.J_6d.template topRows<3>();
-    kkt_residual.lq().noalias() 
-        += data.J_3d.transpose() * weight_terminal_.asDiagonal() * data.diff_3d;
-  }
-}
-
-
-void TaskSpace3DCost::evalTerminalCostHessian(
-    Robot& robot, CostFunctionData& data, const GridInfo& grid_info, 
-    const SplitSolution& s, SplitKKTMatrix& kkt_matrix) const {
-  if (enable_cost_terminal_ && isCostActive(grid_info)) {
-    kkt_matrix.Qqq().noalias()
-        += data.J_3d.transpose() * weight_terminal_.asDiagonal() * data.J_3d;
-  }
-}
-
-
-double TaskSpace3DCost::evalImpactCost(Robot& robot,  
-                                        const ImpactStatus& impact_status,
-                                        CostFunctionData& data, 
-                                        const GridInfo& grid_info, 
-                                        const SplitSolution& s) const {
-  if (enable_cost_impact_ && isCostActive(grid_info)) {
-    evalDiff(robot, data, grid_info);
-    const double l = (weight_impact_.array()*data.diff_3d.array()*data.diff_3d.array()).sum();
-    return 0.5 * l;
-  }
-  else {
-    return 0.0;
-  }
-}
-
-
-void TaskSpace3DCost::evalImpactCostDerivatives(
-    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
-    const GridInfo& grid_info, const SplitSolution& s, 
-    SplitKKTResidual& kkt_residual) const {
-  if (enable_cost_impact_ && isCostActive(grid_info)) {
-    data.J_6d.setZero();
-    robot.getFrameJacobian(frame_id_, data.J_6d);
-    data.J_3d.noalias() 
-        = robot.frameRotation(frame_id_) * data.J_6d.template topRows<3>();
-    kkt_residual.lq().noalias() 
-        += data.J_3d.transpose() * weight_impact_.asDiagonal() * data.diff_3d;
-  }
-}
-
-
-void TaskSpace3DCost::evalImpactCostHessian(
-    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
-    const GridInfo& grid_info, const SplitSolution& s, 
-    SplitKKTMatrix& kkt_matrix) const {
-  if (enable_cost_impact_ && isCostActive(grid_info)) {
-    kkt_matrix.Qqq().noalias()
-        += data.J_3d.transpose() * weight_impact_.asDiagonal() * data.J_3d;
-  }
-}
-
 } // namespace robotoc
\ No newline at end of file
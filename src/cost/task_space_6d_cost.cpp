@@ -160,131 +160,4 @@ void TaskSpace6DCost::set_weight_impact(
   enable_cost_impact_ = (!weight_impact_.isZero());
 }
 
-
-double TaskSpace6DCost::evalStageCost(Robot& robot, 
-                                      const ContactStatus& contact_status, 
-                                      CostFunctionData& data, 
-                                      const GridInfo& grid_info, 
-                                      const SplitSolution& s) const {
-  if (enable_cost_ && isCostActive(grid_info)) {
-    evalDiff(robot, data, grid_info);
-    const double l = (weight_.array()*data.diff_6d.array()*data.diff_6d.array()).sum();
-    return 0.5 * grid_info.dt * l;
-  }
-  else {
-    return 0.0;
-  }
-}
-
-
-void TaskSpace6DCost::evalStageCostDerivatives(
-    Robot& robot, const ContactStatus& contact_status, CostFunctionData& data, 
-    const GridInfo& grid_info, const SplitSolution& s, 
-    SplitKKTResidual& kkt_residual) const {
-  if (enable_cost_ && isCostActive(grid_info)) {
-    data.J_66.setZero();
-    computeJLog6Map(data.diff_x6d, data.J_66);
-    data.J_6d.setZero();
-    robot.getFrameJacobian(frame_id_, data.J_6d);
-    data.JJ_6d.noalias() = data.J_66 * data.J_6d;
-    kkt_residual.lq().noalias() 
-        += grid_info.dt * data.JJ_6d.transpose() * weight_.asDiagonal() * data.diff_6d;
-  }
-}
-
-
-void TaskSpace6DCost::evalStageCostHessian(Robot& robot, 
-                                           const ContactStatus& contact_status, 
-                                           CostFunctionData& data, 
-                                           const GridInfo& grid_info, 
-                                           const SplitSolution& s, 
-                                           SplitKKTMatrix& kkt_matrix) const {
-  if (enable_cost_ && isCostActive(grid_info)) {
-    kkt_matrix.Qqq().noalias()
-        += grid_info.dt * data.JJ_6d.transpose() * weight_.asDiagonal() * data.JJ_6d;
-  }
-}
-
-
-double TaskSpace6DCost::evalTerminalCost(Robot& robot, CostFunctionData& data, 
-                                         const GridInfo& grid_info, 
-                                         const SplitSolution& s) const {
-  if (enable_cost_terminal_ && isCostActive(grid_info)) {
-    evalDiff(robot, data, grid_info);
-    const double l = (weight_terminal_.array()*data.diff_6d.array()*data.diff_6d.array()).sum();
-    return 0.5 * l;
-  }
-  else {
-    return 0.0;
-  }
-}
-
-
-void TaskSpace6DCost::evalTerminalCostDerivatives(
-    Robot& robot, CostFunctionData& data, const GridInfo& grid_info, 
-    const SplitSolution& s, SplitKKTResidual& kkt_residual) const {
-  if (enable_cost_terminal_ && isCostActive(grid_info)) {
-    data.J_66.setZero();
-    computeJLog6Map(data.diff_x6d, data.J_66);
-    data.J_6d.setZero();
-    robot.getFrameJacobian(frame_id_, data.J_6d);
-    data.JJ_6d.noalias() = data.J_66 * data.J_6d;
-    kkt_residual.lq().noalias() 
-        += data.JJ_6d.transpose() * weight_terminal_.asDiagonal() * data.diff_6d;
-  }
-}
-
-
-void TaskSpace6DCost::evalTerminalCostHessian(
-    Robot& robot, CostFunctionData& data, const GridInfo& grid_info, 
-    const SplitSolution& s, SplitKKTMatrix& kkt_matrix) const {
-  if (enable_cost_terminal_ && isCostActive(grid_info)) {
-    kkt_matrix.Qqq().noalias()
-        += data.JJ_6d.transpose() * weight_terminal_.asDiagonal() * data.JJ_6d;
-  }
-}
-
-
-double TaskSpace6DCost::evalImpactCost(Robot& robot, 
-                                        const ImpactStatus& impact_status,
-                                        CostFunctionData& data, 
-                                        const GridInfo& grid_info, 
-                                        const SplitSolution& s) const {
-  if (enable_cost_impact_ && isCostActive(grid_info)) {
-    evalDiff(robot, data, grid_info);
-    const double l = (weight_impact_.array()*data.diff_6d.array()*data.diff_6d.array()).sum();
-    return 0.5 * l;
-  }
-  else {
-    return 0.0;
-  }
-}
-
-
-void TaskSpace6DCost::evalImpactCostDerivatives(
-    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
-    const GridInfo& grid_info, const SplitSolution& s, 
-    SplitKKTResidual& kkt_residual) const {
-  if (enable_cost_impact_ && isCostActive(grid_info)) {
-    data.J_66.setZero();
-    computeJLog6Map(data.diff_x6d, data.J_66);
-    data.J_6d.setZero();
-    robot.getFrameJacobian(frame_id_, data.J_6d);
-    data.JJ_6d.noalias() = data.J_66 * data.J_6d;
-    kkt_residual.lq().noalias() 
-        += data.JJ_6d.transpose() * weight_impact_.asDiagonal() * data.diff_6d;
-  }
-}
-
-
-void TaskSpace6DCost::evalImpactCostHessian(
-    Robot& robot, const ImpactStatus& impact_status, CostFunctionData& data, 
-    const GridInfo& grid_info, const SplitSolution& s, 
-    SplitKKTMatrix& kkt_matrix) const {
-  if (enable_cost_impact_ && isCostActive(grid_info)) {
-    kkt_matrix.Qqq().noalias()
-        += data.JJ_6d.transpose() * weight_impact_.asDiagonal() * data.JJ_6d;
-  }
-}
-
 } // namespace robotoc
\ No newline at end of file
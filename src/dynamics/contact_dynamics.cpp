@@ -7,6 +7,146 @@ namespace robotoc {
 
 namespace {
   constexpr int dim_floating_base = 6;
+
+  template <int Dimf>
+  void factorizeMJtJ(Robot& robot, ContactDynamicsData& data) {
+    robot.template factorizeMJtJ<Dimf>(data.dIDda, data.dCda());
+  }
+
+  template <>
+  void factorizeMJtJ<0>(Robot& robot, ContactDynamicsData& data) {
+    robot.factorizeMJtJ(data.dIDda, data.dCda());
+  }
+
+  template <>
+  void factorizeMJtJ<Eigen::Dynamic>(Robot& robot, ContactDynamicsData& data) {
+    robot.factorizeMJtJ(data.dIDda, data.dCda());
+  }
+
+  template <int Dimf>
+  void condenseContactDynamics(Robot& robot, const double dt, 
+                               ContactDynamicsData& data, 
+                               SplitKKTMatrix& kkt_matrix, 
+                               SplitKKTResidual& kkt_residual) {
+    const int dimv = robot.dimv();
+    const int dimu = robot.dimu();
+    const int dim_passive = robot.dim_passive();
+    const int dimf = data.dimf();
+    assert(Dimf == Eigen::Dynamic || Dimf == dimf);
+    factorizeMJtJ<Dimf>(robot, data);
+    data.MJtJinv_dIDCdqv() = data.dIDCdqv();
+    robot.solveMJtJ(data.MJtJinv_dIDCdqv());
+    data.MJtJinv_IDC() = data.IDC();
+    robot.solveMJtJ(data.MJtJinv_IDC());
+    data.MJtJinv_IO().setZero();
+    data.MJtJinv_IO().topRows(dimv).setIdentity();
+    robot.solveMJtJ(data.MJtJinv_IO());
+    data.swapMJtJFactorization(robot);
+
+    const auto Qff = kkt_matrix.Qff().template topLeftCorner<Dimf, Dimf>(dimf, dimf);
+    const auto Qqf = kkt_matrix.Qqf().template leftCols<Dimf>(dimf);
+    const auto MJtJinv_dIDCdqv_f 
+        = data.MJtJinv_dIDCdqv().template bottomRows<Dimf>(dimf);
+    const auto MJtJinv_IDC_f 
+        = data.MJtJinv_IDC().template segment<Dimf>(dimv, dimf);
+    const auto MJtJinv_fa 
+        = data.MJtJinv_IO().template bottomRows<Dimf>(dimf);
+
+    data.Qafqv().topRows(dimv).noalias() 
+        = (- kkt_matrix.Qaa.diagonal()).asDiagonal() 
+            * data.MJtJinv_dIDCdqv().topRows(dimv);
+    data.Qafqv().template bottomRows<Dimf>(dimf).noalias() 
+        = - Qff * MJtJinv_dIDCdqv_f;
+    data.Qafqv().template block<Dimf, Eigen::Dynamic>(dimv, 0, dimf, dimv).noalias()
+        -= Qqf.transpose();
+    data.Qafu_full().topRows(dimv).noalias() 
+        = kkt_matrix.Qaa.diagonal().asDiagonal() 
+            * data.MJtJinv_IO().topRows(dimv);
+    data.Qafu_full().template bottomRows<Dimf>(dimf).noalias() 
+        = Qff * MJtJinv_fa;
+    data.la() = kkt_residual.la;
+    data.lf() = - kkt_residual.lf();
+    data.la().noalias() 
+        -= kkt_matrix.Qaa.diagonal().asDiagonal() 
+            * data.MJtJinv_IDC().head(dimv);
+    data.lf().template head<Dimf>(dimf).noalias() -= Qff * MJtJinv_IDC_f;
+
+    kkt_matrix.Qxx.noalias() 
+        -= data.MJtJinv_dIDCdqv().transpose() * data.Qafqv();
+    kkt_matrix.Qxx.topRows(dimv).noalias() += Qqf * MJtJinv_dIDCdqv_f;
+    if (data.hasFloatingBase()) {
+      data.Qxu_passive.noalias() 
+          = - data.MJtJinv_dIDCdqv().transpose() * data.Qafu_full().leftCols(dim_passive);
+      data.Qxu_passive.topRows(dimv).noalias()
+          -= Qqf * MJtJinv_fa.leftCols(dim_passive);
+      kkt_matrix.Qxu.noalias() 
+          -= data.MJtJinv_dIDCdqv().transpose() * data.Qafu_full().rightCols(dimu);
+      kkt_matrix.Qxu.topRows(dimv).noalias()
+          -= Qqf * MJtJinv_fa.rightCols(dimu);
+    }
+    else {
+      kkt_matrix.Qxu.noalias() 
+          -= data.MJtJinv_dIDCdqv().transpose() * data.Qafu_full();
+      kkt_matrix.Qxu.topRows(dimv).noalias() -= Qqf * MJtJinv_fa;
+    }
+    kkt_residual.lx.noalias() 
+        -= data.MJtJinv_dIDCdqv().transpose() * data.laf();
+    kkt_residual.lq().noalias() += Qqf * MJtJinv_IDC_f;
+
+    if (data.hasFloatingBase()) {
+      data.Quu_passive_topRight.noalias() 
+          = data.MJtJinv_IO().leftCols(dim_passive).transpose() 
+              * data.Qafu_full().rightCols(dimu);
+      kkt_matrix.Quu.noalias() 
+          += data.MJtJinv_IO().middleCols(dim_passive, dimu).transpose() 
+              * data.Qafu_full().rightCols(dimu);
+    }
+    else {
+      kkt_matrix.Quu.noalias() 
+          += data.MJtJinv_IO().transpose() * data.Qafu_full();
+    }
+    if (data.hasFloatingBase()) {
+      data.lu_passive.noalias() 
+          += data.MJtJinv_IO().template leftCols<dim_floating_base>().transpose() 
+              * data.laf();
+    }
+    kkt_residual.lu.noalias() 
+        += data.MJtJinv_IO().middleCols(dim_passive, dimu).transpose() * data.laf();
+
+    kkt_matrix.Fvq() = - dt * data.MJtJinv_dIDCdqv().topLeftCorner(dimv, dimv);
+    kkt_matrix.Fvv().noalias() 
+          = - dt * data.MJtJinv_dIDCdqv().topRightCorner(dimv, dimv) 
+            + Eigen::MatrixXd::Identity(dimv, dimv);
+    kkt_matrix.Fvu = dt * data.MJtJinv_IO().block(0, dim_passive, dimv, dimu);
+    kkt_residual.Fv().noalias() -= dt * data.MJtJinv_IDC().head(dimv);
+
+    // Switching constraint
+    if (kkt_matrix.dims() > 0) {
+      assert(kkt_matrix.dims() == kkt_residual.dims());
+      data.setSwitchingConstraintDimension(kkt_matrix.dims());
+      data.Phia() = kkt_matrix.Phia();
+      kkt_matrix.Phix().noalias() 
+          -= data.Phia() * data.MJtJinv_dIDCdqv().topRows(data.dimv());
+      kkt_matrix.Phiu().noalias()  
+          = data.Phia() * data.MJtJinv_IO().block(0, dim_passive, dimv, dimu);
+      kkt_matrix.Phit().noalias() 
+          -= data.Phia() * data.MJtJinv_IDC().head(data.dimv());
+      kkt_residual.P().noalias() 
+          -= data.Phia() * data.MJtJinv_IDC().head(data.dimv());
+    }
+    else {
+      data.setSwitchingConstraintDimension(0);
+    }
+
+    // STO sensitivities
+    data.ha() = kkt_matrix.ha;
+    data.hf() = - kkt_matrix.hf();
+    kkt_residual.h -= data.MJtJinv_IDC().dot(data.haf()); 
+    kkt_matrix.hx.noalias() -= data.MJtJinv_dIDCdqv().transpose() * data.haf();
+    kkt_matrix.hq().noalias() += (1.0/dt) * Qqf * MJtJinv_IDC_f;
+    kkt_matrix.hu.noalias() 
+        += data.MJtJinv_IO().middleCols(dim_passive, dimu).transpose() * data.haf();
+  }
 } 
 
 void evalContactDynamics(Robot& robot, const ContactStatus& contact_status, 
@@ -57,110 +197,28 @@ void condenseContactDynamics(Robot& robot, const ContactStatus& contact_status,
                              SplitKKTMatrix& kkt_matrix, 
                              SplitKKTResidual& kkt_residual) {
   assert(dt > 0);
-  const int dimv = robot.dimv();
-  const int dimu = robot.dimu();
-  const int dim_passive = robot.dim_passive();
-  const int dimf = contact_status.dimf();
-  robot.computeMJtJinv(data.dIDda, data.dCda(), data.MJtJinv());
-  data.MJtJinv_dIDCdqv().noalias() = data.MJtJinv() * data.dIDCdqv();
-  data.MJtJinv_IDC().noalias()     = data.MJtJinv() * data.IDC();
-
-  data.Qafqv().topRows(dimv).noalias() 
-      = (- kkt_matrix.Qaa.diagonal()).asDiagonal() 
-          * data.MJtJinv_dIDCdqv().topRows(dimv);
-  data.Qafqv().bottomRows(dimf).noalias() 
-      = - kkt_matrix.Qff() * data.MJtJinv_dIDCdqv().bottomRows(dimf);
-  data.Qafqv().bottomLeftCorner(dimf, dimv).noalias()
-      -= kkt_matrix.Qqf().transpose();
-  data.Qafu_full().topRows(dimv).noalias() 
-      = kkt_matrix.Qaa.diagonal().asDiagonal() 
-          * data.MJtJinv().topLeftCorner(dimv, dimv);
-  data.Qafu_full().bottomRows(dimf).noalias() 
-      = kkt_matrix.Qff() * data.MJtJinv().bottomLeftCorner(dimf, dimv);
-  data.la() = kkt_residual.la;
-  data.lf() = - kkt_residual.lf();
-  data.la().noalias() 
-      -= kkt_matrix.Qaa.diagonal().asDiagonal() 
-          * data.MJtJinv_IDC().head(dimv);
-  data.lf().noalias() 
-      -= kkt_matrix.Qff() * data.MJtJinv_IDC().tail(dimf);
-
-  kkt_matrix.Qxx.noalias() 
-      -= data.MJtJinv_dIDCdqv().transpose() * data.Qafqv();
-  kkt_matrix.Qxx.topRows(dimv).noalias() 
-      += kkt_matrix.Qqf() * data.MJtJinv_dIDCdqv().bottomRows(dimf);
-  if (data.hasFloatingBase()) {
-    data.Qxu_passive.noalias() 
-        = - data.MJtJinv_dIDCdqv().transpose() * data.Qafu_full().leftCols(dim_passive);
-    data.Qxu_passive.topRows(dimv).noalias()
-        -= kkt_matrix.Qqf() * data.MJtJinv().bottomLeftCorner(dimf, dimv).leftCols(dim_passive);
-    kkt_matrix.Qxu.noalias() 
-        -= data.MJtJinv_dIDCdqv().transpose() * data.Qafu_full().rightCols(dimu);
-    kkt_matrix.Qxu.topRows(dimv).noalias()
-        -= kkt_matrix.Qqf() * data.MJtJinv().bottomLeftCorner(dimf, dimv).rightCols(dimu);
-  }
-  else {
-    kkt_matrix.Qxu.noalias() 
-        -= data.MJtJinv_dIDCdqv().transpose() * data.Qafu_full();
-    kkt_matrix.Qxu.topRows(dimv).noalias()
-        -= kkt_matrix.Qqf() * data.MJtJinv().bottomLeftCorner(dimf, dimv);
-  }
-  kkt_residual.lx.noalias() 
-      -= data.MJtJinv_dIDCdqv().transpose() * data.laf();
-  kkt_residual.lq().noalias()
-      += kkt_matrix.Qqf() * data.MJtJinv_IDC().tail(dimf);
-
-  if (data.hasFloatingBase()) {
-    data.Quu_passive_topRight.noalias() 
-        = data.MJtJinv().topRows(dim_passive) * data.Qafu_full().rightCols(dimu);
-    kkt_matrix.Quu.noalias() 
-        += data.MJtJinv().middleRows(dim_passive, dimu) * data.Qafu_full().rightCols(dimu);
-  }
-  else {
-    kkt_matrix.Quu.noalias() 
-        += data.MJtJinv().topRows(dimv) * data.Qafu_full();
+  // Dispatches the point-contact dimensions to the fixed-size kernels.
+  switch (contact_status.dimf()) {
+    case 0:
+      condenseContactDynamics<0>(robot, dt, data, kkt_matrix, kkt_residual);
+      break;
+    case 3:
+      condenseContactDynamics<3>(robot, dt, data, kkt_matrix, kkt_residual);
+      break;
+    case 6:
+      condenseContactDynamics<6>(robot, dt, data, kkt_matrix, kkt_residual);
+      break;
+    case 9:
+      condenseContactDynamics<9>(robot, dt, data, kkt_matrix, kkt_residual);
+      break;
+    case 12:
+      condenseContactDynamics<12>(robot, dt, data, kkt_matrix, kkt_residual);
+      break;
+    default:
+      condenseContactDynamics<Eigen::Dynamic>(robot, dt, data, kkt_matrix, 
+                                              kkt_residual);
+      break;
   }
-  if (data.hasFloatingBase()) {
-    data.lu_passive.noalias() 
-        += data.MJtJinv().template topRows<dim_floating_base>() * data.laf();
-  }
-  kkt_residual.lu.noalias() 
-      += data.MJtJinv().middleRows(dim_passive, dimu) * data.laf();
-
-  kkt_matrix.Fvq() = - dt * data.MJtJinv_dIDCdqv().topLeftCorner(dimv, dimv);
-  kkt_matrix.Fvv().noalias() 
-        = - dt * data.MJtJinv_dIDCdqv().topRightCorner(dimv, dimv) 
-          + Eigen::MatrixXd::Identity(dimv, dimv);
-  kkt_matrix.Fvu = dt * data.MJtJinv().block(0, dim_passive, dimv, dimu);
-  kkt_residual.Fv().noalias() -= dt * data.MJtJinv_IDC().head(dimv);
-
-  // Switching constraint
-  if (kkt_matrix.dims() > 0) {
-    assert(kkt_matrix.dims() == kkt_residual.dims());
-    data.setSwitchingConstraintDimension(kkt_matrix.dims());
-    data.Phia() = kkt_matrix.Phia();
-    kkt_matrix.Phix().noalias() 
-        -= data.Phia() * data.MJtJinv_dIDCdqv().topRows(data.dimv());
-    kkt_matrix.Phiu().noalias()  
-        = data.Phia() * data.MJtJinv().block(0, data.dim_passive(), data.dimv(), data.dimu());
-    kkt_matrix.Phit().noalias() 
-        -= data.Phia() * data.MJtJinv_IDC().head(data.dimv());
-    kkt_residual.P().noalias() 
-        -= data.Phia() * data.MJtJinv_IDC().head(data.dimv());
-  }
-  else {
-    data.setSwitchingConstraintDimension(0);
-  }
-
-  // STO sensitivities
-  data.ha() = kkt_matrix.ha;
-  data.hf() = - kkt_matrix.hf();
-  kkt_residual.h -= data.MJtJinv_IDC().dot(data.haf()); 
-  kkt_matrix.hx.noalias() -= data.MJtJinv_dIDCdqv().transpose() * data.haf();
-  kkt_matrix.hq().noalias()
-      += (1.0/dt) * kkt_matrix.Qqf() * data.MJtJinv_IDC().tail(dimf);
-  kkt_matrix.hu.noalias() 
-      += data.MJtJinv().middleRows(dim_passive, dimu) * data.haf();
 }
 
 
@@ -168,14 +226,14 @@ void expandContactDynamicsPrimal(const ContactDynamicsData& data,
                                  SplitDirection& d) {
   d.daf().noalias() = - data.MJtJinv_dIDCdqv() * d.dx;
   d.daf().noalias() 
-      += data.MJtJinv().middleCols(data.dim_passive(), data.dimu()) * d.du;
+      += data.MJtJinv_IO().middleCols(data.dim_passive(), data.dimu()) * d.du;
   d.daf().noalias() -= data.MJtJinv_IDC();
   d.df().array()    *= -1;
 }
 
 
-void expandContactDynamicsDual(const double dt, const double dts, 
-                               ContactDynamicsData& data, 
+void expandContactDynamicsDual(const Robot& robot, const double dt, 
+                               const double dts, ContactDynamicsData& data, 
                                const SplitDirection& d_next, 
                                SplitDirection& d) {
   assert(dt > 0);
@@ -184,7 +242,8 @@ void expandContactDynamicsDual(const double dt, const double dts,
     d.dnu_passive.noalias() -= data.Quu_passive_topRight * d.du;
     d.dnu_passive.noalias() -= data.Qxu_passive.transpose() * d.dx;
     d.dnu_passive.noalias() 
-        -= dt * data.MJtJinv().leftCols(data.dimv()).template topRows<dim_floating_base>() 
+        -= dt * data.MJtJinv_IO().topRows(data.dimv())
+                  .template leftCols<dim_floating_base>().transpose() 
               * d_next.dgmm();
   }
   data.laf().noalias() += data.Qafqv() * d.dx;
@@ -198,7 +257,8 @@ void expandContactDynamicsDual(const double dt, const double dts,
   if (dts < - eps || dts > eps) {
     data.laf().noalias() += dts * data.haf();
   }
-  d.dbetamu().noalias()  = - data.MJtJinv() * data.laf();
+  d.dbetamu() = - data.laf();
+  data.solveMJtJ(robot, d.dbetamu());
 }
 
 } // namespace robotoc 
\ No newline at end of file
@@ -11,8 +11,8 @@ ContactDynamicsData::ContactDynamicsData(const Robot& robot)
     dCda_full_(Eigen::MatrixXd::Zero(robot.max_dimf(), robot.dimv())),
     dIDCdqv_full_(Eigen::MatrixXd::Zero(robot.dimv()+robot.max_dimf(), 
                                         2*robot.dimv())),
-    MJtJinv_full_(Eigen::MatrixXd::Zero(robot.dimv()+robot.max_dimf(), 
-                                        robot.dimv()+robot.max_dimf())), 
+    MJtJinv_IO_full_(Eigen::MatrixXd::Zero(robot.dimv()+robot.max_dimf(), 
+                                           robot.dimv())), 
     MJtJinv_dIDCdqv_full_(Eigen::MatrixXd::Zero(robot.dimv()+robot.max_dimf(), 
                                                 2*robot.dimv())), 
     Qafqv_full_(Eigen::MatrixXd::Zero(robot.dimv()+robot.max_dimf(), 
@@ -24,6 +24,10 @@ ContactDynamicsData::ContactDynamicsData(const Robot& robot)
     Phia_full_(Eigen::MatrixXd::Zero(robot.max_dimf(), robot.dimv())),
     laf_full_(Eigen::VectorXd::Zero(robot.dimv()+robot.max_dimf())),
     haf_full_(Eigen::VectorXd::Zero(robot.dimv()+robot.max_dimf())),
+    M_U_(Eigen::MatrixXd::Zero(robot.dimv(), robot.dimv())),
+    sDUiJt_(Eigen::MatrixXd::Zero(robot.dimv(), robot.max_dimf())),
+    JMinvJt_L_(Eigen::MatrixXd::Zero(robot.max_dimf(), robot.max_dimf())),
+    M_D_(Eigen::VectorXd::Zero(robot.dimv())),
     dimv_(robot.dimv()),
     dimu_(robot.dimu()),
     dimf_(0),
@@ -41,7 +45,7 @@ ContactDynamicsData::ContactDynamicsData()
     dIDda(),
     dIDddv(),
     dIDCdqv_full_(),
-    MJtJinv_full_(), 
+    MJtJinv_IO_full_(), 
     MJtJinv_dIDCdqv_full_(), 
     Qafqv_full_(), 
     Qafu_full_full_(), 
@@ -50,6 +54,10 @@ ContactDynamicsData::ContactDynamicsData()
     Phia_full_(),
     laf_full_(),
     haf_full_(),
+    M_U_(),
+    sDUiJt_(),
+    JMinvJt_L_(),
+    M_D_(),
     dimv_(0),
     dimu_(0),
     dimf_(0),
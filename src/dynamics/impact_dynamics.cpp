@@ -39,16 +39,18 @@ void condenseImpactDynamics(Robot& robot, const ImpactStatus& impact_status,
                             ContactDynamicsData& data, 
                             SplitKKTMatrix& kkt_matrix, 
                             SplitKKTResidual& kkt_residual) {
-  robot.computeMJtJinv(data.dIDddv, data.dCdv(), data.MJtJinv());
+  robot.factorizeMJtJ(data.dIDddv, data.dCdv());
   const int dimv = robot.dimv();
   const int dimf = impact_status.dimf();
-  data.MJtJinv_dIDCdqv().leftCols(dimv).noalias() 
-      = data.MJtJinv() * data.dIDCdqv().leftCols(dimv);
-  data.MJtJinv_dIDCdqv().topRightCorner(dimv, dimv).noalias() 
-      = data.MJtJinv().topRightCorner(dimv, dimf) * data.dCdv();
-  data.MJtJinv_dIDCdqv().bottomRightCorner(dimf, dimv).noalias() 
-      = data.MJtJinv().bottomRightCorner(dimf, dimf) * data.dCdv();
-  data.MJtJinv_IDC().noalias() = data.MJtJinv() * data.IDC();
+  data.MJtJinv_dIDCdqv().leftCols(dimv) = data.dIDCdqv().leftCols(dimv);
+  robot.solveMJtJ(data.MJtJinv_dIDCdqv().leftCols(dimv));
+  // The impact dynamics does not depend on v, i.e., dIDCdv = [O; dCdv]. 
+  data.MJtJinv_dIDCdqv().topRightCorner(dimv, dimv).setZero();
+  data.MJtJinv_dIDCdqv().bottomRightCorner(dimf, dimv) = data.dCdv();
+  robot.solveMJtJ(data.MJtJinv_dIDCdqv().rightCols(dimv));
+  data.MJtJinv_IDC() = data.IDC();
+  robot.solveMJtJ(data.MJtJinv_IDC());
+  data.swapMJtJFactorization(robot);
 
   data.Qdvfqv().topRows(dimv).noalias() 
       = (- kkt_matrix.Qdvdv.diagonal()).asDiagonal() 
@@ -88,11 +90,12 @@ void expandImpactDynamicsPrimal(const ContactDynamicsData& data,
 }
 
 
-void expandImpactDynamicsDual(ContactDynamicsData& data, 
+void expandImpactDynamicsDual(const Robot& robot, ContactDynamicsData& data, 
                               const SplitDirection& d_next, SplitDirection& d) {
   data.ldvf().noalias() += data.Qdvfqv() * d.dx;
   data.ldv().noalias()  += d_next.dgmm();
-  d.dbetamu().noalias()   = - data.MJtJinv() * data.ldvf();
+  d.dbetamu() = - data.ldvf();
+  data.solveMJtJ(robot, d.dbetamu());
 }
 
 } // namespace robotoc 
\ No newline at end of file
@@ -4,6 +4,17 @@
 
 namespace robotoc {
 
+namespace {
+  void computeConfigurationAfterSwitch(const Robot& robot, 
+                                       SwitchingConstraintData& data, 
+                                       const double dt1, const double dt2, 
+                                       const SplitSolution& s) {
+    data.dq = (dt1+dt2) * s.v + (dt1*dt2) * s.a;
+    robot.integrateConfiguration(s.q, data.dq, 1.0, data.q);
+  }
+} // namespace
+
+
 void evalSwitchingConstraint(Robot& robot, const ImpactStatus& impact_status, 
                              SwitchingConstraintData& data, 
                              const double dt1, const double dt2, 
@@ -15,9 +26,8 @@ void evalSwitchingConstraint(Robot& robot, const ImpactStatus& impact_status,
 
   kkt_residual.setSwitchingConstraintDimension(impact_status.dimf());
   kkt_residual.P().setZero();
-  data.dq = (dt1+dt2) * s.v + (dt1*dt2) * s.a;
-  robot.integrateConfiguration(s.q, data.dq, 1.0, data.q);
-  robot.updateKinematics(data.q);
+  computeConfigurationAfterSwitch(robot, data, dt1, dt2, s);
+  robot.updateFrameKinematics(data.q);
   robot.computeContactPositionResidual(impact_status, kkt_residual.P());
 }
 
@@ -35,7 +45,11 @@ void linearizeSwitchingConstraint(Robot& robot,
 
   kkt_matrix.setSwitchingConstraintDimension(impact_status.dimf());
   kkt_residual.setSwitchingConstraintDimension(impact_status.dimf());
-  evalSwitchingConstraint(robot, impact_status, data, dt1, dt2, s, kkt_residual);
+  kkt_residual.P().setZero();
+  // Unlike evalSwitchingConstraint(), the Jacobians are also needed here.
+  computeConfigurationAfterSwitch(robot, data, dt1, dt2, s);
+  robot.updateKinematics(data.q);
+  robot.computeContactPositionResidual(impact_status, kkt_residual.P());
   data.setDimension(impact_status.dimf());
   data.Pq().setZero();
   robot.computeContactPositionDerivative(impact_status, data.Pq());
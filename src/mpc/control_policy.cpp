@@ -28,35 +28,55 @@ void ControlPolicy::set(const OCPSolver& ocp_solver, const double _t) {
   const int N = time_discretization.N();
   const int dimu = solution[0].u.size();
   t = _t;
-  if (t < time_discretization[0].t) {
-    tauJ = solution[0].u;
-    qJ   = solution[0].q.tail(dimu);
-    dqJ  = solution[0].v.tail(dimu);
-    Kp   = lqr_policy[0].Kq().rightCols(dimu);
-    Kd   = lqr_policy[0].Kv().rightCols(dimu);
+  const int i = findInterval(time_discretization, t);
+  if (i == 0 || i == N-1) {
+    tauJ = solution[i].u;
+    qJ   = solution[i].q.tail(dimu);
+    dqJ  = solution[i].v.tail(dimu);
+    Kp   = lqr_policy[i].Kq().rightCols(dimu);
+    Kd   = lqr_policy[i].Kv().rightCols(dimu);
     return;
   }
-  for (int i=1; i<N-1; ++i) {
-    if ((t < time_discretization[i].t) && (time_discretization[i-1].type != GridType::Impact)) {
-      const double dt = time_discretization[i].t - time_discretization[i-1].t;
-      const double alpha = (time_discretization[i].t - t) / dt;
-      tauJ = alpha * solution[i-1].u + (1.0-alpha) * solution[i].u;
-      qJ   = alpha * solution[i-1].q.tail(dimu) 
-              + (1.0-alpha) * solution[i].q.tail(dimu);
-      dqJ  = alpha * solution[i-1].v.tail(dimu) 
-              + (1.0-alpha) * solution[i].v.tail(dimu);
-      Kp   = alpha * lqr_policy[i-1].Kq().rightCols(dimu) 
-              + (1.0-alpha) * lqr_policy[i].Kq().rightCols(dimu);
-      Kd   = alpha * lqr_policy[i-1].Kv().rightCols(dimu) 
-              + (1.0-alpha) * lqr_policy[i].Kv().rightCols(dimu);
-      return;
+  const double dt = time_discretization[i].t - time_discretization[i-1].t;
+  const double alpha = (time_discretization[i].t - t) / dt;
+  tauJ = alpha * solution[i-1].u + (1.0-alpha) * solution[i].u;
+  qJ   = alpha * solution[i-1].q.tail(dimu) 
+          + (1.0-alpha) * solution[i].q.tail(dimu);
+  dqJ  = alpha * solution[i-1].v.tail(dimu) 
+          + (1.0-alpha) * solution[i].v.tail(dimu);
+  Kp   = alpha * lqr_policy[i-1].Kq().rightCols(dimu) 
+          + (1.0-alpha) * lqr_policy[i].Kq().rightCols(dimu);
+  Kd   = alpha * lqr_policy[i-1].Kv().rightCols(dimu) 
+          + (1.0-alpha) * lqr_policy[i].Kv().rightCols(dimu);
+}
+
+
+int ControlPolicy::findInterval(const TimeDiscretization& time_discretization, 
+                                const double t) {
+  const int N = time_discretization.N();
+  if (t < time_discretization[0].t) {
+    return 0;
+  }
+  // The smallest i in [1, N-2] such that t < t_i. The grid times are 
+  // non-decreasing, so it is found by the binary search.
+  int lower = 0;
+  int upper = N-1;
+  // invariant: t_lower <= t and (upper == N-1 or t < t_upper)
+  while (upper - lower > 1) {
+    const int middle = (lower + upper) / 2;
+    if (time_discretization[middle].t <= t) {
+      lower = middle;
     }
+    else {
+      upper = middle;
+    }
+  }
+  // The policy is not interpolated from an impact grid.
+  int i = upper;
+  while ((i < N-1) && (time_discretization[i-1].type == GridType::Impact)) {
+    ++i;
   }
-  tauJ = solution[N-1].u;
-  qJ   = solution[N-1].q.tail(dimu);
-  dqJ  = solution[N-1].v.tail(dimu);
-  Kp   = lqr_policy[N-1].Kq().rightCols(dimu);
-  Kd   = lqr_policy[N-1].Kv().rightCols(dimu);
+  return i;
 }
 
 
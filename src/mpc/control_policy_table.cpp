@@ -0,0 +1,111 @@
+#include "robotoc/mpc/control_policy_table.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+
+namespace robotoc {
+
+ControlPolicyTable::ControlPolicyTable(const OCPSolver& ocp_solver) 
+  : ControlPolicyTable() {
+  update(ocp_solver);
+}
+
+
+ControlPolicyTable::ControlPolicyTable() 
+  : t_(),
+    tauJ_(),
+    qJ_(),
+    dqJ_(),
+    Kp_(),
+    Kd_(),
+    policy_(),
+    dimu_(0),
+    size_(0),
+    num_knots_(0),
+    interval_(1) {
+}
+
+
+void ControlPolicyTable::update(const OCPSolver& ocp_solver) {
+  const auto& time_discretization = ocp_solver.getTimeDiscretization();
+  const auto& solution = ocp_solver.getSolution();
+  const auto& lqr_policy = ocp_solver.getLQRPolicy();
+  // Same grids as ControlPolicy::set(): the policy is interpolated over the 
+  // grids 0, ..., N-2 and is held at the grid N-1 afterwards.
+  const int N = time_discretization.N();
+  dimu_ = solution[0].u.size();
+  size_ = std::max(N, 1);
+  num_knots_ = std::max(N-1, 1);
+  if (tauJ_.rows() != dimu_ || tauJ_.cols() < size_) {
+    tauJ_.resize(dimu_, size_);
+    qJ_.resize(dimu_, size_);
+    dqJ_.resize(dimu_, size_);
+    Kp_.resize(dimu_, dimu_*size_);
+    Kd_.resize(dimu_, dimu_*size_);
+  }
+  t_.resize(num_knots_);
+  for (int i=0; i<num_knots_; ++i) {
+    t_[i] = time_discretization[i].t;
+  }
+  for (int i=0; i<size_; ++i) {
+    tauJ_.col(i) = solution[i].u;
+    qJ_.col(i)   = solution[i].q.tail(dimu_);
+    dqJ_.col(i)  = solution[i].v.tail(dimu_);
+    Kp_.middleCols(dimu_*i, dimu_) = lqr_policy[i].Kq().rightCols(dimu_);
+    Kd_.middleCols(dimu_*i, dimu_) = lqr_policy[i].Kv().rightCols(dimu_);
+  }
+  policy_.tauJ.resize(dimu_);
+  policy_.qJ.resize(dimu_);
+  policy_.dqJ.resize(dimu_);
+  policy_.Kp.resize(dimu_, dimu_);
+  policy_.Kd.resize(dimu_, dimu_);
+  interval_ = 1;
+}
+
+
+const ControlPolicy& ControlPolicyTable::get(const double t) {
+  assert(size_ > 0);
+  policy_.t = t;
+  if (t < t_[0]) {
+    setPolicy(0);
+    return policy_;
+  }
+  // interval_ is the smallest i such that t < t_[i], which is found from the 
+  // previous one in amortized O(1) for the monotone inquired times.
+  while ((interval_ < num_knots_) && (t >= t_[interval_])) {
+    ++interval_;
+  }
+  while ((interval_ > 1) && (t < t_[interval_-1])) {
+    --interval_;
+  }
+  if (interval_ >= num_knots_) {
+    setPolicy(size_-1);
+    return policy_;
+  }
+  const double alpha = (t_[interval_] - t) / (t_[interval_] - t_[interval_-1]);
+  interpolatePolicy(interval_, alpha);
+  return policy_;
+}
+
+
+void ControlPolicyTable::setPolicy(const int i) {
+  policy_.tauJ = tauJ_.col(i);
+  policy_.qJ   = qJ_.col(i);
+  policy_.dqJ  = dqJ_.col(i);
+  policy_.Kp   = Kp_.middleCols(dimu_*i, dimu_);
+  policy_.Kd   = Kd_.middleCols(dimu_*i, dimu_);
+}
+
+
+void ControlPolicyTable::interpolatePolicy(const int i, const double alpha) {
+  policy_.tauJ = alpha * tauJ_.col(i-1) + (1.0-alpha) * tauJ_.col(i);
+  policy_.qJ   = alpha * qJ_.col(i-1) + (1.0-alpha) * qJ_.col(i);
+  policy_.dqJ  = alpha * dqJ_.col(i-1) + (1.0-alpha) * dqJ_.col(i);
+  policy_.Kp   = alpha * Kp_.middleCols(dimu_*(i-1), dimu_) 
+                  + (1.0-alpha) * Kp_.middleCols(dimu_*i, dimu_);
+  policy_.Kd   = alpha * Kd_.middleCols(dimu_*(i-1), dimu_) 
+                  + (1.0-alpha) * Kd_.middleCols(dimu_*i, dimu_);
+}
+
+} // namespace robotoc 
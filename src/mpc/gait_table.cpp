@@ -0,0 +1,88 @@
+#include "robotoc/mpc/gait_table.hpp"
+
+#include <stdexcept>
+#include <algorithm>
+#include <cassert>
+
+
+namespace robotoc {
+
+GaitTable::GaitTable(const std::vector<std::vector<int>>& active_contacts, 
+                     const std::vector<double>& durations) 
+  : active_contacts_(active_contacts),
+    durations_(durations),
+    period_(0),
+    min_duration_(0) {
+  if (durations.empty()) {
+    throw std::out_of_range("[GaitTable] invalid argument: 'durations' must not be empty!");
+  }
+  if (active_contacts.size() != durations.size()) {
+    throw std::out_of_range("[GaitTable] invalid argument: 'active_contacts.size()' must be the same as 'durations.size()'!");
+  }
+  for (const auto e : durations) {
+    if (e <= 0) {
+      throw std::out_of_range("[GaitTable] invalid argument: elements of 'durations' must be positive!");
+    }
+  }
+  for (auto& e : active_contacts_) {
+    std::sort(e.begin(), e.end());
+  }
+  const int num_phases = durations.size();
+  for (int phase=0; phase<num_phases; ++phase) {
+    const int next_phase = (phase+1) % num_phases;
+    if ((num_phases > 1) 
+          && (active_contacts_[phase] == active_contacts_[next_phase])) {
+      throw std::out_of_range("[GaitTable] invalid argument: active contacts of phase " + std::to_string(phase) + " and phase " + std::to_string(next_phase) + " must be different!");
+    }
+  }
+  for (const auto e : durations) {
+    period_ += e;
+  }
+  min_duration_ = *std::min_element(durations.begin(), durations.end());
+}
+
+
+GaitTable::GaitTable() 
+  : active_contacts_(),
+    durations_(),
+    period_(0),
+    min_duration_(0) {
+}
+
+
+const std::vector<int>& GaitTable::activeContacts(const int phase) const {
+  assert(phase >= 0);
+  assert(phase < numPhases());
+  return active_contacts_[phase];
+}
+
+
+double GaitTable::duration(const int phase) const {
+  assert(phase >= 0);
+  assert(phase < numPhases());
+  return durations_[phase];
+}
+
+
+void GaitTable::disp(std::ostream& os) const {
+  os << "GaitTable:" << "\n";
+  os << "  period: " << period_ << "\n";
+  for (int phase=0; phase<numPhases(); ++phase) {
+    os << "  phase " << phase << ": active contacts: [";
+    for (int i=0; i<active_contacts_[phase].size(); ++i) {
+      if (i > 0) os << ", ";
+      os << active_contacts_[phase][i];
+    }
+    os << "], duration: " << durations_[phase];
+    if (phase < numPhases()-1) os << "\n";
+  }
+  os << std::flush;
+}
+
+
+std::ostream& operator<<(std::ostream& os, const GaitTable& gait_table) {
+  gait_table.disp(os);
+  return os;
+}
+
+} // namespace robotoc 
\ No newline at end of file
@@ -194,7 +194,7 @@ void MPCBipedWalk::updateSolution(const double t, const double dt,
                                  const Eigen::VectorXd& v) {
   assert(dt > 0);
   const bool add_step = addStep(t);
-  const auto ts = contact_sequence_->eventTimes();
+  const auto& ts = contact_sequence_->eventTimes();
   bool remove_step = false;
   if (!ts.empty()) {
     if (ts.front()+eps_ < t+dt) {
@@ -299,7 +299,7 @@ bool MPCBipedWalk::addStep(const double t) {
       else {
         tt += swing_time_;
       }
-      const auto ts = contact_sequence_->eventTimes();
+      const auto& ts = contact_sequence_->eventTimes();
       if (!ts.empty()) {
         if (predict_step_%2 == 0) {
           tt = ts.back() + double_support_time_;
@@ -324,7 +324,7 @@ bool MPCBipedWalk::addStep(const double t) {
     }
     else {
       double tt = ts_last_ + swing_time_;
-      const auto ts = contact_sequence_->eventTimes();
+      const auto& ts = contact_sequence_->eventTimes();
       if (!ts.empty()) {
         tt = ts.back() + swing_time_;
       }
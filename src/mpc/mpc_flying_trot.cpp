@@ -1,4 +1,5 @@
 #include "robotoc/mpc/mpc_flying_trot.hpp"
+#include "robotoc/mpc/mpc_locomotion_setup.hpp"
 
 #include <stdexcept>
 #include <iostream>
@@ -39,25 +40,8 @@ MPCFlyingTrot::MPCFlyingTrot(const Robot& robot, const double T, const int N)
         "[MPCFlyingTrot] invalid argument: 'robot' is not a quadrupedal robot!\n robot.maxNumPointContacts() must be larger than 4!");
   }
   // create costs
-  config_cost_ = std::make_shared<ConfigurationSpaceCost>(robot);
-  Eigen::VectorXd q_weight = Eigen::VectorXd::Constant(robot.dimv(), 0.001);
-  q_weight.template head<6>().setZero();
-  Eigen::VectorXd q_weight_impact = Eigen::VectorXd::Constant(robot.dimv(), 1);
-  q_weight_impact.template head<6>().setZero();
-  config_cost_->set_q_weight(q_weight);
-  config_cost_->set_q_weight_terminal(q_weight);
-  config_cost_->set_q_weight_impact(q_weight_impact);
-  config_cost_->set_v_weight(Eigen::VectorXd::Constant(robot.dimv(), 1.0));
-  config_cost_->set_v_weight_terminal(Eigen::VectorXd::Constant(robot.dimv(), 1.0));
-  config_cost_->set_u_weight(Eigen::VectorXd::Constant(robot.dimu(), 1.0e-02));
-  config_cost_->set_v_weight_impact(Eigen::VectorXd::Constant(robot.dimv(), 1.0));
-  config_cost_->set_dv_weight_impact(Eigen::VectorXd::Constant(robot.dimv(), 1.0e-03));
-  base_rot_cost_ = std::make_shared<ConfigurationSpaceCost>(robot, base_rot_ref_);
-  Eigen::VectorXd base_rot_weight = Eigen::VectorXd::Zero(robot.dimv());
-  base_rot_weight.template head<6>() << 0, 0, 0, 1.0e04, 1.0e04, 1.0e04;
-  base_rot_cost_->set_q_weight(base_rot_weight);
-  base_rot_cost_->set_q_weight_terminal(base_rot_weight);
-  base_rot_cost_->set_q_weight_impact(base_rot_weight);
+  config_cost_ = locomotion::CreateConfigurationCost(robot);
+  base_rot_cost_ = locomotion::CreateBaseRotationCost(robot, base_rot_ref_, 1.0e04);
   LF_foot_cost_ = std::make_shared<TaskSpace3DCost>(robot, robot.contactFrames()[0],
                                                     LF_foot_ref_);
   LH_foot_cost_ = std::make_shared<TaskSpace3DCost>(robot, robot.contactFrames()[1],
@@ -80,22 +64,7 @@ MPCFlyingTrot::MPCFlyingTrot(const Robot& robot, const double T, const int N)
   cost_->add("RH_foot_cost", RH_foot_cost_);
   cost_->add("com_cost", com_cost_);
   // create constraints 
-  auto joint_position_lower = std::make_shared<robotoc::JointPositionLowerLimit>(robot);
-  auto joint_position_upper = std::make_shared<robotoc::JointPositionUpperLimit>(robot);
-  auto joint_velocity_lower = std::make_shared<robotoc::JointVelocityLowerLimit>(robot);
-  auto joint_velocity_upper = std::make_shared<robotoc::JointVelocityUpperLimit>(robot);
-  auto joint_torques_lower  = std::make_shared<robotoc::JointTorquesLowerLimit>(robot);
-  auto joint_torques_upper  = std::make_shared<robotoc::JointTorquesUpperLimit>(robot);
-  friction_cone_ = std::make_shared<robotoc::FrictionCone>(robot);
-  // auto impact_friction_cone = std::make_shared<robotoc::ImpactFrictionCone>(robot);
-  constraints_->add("joint_position_lower", joint_position_lower);
-  constraints_->add("joint_position_upper", joint_position_upper);
-  constraints_->add("joint_velocity_lower", joint_velocity_lower);
-  constraints_->add("joint_velocity_upper", joint_velocity_upper);
-  constraints_->add("joint_torques_lower", joint_torques_lower);
-  constraints_->add("joint_torques_upper", joint_torques_upper);
-  constraints_->add("friction_cone", friction_cone_);
-  // constraints_->push_back(impact_friction_cone);
+  friction_cone_ = locomotion::AddJointLimitsAndFrictionCone(robot, constraints_);
   // create contact status
   cs_standing_.activateContacts(std::vector<int>({0, 1, 2, 3}));
   cs_lfrh_.activateContacts(std::vector<int>({0, 3}));
@@ -217,7 +186,7 @@ void MPCFlyingTrot::updateSolution(const double t, const double dt,
                                    const Eigen::VectorXd& v) {
   assert(dt > 0);
   const bool add_step = addStep(t);
-  const auto ts = contact_sequence_->eventTimes();
+  const auto& ts = contact_sequence_->eventTimes();
   bool remove_step = false;
   if (!ts.empty()) {
     if (ts.front()+eps_ < t+dt) {
@@ -321,7 +290,7 @@ bool MPCFlyingTrot::addStep(const double t) {
     else {
       tt += stance_time_;
     }
-    const auto ts = contact_sequence_->eventTimes();
+    const auto& ts = contact_sequence_->eventTimes();
     if (!ts.empty()) {
       if (predict_step_%2 == 0) {
         tt = ts.back() + flying_time_;
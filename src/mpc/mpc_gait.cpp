@@ -0,0 +1,325 @@
+#include "robotoc/mpc/mpc_gait.hpp"
+#include "robotoc/mpc/mpc_locomotion_setup.hpp"
+
+#include <stdexcept>
+#include <iostream>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+
+namespace robotoc {
+
+MPCGait::MPCGait(const Robot& robot, const double T, const int N, 
+                 const int max_num_discrete_events)
+  : foot_step_planner_(),
+    contact_sequence_(std::make_shared<robotoc::ContactSequence>(
+        robot, std::max(max_num_discrete_events, 0))),
+    cost_(std::make_shared<CostFunction>()),
+    constraints_(std::make_shared<Constraints>(1.0e-03, 0.995)),
+    ocp_solver_(OCP(robot, cost_, constraints_, contact_sequence_, T, N, 
+                    std::max(max_num_discrete_events, 0)), 
+                SolverOptions()), 
+    gait_table_(),
+    cs_gait_(),
+    cs_standing_(robot.createContactStatus()),
+    phase_times_(),
+    swing_height_(0),
+    gait_start_time_(0),
+    next_phase_time_(0),
+    T_(T),
+    dtm_(T/N),
+    ts_last_(0),
+    eps_(std::sqrt(std::numeric_limits<double>::epsilon())),
+    N_(N),
+    predict_phase_(-1) {
+  if (robot.maxNumPointContacts() < 1 || robot.maxNumSurfaceContacts() > 0) {
+    throw std::out_of_range(
+        "[MPCGait] invalid argument: 'robot' must have point contacts only!");
+  }
+  if (max_num_discrete_events < 0) {
+    throw std::out_of_range(
+        "[MPCGait] invalid argument: 'max_num_discrete_events' must be non-negative!");
+  }
+  // create costs
+  config_cost_ = locomotion::CreateConfigurationCost(robot);
+  base_rot_cost_ = locomotion::CreateBaseRotationCost(robot, base_rot_ref_);
+  cost_->add("config_cost", config_cost_);
+  cost_->add("base_rot_cost", base_rot_cost_);
+  for (int i=0; i<robot.maxNumContacts(); ++i) {
+    swing_foot_ref_.push_back(std::make_shared<MPCGaitSwingFootRef>(i, 0.0));
+    swing_foot_cost_.push_back(
+        std::make_shared<TaskSpace3DCost>(robot, robot.contactFrames()[i],
+                                          swing_foot_ref_[i]));
+    swing_foot_cost_[i]->set_weight(Eigen::Vector3d::Constant(1.0e04));
+    cost_->add(robot.contactFrameNames()[i]+"_foot_cost", swing_foot_cost_[i]);
+  }
+  com_ref_ = std::make_shared<MPCGaitCoMRef>();
+  com_cost_ = std::make_shared<CoMCost>(robot, com_ref_);
+  com_cost_->set_weight(Eigen::Vector3d::Constant(1.0e03));
+  cost_->add("com_cost", com_cost_);
+  // create constraints 
+  friction_cone_ = locomotion::AddJointLimitsAndFrictionCone(robot, constraints_);
+  // create contact status
+  for (int i=0; i<robot.maxNumContacts(); ++i) {
+    cs_standing_.activateContact(i);
+  }
+  const double friction_coefficient = 0.5;
+  cs_standing_.setFrictionCoefficients(
+      std::vector<double>(robot.maxNumContacts(), friction_coefficient));
+}
+
+
+MPCGait::MPCGait() {
+}
+
+
+MPCGait::~MPCGait() {
+}
+
+
+void MPCGait::setGait(const std::shared_ptr<ContactPlannerBase>& foot_step_planner,
+                      const GaitTable& gait_table, const double swing_height, 
+                      const double gait_start_time) {
+  if (gait_start_time <= 0) {
+    throw std::out_of_range("[MPCGait] invalid argument: 'gait_start_time' must be positive!");
+  }
+  setGaitTable(gait_table, swing_height);
+  foot_step_planner_ = foot_step_planner;
+  gait_start_time_ = gait_start_time;
+}
+
+
+void MPCGait::init(const double t, const Eigen::VectorXd& q, 
+                   const Eigen::VectorXd& v, 
+                   const SolverOptions& solver_options) {
+  if (t >= gait_start_time_) {
+    throw std::out_of_range(
+        "[MPCGait] invalid argument: 't' must be less than " + std::to_string(gait_start_time_) + "!");
+  }
+  predict_phase_ = -1;
+  next_phase_time_ = gait_start_time_;
+  ts_last_ = t;
+  contact_sequence_->init(cs_standing_);
+  bool add_step = addStep(t);
+  while (add_step) {
+    add_step = addStep(t);
+  }
+  foot_step_planner_->init(q);
+  config_cost_->set_q_ref(q);
+  base_rot_ref_ = std::make_shared<MPCGaitConfigurationRef>(q);
+  base_rot_cost_->set_ref(base_rot_ref_);
+  resetContactPlacements(t, q, v);
+  ocp_solver_.setSolution("q", q);
+  ocp_solver_.setSolution("v", v);
+  ocp_solver_.setSolverOptions(solver_options);
+  ocp_solver_.solve(t, q, v, true);
+  s_ = ocp_solver_.getSolution();
+}
+
+
+void MPCGait::switchGait(const std::shared_ptr<ContactPlannerBase>& foot_step_planner,
+                         const GaitTable& gait_table, const double swing_height, 
+                         const double t, const Eigen::VectorXd& q) {
+  // Keeps the current contact phase and discards the predicted ones. 
+  const auto& ts = contact_sequence_->eventTimes();
+  if (!ts.empty()) {
+    next_phase_time_ = ts.front();
+  }
+  while (contact_sequence_->numDiscreteEvents() > 0) {
+    contact_sequence_->pop_back();
+  }
+  setGaitTable(gait_table, swing_height);
+  predict_phase_ = -1;
+  foot_step_planner_ = foot_step_planner;
+  foot_step_planner_->init(q);
+  bool add_step = addStep(t);
+  while (add_step) {
+    add_step = addStep(t);
+  }
+}
+
+
+void MPCGait::reset() {
+  ocp_solver_.setSolution(s_);
+}
+
+
+void MPCGait::reset(const Eigen::VectorXd& q, const Eigen::VectorXd& v) {
+  ocp_solver_.setSolution(s_);
+  ocp_solver_.setSolution("q", q);
+  ocp_solver_.setSolution("v", v);
+}
+
+
+void MPCGait::setSolverOptions(const SolverOptions& solver_options) {
+  ocp_solver_.setSolverOptions(solver_options);
+}
+
+
+void MPCGait::updateSolution(const double t, const double dt,
+                             const Eigen::VectorXd& q, 
+                             const Eigen::VectorXd& v) {
+  assert(dt > 0);
+  bool add_step = addStep(t);
+  while (add_step) {
+    add_step = addStep(t);
+  }
+  const auto& ts = contact_sequence_->eventTimes();
+  if (!ts.empty()) {
+    if (ts.front()+eps_ < t+dt) {
+      ts_last_ = ts.front();
+      contact_sequence_->pop_front();
+    }
+  }
+  resetContactPlacements(t, q, v);
+  ocp_solver_.solve(t, q, v, true);
+}
+
+
+const Eigen::VectorXd& MPCGait::getInitialControlInput() const {
+  return ocp_solver_.getSolution(0).u;
+}
+
+
+const Solution& MPCGait::getSolution() const {
+  return ocp_solver_.getSolution();
+}
+
+
+const aligned_vector<LQRPolicy>& MPCGait::getLQRPolicy() const {
+  return ocp_solver_.getLQRPolicy();
+}
+
+
+double MPCGait::KKTError(const double t, const Eigen::VectorXd& q, 
+                         const Eigen::VectorXd& v) {
+  return ocp_solver_.KKTError(t, q, v);
+}
+
+
+double MPCGait::KKTError() const {
+  return ocp_solver_.KKTError();
+}
+
+
+std::shared_ptr<CostFunction> MPCGait::getCostHandle() {
+  return cost_;
+}
+
+
+std::shared_ptr<ConfigurationSpaceCost> MPCGait::getConfigCostHandle() {
+  return config_cost_;
+}
+
+
+std::shared_ptr<ConfigurationSpaceCost> MPCGait::getBaseRotationCostHandle() {
+  return base_rot_cost_;
+}
+
+
+std::vector<std::shared_ptr<TaskSpace3DCost>> MPCGait::getSwingFootCostHandle() {
+  return swing_foot_cost_;
+}
+
+
+std::shared_ptr<CoMCost> MPCGait::getCoMCostHandle() {
+  return com_cost_;
+}
+
+
+std::shared_ptr<Constraints> MPCGait::getConstraintsHandle() {
+  return constraints_;
+}
+
+
+std::shared_ptr<FrictionCone> MPCGait::getFrictionConeHandle() {
+  return friction_cone_;
+}
+
+
+void MPCGait::setRobotProperties(const RobotProperties& properties) {
+  ocp_solver_.setRobotProperties(properties);
+}
+
+
+void MPCGait::setGaitTable(const GaitTable& gait_table, 
+                           const double swing_height) {
+  if (gait_table.numPhases() < 1) {
+    throw std::out_of_range("[MPCGait] invalid argument: 'gait_table' must not be empty!");
+  }
+  if (swing_height <= 0) {
+    throw std::out_of_range("[MPCGait] invalid argument: 'swing_height' must be positive!");
+  }
+  const int max_num_contacts = cs_standing_.maxNumContacts();
+  for (int phase=0; phase<gait_table.numPhases(); ++phase) {
+    for (const auto e : gait_table.activeContacts(phase)) {
+      if (e < 0 || e >= max_num_contacts) {
+        throw std::out_of_range("[MPCGait] invalid argument: contact indices of 'gait_table' must be in [0, " + std::to_string(max_num_contacts) + ")!");
+      }
+    }
+  }
+  gait_table_ = gait_table;
+  cs_gait_.assign(gait_table.numPhases(), cs_standing_);
+  for (int phase=0; phase<gait_table.numPhases(); ++phase) {
+    for (int i=0; i<max_num_contacts; ++i) {
+      cs_gait_[phase].deactivateContact(i);
+    }
+    cs_gait_[phase].activateContacts(gait_table.activeContacts(phase));
+  }
+  swing_height_ = swing_height;
+  for (auto& e : swing_foot_ref_) {
+    e->setSwingHeight(swing_height);
+  }
+  // The number of the discrete events in the horizon is bounded by the 
+  // shortest phase of the gait.
+  const int max_num_events 
+      = static_cast<int>(std::ceil(T_/gait_table.minDuration())) + 1;
+  contact_sequence_->reserve(max_num_events);
+  phase_times_.reserve(max_num_events+2);
+}
+
+
+bool MPCGait::addStep(const double t) {
+  if (next_phase_time_ < t+T_-dtm_) {
+    const int next_phase = (predict_phase_+1) % gait_table_.numPhases();
+    const auto& cs_last = contact_sequence_->contactStatus(
+        contact_sequence_->numContactPhases()-1);
+    // A phase with the same active contacts as the last phase, which can 
+    // appear only at the start of a gait, is merged into the last phase.
+    if (cs_gait_[next_phase].isContactActive() != cs_last.isContactActive()) {
+      contact_sequence_->push_back(cs_gait_[next_phase], next_phase_time_);
+    }
+    next_phase_time_ += gait_table_.duration(next_phase);
+    predict_phase_ = next_phase;
+    return true;
+  }
+  return false;
+}
+
+
+void MPCGait::resetContactPlacements(const double t, const Eigen::VectorXd& q,
+                                     const Eigen::VectorXd& v) {
+  const bool success = foot_step_planner_->plan(t, q, v, contact_sequence_->contactStatus(0),
+                                                contact_sequence_->numContactPhases());
+  for (int phase=0; phase<contact_sequence_->numContactPhases(); ++phase) {
+    contact_sequence_->setContactPlacements(phase, 
+                                            foot_step_planner_->contactPositions(phase+1),
+                                            foot_step_planner_->contactSurfaces(phase+1));
+  }
+  phase_times_.clear();
+  phase_times_.push_back(ts_last_);
+  for (const auto e : contact_sequence_->eventTimes()) {
+    phase_times_.push_back(e);
+  }
+  phase_times_.push_back(next_phase_time_);
+  base_rot_ref_->setConfigurationRef(contact_sequence_, foot_step_planner_, 
+                                     phase_times_);
+  for (auto& e : swing_foot_ref_) {
+    e->setSwingFootRef(contact_sequence_, foot_step_planner_, phase_times_);
+  }
+  com_ref_->setCoMRef(contact_sequence_, foot_step_planner_, phase_times_);
+}
+
+} // namespace robotoc
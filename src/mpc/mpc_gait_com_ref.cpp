@@ -0,0 +1,68 @@
+#include "robotoc/mpc/mpc_gait_com_ref.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+
+namespace robotoc {
+
+MPCGaitCoMRef::MPCGaitCoMRef()
+  : CoMRefBase(),
+    com_(),
+    phase_times_(),
+    has_inactive_contacts_() {
+}
+
+
+MPCGaitCoMRef::~MPCGaitCoMRef() {
+}
+
+
+void MPCGaitCoMRef::setCoMRef(
+    const std::shared_ptr<ContactSequence>& contact_sequence,
+    const std::shared_ptr<ContactPlannerBase>& foot_step_planner,
+    const std::vector<double>& phase_times) {
+  const int num_phases = contact_sequence->numContactPhases();
+  assert(phase_times.size() == num_phases+1);
+  has_inactive_contacts_.clear();
+  for (int phase=0; phase<num_phases; ++phase) {
+    const auto& contact_status = contact_sequence->contactStatus(phase);
+    bool has_inactive_contacts = false;
+    for (int i=0; i<contact_status.maxNumContacts(); ++i) {
+      if (!contact_status.isContactActive(i)) {
+        has_inactive_contacts = true;
+      }
+    }
+    has_inactive_contacts_.push_back(has_inactive_contacts);
+  }
+  phase_times_ = phase_times;
+  if (com_.size() < num_phases+1) {
+    com_.resize(num_phases+1);
+  }
+  const int last_step = foot_step_planner->size() - 1;
+  for (int i=0; i<=num_phases; ++i) {
+    com_[i] = foot_step_planner->CoM(std::min(i, last_step));
+  }
+}
+
+
+void MPCGaitCoMRef::updateRef(const GridInfo& grid_info,
+                              Eigen::VectorXd& com_ref) const {
+  const int phase = grid_info.phase;
+  if (has_inactive_contacts_[phase]) {
+    const double phase_duration = phase_times_[phase+1] - phase_times_[phase];
+    double rate = (grid_info.t-phase_times_[phase]) / phase_duration;
+    rate = std::min(std::max(rate, 0.0), 1.0);
+    com_ref = (1.0-rate) * com_[phase] + rate * com_[phase+1];
+  }
+  else {
+    com_ref = com_[phase];
+  }
+}
+
+
+bool MPCGaitCoMRef::isActive(const GridInfo& grid_info) const {
+  return has_inactive_contacts_[grid_info.phase];
+}
+
+} // namespace robotoc
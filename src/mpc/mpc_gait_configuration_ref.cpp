@@ -0,0 +1,77 @@
+#include "robotoc/mpc/mpc_gait_configuration_ref.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+
+namespace robotoc {
+
+MPCGaitConfigurationRef::MPCGaitConfigurationRef(const Eigen::VectorXd& q)
+  : ConfigurationSpaceRefBase(),
+    q_(q), 
+    quat_(), 
+    phase_times_(),
+    has_inactive_contacts_() {
+}
+
+
+MPCGaitConfigurationRef::~MPCGaitConfigurationRef() {
+}
+
+
+void MPCGaitConfigurationRef::setConfiguration(const Eigen::VectorXd& q) {
+  q_ = q;
+}
+
+
+void MPCGaitConfigurationRef::setConfigurationRef(
+    const std::shared_ptr<ContactSequence>& contact_sequence, 
+    const std::shared_ptr<ContactPlannerBase>& foot_step_planner,
+    const std::vector<double>& phase_times) {
+  const int num_phases = contact_sequence->numContactPhases();
+  assert(phase_times.size() == num_phases+1);
+  has_inactive_contacts_.clear();
+  for (int phase=0; phase<num_phases; ++phase) {
+    const auto& contact_status = contact_sequence->contactStatus(phase);
+    bool has_inactive_contacts = false;
+    for (int i=0; i<contact_status.maxNumContacts(); ++i) {
+      if (!contact_status.isContactActive(i)) {
+        has_inactive_contacts = true;
+      }
+    }
+    has_inactive_contacts_.push_back(has_inactive_contacts);
+  }
+  phase_times_ = phase_times;
+  if (quat_.size() < num_phases+1) {
+    quat_.resize(num_phases+1);
+  }
+  const int last_step = foot_step_planner->size() - 1;
+  for (int i=0; i<=num_phases; ++i) {
+    quat_[i] = Eigen::Quaterniond(foot_step_planner->R(std::min(i, last_step)));
+  }
+}
+
+
+void MPCGaitConfigurationRef::updateRef(const Robot& robot, 
+                                        const GridInfo& grid_info,
+                                        Eigen::VectorXd& q_ref) const {
+  const int phase = grid_info.phase;
+  q_ref = q_;
+  if (has_inactive_contacts_[phase]) {
+    const double phase_duration = phase_times_[phase+1] - phase_times_[phase];
+    double rate = (grid_info.t-phase_times_[phase]) / phase_duration;
+    rate = std::min(std::max(rate, 0.0), 1.0);
+    q_ref.template segment<4>(3) 
+        = quat_[phase].slerp(rate, quat_[phase+1]).coeffs();
+  }
+  else {
+    q_ref.template segment<4>(3) = quat_[phase].coeffs();
+  }
+}
+
+
+bool MPCGaitConfigurationRef::isActive(const GridInfo& grid_info) const {
+  return true;
+}
+
+} // namespace robotoc
@@ -0,0 +1,103 @@
+#include "robotoc/mpc/mpc_gait_swing_foot_ref.hpp"
+
+#include <stdexcept>
+#include <algorithm>
+#include <cassert>
+
+
+namespace robotoc {
+
+MPCGaitSwingFootRef::MPCGaitSwingFootRef(const int contact_index, 
+                                         const double swing_height)
+  : TaskSpace3DRefBase(),
+    contact_index_(contact_index),
+    lift_position_(),
+    touchdown_position_(),
+    lift_time_(),
+    touchdown_time_(),
+    is_contact_active_(),
+    swing_height_(swing_height) {
+  if (contact_index < 0) {
+    throw std::out_of_range(
+        "[MPCGaitSwingFootRef] invalid argument: 'contact_index' must be non-negative!");
+  }
+  setSwingHeight(swing_height);
+}
+
+
+MPCGaitSwingFootRef::~MPCGaitSwingFootRef() {
+}
+
+
+void MPCGaitSwingFootRef::setSwingHeight(const double swing_height) {
+  if (swing_height < 0.0) {
+    throw std::out_of_range(
+        "[MPCGaitSwingFootRef] invalid argument: 'swing_height' must be non-negative!");
+  }
+  swing_height_ = swing_height;
+}
+
+
+void MPCGaitSwingFootRef::setSwingFootRef(
+    const std::shared_ptr<ContactSequence>& contact_sequence,
+    const std::shared_ptr<ContactPlannerBase>& foot_step_planner,
+    const std::vector<double>& phase_times) {
+  const int num_phases = contact_sequence->numContactPhases();
+  assert(phase_times.size() == num_phases+1);
+  is_contact_active_.clear();
+  for (int phase=0; phase<num_phases; ++phase) {
+    is_contact_active_.push_back(
+        contact_sequence->contactStatus(phase).isContactActive(contact_index_));
+  }
+  if (lift_position_.size() < num_phases) {
+    lift_position_.resize(num_phases);
+    touchdown_position_.resize(num_phases);
+    lift_time_.resize(num_phases);
+    touchdown_time_.resize(num_phases);
+  }
+  const int last_step = foot_step_planner->size() - 1;
+  for (int phase=0; phase<num_phases; ++phase) {
+    if (is_contact_active_[phase]) continue;
+    int lift_phase = phase;
+    while (lift_phase > 0 && !is_contact_active_[lift_phase-1]) {
+      --lift_phase;
+    }
+    int touchdown_phase = phase;
+    while (touchdown_phase < num_phases && !is_contact_active_[touchdown_phase]) {
+      ++touchdown_phase;
+    }
+    lift_time_[phase] = phase_times[lift_phase];
+    touchdown_time_[phase] = phase_times[touchdown_phase];
+    lift_position_[phase] 
+        = foot_step_planner->contactPositions(std::min(lift_phase, last_step))[contact_index_];
+    // The contact placements of the phase p are contactPositions(p+1).
+    touchdown_position_[phase] 
+        = foot_step_planner->contactPositions(std::min(touchdown_phase+1, last_step))[contact_index_];
+  }
+}
+
+
+void MPCGaitSwingFootRef::updateRef(const GridInfo& grid_info,
+                                    Eigen::VectorXd& x3d_ref) const {
+  if (isActive(grid_info)) {
+    const int phase = grid_info.phase;
+    const double swing_time = touchdown_time_[phase] - lift_time_[phase];
+    double rate = (grid_info.t-lift_time_[phase]) / swing_time;
+    rate = std::min(std::max(rate, 0.0), 1.0);
+    x3d_ref = (1.0-rate) * lift_position_[phase] 
+                + rate * touchdown_position_[phase];
+    if (rate < 0.5) {
+      x3d_ref.coeffRef(2) += 2 * rate * swing_height_;
+    }
+    else {
+      x3d_ref.coeffRef(2) += 2 * (1-rate) * swing_height_;
+    }
+  }
+}
+
+
+bool MPCGaitSwingFootRef::isActive(const GridInfo& grid_info) const {
+  return !is_contact_active_[grid_info.phase];
+}
+
+} // namespace robotoc
@@ -149,7 +149,7 @@ void MPCJump::init(const double t, const Eigen::VectorXd& q,
   ocp_solver_.setSolverOptions(solver_options);
   ocp_solver_.solve(t, q, v, true);
   s_ = ocp_solver_.getSolution();
-  const auto ts = contact_sequence_->eventTimes();
+  const auto& ts = contact_sequence_->eventTimes();
   ground_time_ = t + T_ - ts[1];
   flying_time_ = t + T_ - ts[0] - ground_time_;
   t_mpc_start_ = t;
@@ -179,7 +179,7 @@ void MPCJump::reset(const double t, const Eigen::VectorXd& q,
   ocp_solver_.setSolverOptions(solver_options);
   ocp_solver_.solve(t, q, v, true);
   s_ = ocp_solver_.getSolution();
-  const auto ts = contact_sequence_->eventTimes();
+  const auto& ts = contact_sequence_->eventTimes();
   ground_time_ = t + T_ - ts[1];
   flying_time_ = t + T_ - ts[0] - ground_time_;
   t_mpc_start_ = t;
@@ -207,7 +207,7 @@ void MPCJump::updateSolution(const double t, const double dt,
                              const Eigen::VectorXd& q, 
                              const Eigen::VectorXd& v) {
   assert(dt > 0);
-  const auto ts = contact_sequence_->eventTimes();
+  const auto& ts = contact_sequence_->eventTimes();
   bool remove_step = false;
   if (!ts.empty()) {
     if (ts.front()+eps_ < t+dt) {
@@ -0,0 +1,69 @@
+#include "robotoc/mpc/mpc_locomotion_setup.hpp"
+
+#include <cassert>
+
+#include "robotoc/constraints/joint_position_lower_limit.hpp"
+#include "robotoc/constraints/joint_position_upper_limit.hpp"
+#include "robotoc/constraints/joint_velocity_lower_limit.hpp"
+#include "robotoc/constraints/joint_velocity_upper_limit.hpp"
+#include "robotoc/constraints/joint_torques_lower_limit.hpp"
+#include "robotoc/constraints/joint_torques_upper_limit.hpp"
+
+
+namespace robotoc {
+namespace locomotion {
+
+std::shared_ptr<ConfigurationSpaceCost> CreateConfigurationCost(
+    const Robot& robot) {
+  auto config_cost = std::make_shared<ConfigurationSpaceCost>(robot);
+  Eigen::VectorXd q_weight = Eigen::VectorXd::Constant(robot.dimv(), 0.001);
+  q_weight.template head<6>().setZero();
+  Eigen::VectorXd q_weight_impact = Eigen::VectorXd::Constant(robot.dimv(), 1);
+  q_weight_impact.template head<6>().setZero();
+  config_cost->set_q_weight(q_weight);
+  config_cost->set_q_weight_terminal(q_weight);
+  config_cost->set_q_weight_impact(q_weight_impact);
+  config_cost->set_v_weight(Eigen::VectorXd::Constant(robot.dimv(), 1.0));
+  config_cost->set_v_weight_terminal(Eigen::VectorXd::Constant(robot.dimv(), 1.0));
+  config_cost->set_u_weight(Eigen::VectorXd::Constant(robot.dimu(), 1.0e-02));
+  config_cost->set_v_weight_impact(Eigen::VectorXd::Constant(robot.dimv(), 1.0));
+  config_cost->set_dv_weight_impact(Eigen::VectorXd::Constant(robot.dimv(), 1.0e-03));
+  return config_cost;
+}
+
+
+std::shared_ptr<ConfigurationSpaceCost> CreateBaseRotationCost(
+    const Robot& robot, const std::shared_ptr<ConfigurationSpaceRefBase>& ref,
+    const double weight) {
+  assert(weight >= 0);
+  auto base_rot_cost = std::make_shared<ConfigurationSpaceCost>(robot, ref);
+  Eigen::VectorXd base_rot_weight = Eigen::VectorXd::Zero(robot.dimv());
+  base_rot_weight.template segment<3>(3).setConstant(weight);
+  base_rot_cost->set_q_weight(base_rot_weight);
+  base_rot_cost->set_q_weight_terminal(base_rot_weight);
+  base_rot_cost->set_q_weight_impact(base_rot_weight);
+  return base_rot_cost;
+}
+
+
+std::shared_ptr<FrictionCone> AddJointLimitsAndFrictionCone(
+    const Robot& robot, const std::shared_ptr<Constraints>& constraints) {
+  auto joint_position_lower = std::make_shared<JointPositionLowerLimit>(robot);
+  auto joint_position_upper = std::make_shared<JointPositionUpperLimit>(robot);
+  auto joint_velocity_lower = std::make_shared<JointVelocityLowerLimit>(robot);
+  auto joint_velocity_upper = std::make_shared<JointVelocityUpperLimit>(robot);
+  auto joint_torques_lower  = std::make_shared<JointTorquesLowerLimit>(robot);
+  auto joint_torques_upper  = std::make_shared<JointTorquesUpperLimit>(robot);
+  auto friction_cone        = std::make_shared<FrictionCone>(robot);
+  constraints->add("joint_position_lower", joint_position_lower);
+  constraints->add("joint_position_upper", joint_position_upper);
+  constraints->add("joint_velocity_lower", joint_velocity_lower);
+  constraints->add("joint_velocity_upper", joint_velocity_upper);
+  constraints->add("joint_torques_lower", joint_torques_lower);
+  constraints->add("joint_torques_upper", joint_torques_upper);
+  constraints->add("friction_cone", friction_cone);
+  return friction_cone;
+}
+
+} // namespace locomotion
+} // namespace robotoc 
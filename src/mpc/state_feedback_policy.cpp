@@ -0,0 +1,98 @@
+#include "robotoc/mpc/state_feedback_policy.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <cassert>
+
+
+namespace robotoc {
+
+StateFeedbackPolicy::StateFeedbackPolicy(const Robot& robot) 
+  : t(0),
+    u(Eigen::VectorXd::Zero(robot.dimu())),
+    q(Eigen::VectorXd::Zero(robot.dimq())),
+    v(Eigen::VectorXd::Zero(robot.dimv())),
+    K(MatrixXdRowMajor::Zero(robot.dimu(), 2*robot.dimv())),
+    dx_(Eigen::VectorXd::Zero(2*robot.dimv())) {
+}
+
+
+StateFeedbackPolicy::StateFeedbackPolicy(const Robot& robot, 
+                                         const OCPSolver& ocp_solver, 
+                                         const double t) 
+  : StateFeedbackPolicy(robot) {
+  set(robot, ocp_solver, t);
+}
+
+
+StateFeedbackPolicy::StateFeedbackPolicy() 
+  : t(0),
+    u(),
+    q(),
+    v(),
+    K(),
+    dx_() {
+}
+
+
+void StateFeedbackPolicy::set(const Robot& robot, const OCPSolver& ocp_solver, 
+                              const double _t) {
+  const auto& time_discretization = ocp_solver.getTimeDiscretization();
+  const auto& solution = ocp_solver.getSolution();
+  const auto& lqr_policy = ocp_solver.getLQRPolicy();
+  const int N = time_discretization.N();
+  t = _t;
+  const int i = ControlPolicy::findInterval(time_discretization, t);
+  if (i == 0 || i == N-1) {
+    u = solution[i].u;
+    q = solution[i].q;
+    v = solution[i].v;
+    K = lqr_policy[i].K;
+    return;
+  }
+  const double dt = time_discretization[i].t - time_discretization[i-1].t;
+  const double alpha = (time_discretization[i].t - t) / dt;
+  u = alpha * solution[i-1].u + (1.0-alpha) * solution[i].u;
+  robot.interpolateConfiguration(solution[i-1].q, solution[i].q, 1.0-alpha, q);
+  v = alpha * solution[i-1].v + (1.0-alpha) * solution[i].v;
+  K = alpha * lqr_policy[i-1].K + (1.0-alpha) * lqr_policy[i].K;
+}
+
+
+void StateFeedbackPolicy::computeControlInput(const Robot& robot, 
+                                              const Eigen::VectorXd& _q, 
+                                              const Eigen::VectorXd& _v,
+                                              Eigen::VectorXd& _u) {
+  if (_q.size() != robot.dimq()) {
+    throw std::out_of_range("[StateFeedbackPolicy] invalid argument: q.size() must be " + std::to_string(robot.dimq()) + "!");
+  }
+  if (_v.size() != robot.dimv()) {
+    throw std::out_of_range("[StateFeedbackPolicy] invalid argument: v.size() must be " + std::to_string(robot.dimv()) + "!");
+  }
+  assert(_u.size() == robot.dimu());
+  assert(dx_.size() == 2*robot.dimv());
+  const int dimv = robot.dimv();
+  robot.subtractConfiguration(_q, q, dx_.head(dimv));
+  dx_.tail(dimv) = _v - v;
+  _u = u;
+  _u.noalias() += K * dx_;
+}
+
+
+void StateFeedbackPolicy::disp(std::ostream& os) const {
+  os << "StateFeedbackPolicy: \n";
+  os << "  t: " << t << " \n";
+  os << "  u: " << u.transpose() << " \n";
+  os << "  q: " << q.transpose() << " \n";
+  os << "  v: " << v.transpose() << " \n";
+  os << "  K: \n" << K << " \n";
+}
+
+
+std::ostream& operator<<(std::ostream& os, 
+                         const StateFeedbackPolicy& policy) {
+  policy.disp(os);
+  return os;
+}
+
+} // namespace robotoc 
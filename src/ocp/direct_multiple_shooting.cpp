@@ -68,6 +68,31 @@ void DirectMultipleShooting::initConstraints(
 }
 
 
+void DirectMultipleShooting::warmStartConstraints(
+    aligned_vector<Robot>& robots, const TimeDiscretization& time_discretization, 
+    const Solution& s) {
+  resizeData(time_discretization);
+  const int N = time_discretization.size() - 1;
+  #pragma omp parallel for num_threads(nthreads_)
+  for (int i=0; i<=N; ++i) {
+    if (!time_discretization.isStructureChanged(i)) continue;
+    const auto& grid = time_discretization[i];
+    if (grid.type == GridType::Terminal) {
+      terminal_stage_.initConstraints(robots[omp_get_thread_num()], 
+                                      grid, s[i], ocp_data_[i]);
+    }
+    else if (grid.type == GridType::Impact) {
+      impact_stage_.initConstraints(robots[omp_get_thread_num()], 
+                                    grid, s[i], ocp_data_[i]);
+    }
+    else {
+      intermediate_stage_.initConstraints(robots[omp_get_thread_num()], 
+                                          grid, s[i], ocp_data_[i]);
+    }
+  }
+}
+
+
 bool DirectMultipleShooting::isFeasible(
     aligned_vector<Robot>& robots, const TimeDiscretization& time_discretization, 
     const Solution& s) {
@@ -159,6 +184,24 @@ void DirectMultipleShooting::evalKKT(
 }
 
 
+void DirectMultipleShooting::correctKKTError(
+    const TimeDiscretization& time_discretization, 
+    const MoveBlocking& move_blocking) {
+  const int N = time_discretization.size() - 1;
+  for (int i=0; i<N; ++i) {
+    // i is the first grid of a block
+    if (move_blocking.isBlocked(i) || !move_blocking.isBlocked(i+1)) continue;
+    auto& lu_block = ocp_data_[i].lu;
+    performance_index_.kkt_error -= lu_block.squaredNorm();
+    for (int j=i+1; move_blocking.isBlocked(j); ++j) {
+      performance_index_.kkt_error -= ocp_data_[j].lu.squaredNorm();
+      lu_block.noalias() += ocp_data_[j].lu;
+    }
+    performance_index_.kkt_error += lu_block.squaredNorm();
+  }
+}
+
+
 void DirectMultipleShooting::computeInitialStateDirection(
     const Robot& robot,  const Eigen::VectorXd& q0, const Eigen::VectorXd& v0, 
     const Solution& s, Direction& d) const {
@@ -226,13 +269,15 @@ void DirectMultipleShooting::integrateSolution(
       terminal_stage_.updateDual(dual_step_size, ocp_data_[i]);
     }
     else if (grid.type == GridType::Impact) {
-      impact_stage_.expandDual(grid, ocp_data_[i], d[i+1], d[i]);
+      impact_stage_.expandDual(robots[omp_get_thread_num()], grid, 
+                               ocp_data_[i], d[i+1], d[i]);
       impact_stage_.updatePrimal(robots[omp_get_thread_num()], 
                                  primal_step_size, d[i], s[i], ocp_data_[i]);
       impact_stage_.updateDual(dual_step_size, ocp_data_[i]);
     }
     else {
-      intermediate_stage_.expandDual(grid, ocp_data_[i], d[i+1], d[i]);
+      intermediate_stage_.expandDual(robots[omp_get_thread_num()], grid, 
+                                     ocp_data_[i], d[i+1], d[i]);
       intermediate_stage_.updatePrimal(robots[omp_get_thread_num()], 
                                        primal_step_size, d[i], s[i], ocp_data_[i]);
       intermediate_stage_.updateDual(dual_step_size, ocp_data_[i]);
@@ -58,7 +58,7 @@ void ImpactStage::evalOCP(Robot& robot, const GridInfo& grid_info,
   assert(grid_info.type == GridType::Impact);
   // setup computation
   const auto& impact_status = contact_sequence_->impactStatus(grid_info.impact_index);
-  robot.updateKinematics(s.q, s.v+s.dv);
+  robot.updateFrameKinematics(s.q, s.v+s.dv);
   kkt_residual.setContactDimension(impact_status.dimf());
   kkt_residual.setSwitchingConstraintDimension(0);
   kkt_residual.setZero();
@@ -133,11 +133,11 @@ void ImpactStage::expandPrimal(const GridInfo& grid_info, OCPData& data,
 }
 
 
-void ImpactStage::expandDual(const GridInfo& grid_info, OCPData& data,
-                             const SplitDirection& d_next, 
+void ImpactStage::expandDual(const Robot& robot, const GridInfo& grid_info, 
+                             OCPData& data, const SplitDirection& d_next, 
                              SplitDirection& d) const {
   assert(grid_info.type == GridType::Impact);
-  expandImpactDynamicsDual(data.contact_dynamics_data, d_next, d);
+  expandImpactDynamicsDual(robot, data.contact_dynamics_data, d_next, d);
   correctCostateDirection(data.state_equation_data, d);
 }
 
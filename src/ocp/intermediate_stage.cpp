@@ -32,6 +32,7 @@ OCPData IntermediateStage::createData(const Robot& robot) const {
   data.state_equation_data = StateEquationData(robot);
   data.contact_dynamics_data = ContactDynamicsData(robot);
   data.switching_constraint_data = SwitchingConstraintData(robot);
+  data.lu = Eigen::VectorXd::Zero(robot.dimu());
   return data;
 }
 
@@ -59,7 +60,7 @@ void IntermediateStage::evalOCP(Robot& robot, const GridInfo& grid_info,
   assert(grid_info.type == GridType::Intermediate || grid_info.type == GridType::Lift);
   // setup computation
   const auto& contact_status = contact_sequence_->contactStatus(grid_info.phase);
-  robot.updateKinematics(s.q, s.v, s.a);
+  robot.updateFrameKinematics(s.q, s.v, s.a);
   kkt_residual.setContactDimension(contact_status.dimf());
   kkt_residual.setZero();
   data.performance_index.setZero();
@@ -130,6 +131,7 @@ void IntermediateStage::evalKKT(Robot& robot, const GridInfo& grid_info,
   data.performance_index.dual_feasibility 
       = data.dualFeasibility<1>() + kkt_residual.dualFeasibility<1>();
   data.performance_index.kkt_error = data.KKTError() + kkt_residual.KKTError();
+  data.lu = kkt_residual.lu;
   // Forms linear system
   constraints_->condenseSlackAndDual(contact_status, data.constraints_data, 
                                      kkt_matrix, kkt_residual);
@@ -159,7 +161,8 @@ void IntermediateStage::expandPrimal(const GridInfo& grid_info, OCPData& data,
 }
 
 
-void IntermediateStage::expandDual(const GridInfo& grid_info, OCPData& data,
+void IntermediateStage::expandDual(const Robot& robot, 
+                                   const GridInfo& grid_info, OCPData& data,
                                    const SplitDirection& d_next, 
                                    SplitDirection& d) const {
   assert(grid_info.type == GridType::Intermediate || grid_info.type == GridType::Lift);
@@ -168,8 +171,8 @@ void IntermediateStage::expandDual(const GridInfo& grid_info, OCPData& data,
   if (grid_info.num_grids_in_phase > 0) {
     dts = (d.dts_next - d.dts) / grid_info.num_grids_in_phase;
   }
-  expandContactDynamicsDual(grid_info.dt, dts, data.contact_dynamics_data, 
-                            d_next, d);
+  expandContactDynamicsDual(robot, grid_info.dt, dts, 
+                            data.contact_dynamics_data, d_next, d);
   correctCostateDirection(data.state_equation_data, d);
 }
 
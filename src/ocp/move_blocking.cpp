@@ -0,0 +1,66 @@
+#include "robotoc/ocp/move_blocking.hpp"
+
+#include <stdexcept>
+
+
+namespace robotoc {
+
+MoveBlocking::MoveBlocking(const std::vector<int>& block_sizes)
+  : block_sizes_(block_sizes),
+    is_blocked_(),
+    num_blocked_grids_(0) {
+  for (const auto e : block_sizes) {
+    if (e <= 0) {
+      throw std::out_of_range("[MoveBlocking] invalid argument: elements of 'block_sizes' must be positive!");
+    }
+  }
+}
+
+
+MoveBlocking::MoveBlocking()
+  : block_sizes_(),
+    is_blocked_(),
+    num_blocked_grids_(0) {
+}
+
+
+void MoveBlocking::update(const TimeDiscretization& time_discretization) {
+  const int N = time_discretization.size() - 1;
+  is_blocked_.assign(N+1, false);
+  num_blocked_grids_ = 0;
+  int block = 0;
+  int num_grids_in_block = 0;
+  for (int i=0; i<N; ++i) {
+    if (block >= block_sizes_.size()) break;
+    if (time_discretization[i].type == GridType::Impact) continue;
+    if (num_grids_in_block > 0
+          && isBlockable(time_discretization[i-1])
+          && isBlockable(time_discretization[i])) {
+      is_blocked_[i] = true;
+      ++num_blocked_grids_;
+    }
+    ++num_grids_in_block;
+    if (num_grids_in_block >= block_sizes_[block]) {
+      ++block;
+      num_grids_in_block = 0;
+    }
+  }
+}
+
+
+void MoveBlocking::projectSolution(Solution& s) const {
+  for (int i=1; i<is_blocked_.size(); ++i) {
+    if (is_blocked_[i]) {
+      s[i].u = s[i-1].u;
+    }
+  }
+}
+
+
+bool MoveBlocking::isBlockable(const GridInfo& grid_info) {
+  return (grid_info.type == GridType::Intermediate
+            && !grid_info.switching_constraint
+            && !grid_info.sto && !grid_info.sto_next);
+}
+
+} // namespace robotoc
\ No newline at end of file
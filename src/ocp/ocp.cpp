@@ -96,6 +96,20 @@ void OCP::disp(std::ostream& os) const {
   os << "  T: " << T << std::endl;
   os << "  N: " << N << std::endl;
   os << "  reserved_num_discrete_events: " << reserved_num_discrete_events << std::endl;
+  if (!time_steps.empty()) {
+    os << "  time_steps: [";
+    for (int i=0; i<time_steps.size()-1; ++i) {
+      os << time_steps[i] << ", ";
+    }
+    os << time_steps.back() << "]" << std::endl;
+  }
+  if (!move_blocking.empty()) {
+    os << "  move_blocking: [";
+    for (int i=0; i<move_blocking.size()-1; ++i) {
+      os << move_blocking[i] << ", ";
+    }
+    os << move_blocking.back() << "]" << std::endl;
+  }
   os << robot << std::endl;
 }
 
@@ -54,7 +54,7 @@ void TerminalStage::evalOCP(Robot& robot, const GridInfo& grid_info,
                             SplitKKTResidual& kkt_residual) const {
   assert(grid_info.type == GridType::Terminal);
   // setup computation
-  robot.updateKinematics(s.q, s.v);
+  robot.updateFrameKinematics(s.q, s.v);
   kkt_residual.setContactDimension(0);
   kkt_residual.setSwitchingConstraintDimension(0);
   kkt_residual.setZero();
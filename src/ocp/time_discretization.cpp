@@ -2,6 +2,8 @@
 #include "robotoc/utils/numerics.hpp"
 
 #include <iomanip>
+#include <algorithm>
+#include <cassert>
 
 
 namespace robotoc {
@@ -12,9 +14,15 @@ TimeDiscretization::TimeDiscretization(const double T, const int N,
     N_(N),
     num_grids_(N),
     reserved_num_discrete_events_(reserved_num_discrete_events),
+    time_steps_(),
     grid_(N+1+3*reserved_num_discrete_events, GridInfo()), 
+    grid_prev_(),
     sto_event_(), 
-    sto_phase_() {
+    sto_phase_(),
+    structure_changed_(N+1+3*reserved_num_discrete_events, true),
+    num_structure_changed_grids_(N+1),
+    contact_sequence_ptr_(nullptr),
+    contact_sequence_version_(0) {
   if (T <= 0) {
     throw std::out_of_range("[TimeDiscretization] invalid argument: 'T' must be positive!");
   }
@@ -24,6 +32,8 @@ TimeDiscretization::TimeDiscretization(const double T, const int N,
   if (reserved_num_discrete_events < 0) {
     throw std::out_of_range("[TimeDiscretization] invalid argument: 'reserved_num_discrete_events' must be non-negative!");
   }
+  time_steps_.assign(N, T/N);
+  grid_prev_.reserve(N+1+3*reserved_num_discrete_events);
   sto_event_.reserve(2*reserved_num_discrete_events+2);
   sto_phase_.reserve(2*reserved_num_discrete_events+2);
 }
@@ -34,15 +44,74 @@ TimeDiscretization::TimeDiscretization()
     N_(0),
     num_grids_(0),
     reserved_num_discrete_events_(0),
+    time_steps_(),
     grid_(), 
+    grid_prev_(),
     sto_event_(), 
-    sto_phase_() {
+    sto_phase_(),
+    structure_changed_(),
+    num_structure_changed_grids_(0),
+    contact_sequence_ptr_(nullptr),
+    contact_sequence_version_(0) {
+}
+
+
+void TimeDiscretization::setTimeSteps(const std::vector<double>& time_steps) {
+  if (time_steps.empty()) {
+    throw std::out_of_range("[TimeDiscretization] invalid argument: 'time_steps' must not be empty!");
+  }
+  double sum = 0;
+  for (const auto e : time_steps) {
+    if (e <= 0) {
+      throw std::out_of_range("[TimeDiscretization] invalid argument: elements of 'time_steps' must be positive!");
+    }
+    sum += e;
+  }
+  if (!numerics::isApprox(sum, T_, std::sqrt(std::numeric_limits<double>::epsilon()))) {
+    throw std::out_of_range(
+        "[TimeDiscretization] invalid argument: sum of 'time_steps' (" 
+        + std::to_string(sum) + ") must be T (" + std::to_string(T_) + ")!");
+  }
+  time_steps_ = time_steps;
+  N_ = time_steps.size();
+  if (grid_.size() < N_+1+3*reserved_num_discrete_events_) {
+    grid_.resize(N_+1+3*reserved_num_discrete_events_);
+  }
+}
+
+
+std::vector<double> TimeDiscretization::GeometricTimeSteps(const double T, 
+                                                           const int N, 
+                                                           const double ratio) {
+  if (T <= 0) {
+    throw std::out_of_range("[TimeDiscretization] invalid argument: 'T' must be positive!");
+  }
+  if (N <= 0) {
+    throw std::out_of_range("[TimeDiscretization] invalid argument: 'N' must be positive!");
+  }
+  if (ratio <= 0) {
+    throw std::out_of_range("[TimeDiscretization] invalid argument: 'ratio' must be positive!");
+  }
+  std::vector<double> time_steps(N);
+  double sum = 0;
+  double dt = 1.0;
+  for (int i=0; i<N; ++i) {
+    time_steps[i] = dt;
+    sum += dt;
+    dt *= ratio;
+  }
+  for (auto& e : time_steps) {
+    e *= (T / sum);
+  }
+  return time_steps;
 }
 
 
 void TimeDiscretization::discretize(
     const std::shared_ptr<ContactSequence>& contact_sequence, const double t) {
   const int N = N_ + contact_sequence->numLiftEvents() + 2 * contact_sequence->numImpactEvents() + 1;
+  const int num_grids_prev = std::min(num_grids_+1, static_cast<int>(grid_.size()));
+  grid_prev_.assign(grid_.begin(), grid_.begin()+num_grids_prev);
   if (grid_.size() <=N) {
     grid_.resize(N);
   }
@@ -56,12 +125,13 @@ void TimeDiscretization::discretize(
     if (contact_sequence->liftTime(next_lift_index) > t) break;
     ++next_lift_index;
   }
-  const double dt = T_ / N_;
   const double eps = std::sqrt(std::numeric_limits<double>::epsilon());
-  const double margin = 0.5 * dt;
+  const double margin = 0.5 * time_steps_.back();
   int stage = 0;
+  int k = 0;
   double ti = t;
-  while (ti+eps < t+T_) {
+  while (k < N_) {
+    double dt = time_steps_[k];
     const bool has_next_impact = (next_impact_index < contact_sequence->numImpactEvents());
     const bool has_next_lift = (next_lift_index < contact_sequence->numLiftEvents());
     grid_[stage].t = ti;
@@ -94,6 +164,9 @@ void TimeDiscretization::discretize(
         grid_[stage].type = GridType::Intermediate;
         if (numerics::isApprox(ti+dt, next_impact_time, eps)) {
           ti += dt;
+          ++k;
+          assert(k < N_);
+          dt = time_steps_[k];
           grid_[stage].dt = ti + dt - next_impact_time;
         }
       }
@@ -113,12 +186,16 @@ void TimeDiscretization::discretize(
         grid_[stage].type = GridType::Lift;
         if (numerics::isApprox(ti+dt, next_lift_time, eps)) {
           ti += dt;
+          ++k;
+          assert(k < N_);
+          dt = time_steps_[k];
           grid_[stage].dt = ti + dt - next_lift_time;
         }
       }
     }
     ++stage;
     ti += dt;
+    ++k;
   }
   grid_[stage].t  = t+T_;
   grid_[stage].dt = 0;
@@ -128,58 +205,88 @@ void TimeDiscretization::discretize(
   grid_[stage].lift_index = next_lift_index - 1;
   grid_[stage].type = GridType::Terminal;
   num_grids_ = stage;
+  setGridInfo(t);
+  updateStructureChanges(contact_sequence);
+}
 
-  // set dt_next
-  for (int i=0; i<num_grids_; ++i) {
-    grid_[i].dt_next = grid_[i+1].dt;
-  }
-  grid_[num_grids_].dt_next = 0.0;
 
-  // set switching_constraint flag
-  for (int i=0; i<num_grids_-1; ++i) {
-    grid_[i].switching_constraint = (grid_[i+2].type == GridType::Impact);
+void TimeDiscretization::remesh(
+    const std::shared_ptr<ContactSequence>& contact_sequence, const double t,
+    const std::vector<int>& num_grids_in_phase) {
+  const int num_phases = numPhases();
+  if (num_grids_in_phase.size() != num_phases) {
+    throw std::out_of_range(
+        "[TimeDiscretization] invalid argument: num_grids_in_phase.size() must be " 
+        + std::to_string(num_phases) + "!");
   }
-  grid_[num_grids_-1].switching_constraint = false;
-  grid_[num_grids_].switching_constraint = false;
-
-  // set t0 and disable sto
-  for (int i=0; i<=num_grids_; ++i) {
-    grid_[i].t0 = t;
-    grid_[i].sto = false;
-    grid_[i].sto_next = false;
-    grid_[i].stage_in_phase = 1;
-    grid_[i].num_grids_in_phase = 1;
+  int num_grids = 0;
+  for (const auto e : num_grids_in_phase) {
+    if (e <= 0) {
+      throw std::out_of_range(
+          "[TimeDiscretization] invalid argument: elements of num_grids_in_phase must be positive!");
+    }
+    num_grids += e;
   }
-
-  // count grids
-  int stage_in_phase = 0;
-  int phase_start_stage = 0;
+  const int num_grids_prev = std::min(num_grids_+1, static_cast<int>(grid_.size()));
+  grid_prev_.assign(grid_.begin(), grid_.begin()+num_grids_prev);
   for (int i=0; i<num_grids_; ++i) {
-    if (grid_[i].type == GridType::Impact) {
-      for (int j=phase_start_stage; j<i; ++j) {
-        grid_[j].num_grids_in_phase = stage_in_phase;
-      }
-      grid_[i].stage_in_phase = 0;
-      grid_[i].num_grids_in_phase = 0;
-      ++i;
-      stage_in_phase = 0;
-      phase_start_stage = i;
-    }
-    else if (grid_[i].type == GridType::Lift) {
-      for (int j=phase_start_stage; j<i; ++j) {
-        grid_[j].num_grids_in_phase = stage_in_phase;
-      }
-      stage_in_phase = 0;
-      phase_start_stage = i;
+    if (grid_prev_[i].type == GridType::Impact) {
+      ++num_grids;
     }
-    grid_[i].stage_in_phase = stage_in_phase;
-    ++stage_in_phase;
   }
-  for (int j=phase_start_stage; j<num_grids_; ++j) {
-    grid_[j].num_grids_in_phase = stage_in_phase;
+  if (grid_.size() <= num_grids) {
+    grid_.resize(num_grids+1);
   }
-  grid_[num_grids_].stage_in_phase = 0;
-  grid_[num_grids_].num_grids_in_phase = 0;
+  // The discrete events on the horizon are kept, and only the number of grids 
+  // of each contact phase is changed.
+  int stage = 0;
+  int prev_stage = 0;
+  int phase = grid_prev_[0].phase;
+  int impact_index = grid_prev_[0].impact_index;
+  int lift_index = grid_prev_[0].lift_index;
+  bool is_lift = false;
+  for (int p=0; p<num_phases; ++p) {
+    for (int k=0; k<num_grids_in_phase[p]; ++k) {
+      grid_[stage].stage = stage;
+      grid_[stage].phase = phase;
+      grid_[stage].impact_index = impact_index;
+      grid_[stage].lift_index = lift_index;
+      grid_[stage].type = (is_lift && k == 0) ? GridType::Lift 
+                                              : GridType::Intermediate;
+      ++stage;
+    }
+    if (p == num_phases-1) break;
+    // find the discrete event that ends this phase
+    while (grid_prev_[prev_stage+1].phase == grid_prev_[prev_stage].phase) {
+      ++prev_stage;
+    }
+    ++prev_stage;
+    ++phase;
+    if (grid_prev_[prev_stage].type == GridType::Impact) {
+      ++impact_index;
+      grid_[stage].stage = stage;
+      grid_[stage].phase = phase;
+      grid_[stage].impact_index = impact_index;
+      grid_[stage].lift_index = lift_index;
+      grid_[stage].type = GridType::Impact;
+      ++stage;
+      is_lift = false;
+    }
+    else {
+      assert(grid_prev_[prev_stage].type == GridType::Lift);
+      ++lift_index;
+      is_lift = true;
+    }
+  }
+  grid_[stage].stage = stage;
+  grid_[stage].phase = phase;
+  grid_[stage].impact_index = impact_index;
+  grid_[stage].lift_index = lift_index;
+  grid_[stage].type = GridType::Terminal;
+  num_grids_ = stage;
+  setGridInfo(t);
+  correctTimeSteps(contact_sequence, t);
+  updateStructureChanges(contact_sequence);
 }
 
 
@@ -262,6 +369,85 @@ void TimeDiscretization::correctTimeSteps(
 }
 
 
+void TimeDiscretization::setGridInfo(const double t) {
+  // set dt_next
+  for (int i=0; i<num_grids_; ++i) {
+    grid_[i].dt_next = grid_[i+1].dt;
+  }
+  grid_[num_grids_].dt_next = 0.0;
+
+  // set switching_constraint flag
+  for (int i=0; i<num_grids_-1; ++i) {
+    grid_[i].switching_constraint = (grid_[i+2].type == GridType::Impact);
+  }
+  grid_[num_grids_-1].switching_constraint = false;
+  grid_[num_grids_].switching_constraint = false;
+
+  // set t0 and disable sto
+  for (int i=0; i<=num_grids_; ++i) {
+    grid_[i].t0 = t;
+    grid_[i].sto = false;
+    grid_[i].sto_next = false;
+    grid_[i].stage_in_phase = 1;
+    grid_[i].num_grids_in_phase = 1;
+  }
+
+  // count grids
+  int stage_in_phase = 0;
+  int phase_start_stage = 0;
+  for (int i=0; i<num_grids_; ++i) {
+    if (grid_[i].type == GridType::Impact) {
+      for (int j=phase_start_stage; j<i; ++j) {
+        grid_[j].num_grids_in_phase = stage_in_phase;
+      }
+      grid_[i].stage_in_phase = 0;
+      grid_[i].num_grids_in_phase = 0;
+      ++i;
+      stage_in_phase = 0;
+      phase_start_stage = i;
+    }
+    else if (grid_[i].type == GridType::Lift) {
+      for (int j=phase_start_stage; j<i; ++j) {
+        grid_[j].num_grids_in_phase = stage_in_phase;
+      }
+      stage_in_phase = 0;
+      phase_start_stage = i;
+    }
+    grid_[i].stage_in_phase = stage_in_phase;
+    ++stage_in_phase;
+  }
+  for (int j=phase_start_stage; j<num_grids_; ++j) {
+    grid_[j].num_grids_in_phase = stage_in_phase;
+  }
+  grid_[num_grids_].stage_in_phase = 0;
+  grid_[num_grids_].num_grids_in_phase = 0;
+}
+
+
+void TimeDiscretization::updateStructureChanges(
+    const std::shared_ptr<ContactSequence>& contact_sequence) {
+  const bool contact_sequence_changed 
+      = (contact_sequence.get() != contact_sequence_ptr_ 
+          || contact_sequence->structureVersion() != contact_sequence_version_);
+  contact_sequence_ptr_ = contact_sequence.get();
+  contact_sequence_version_ = contact_sequence->structureVersion();
+  if (structure_changed_.size() < grid_.size()) {
+    structure_changed_.resize(grid_.size(), true);
+  }
+  num_structure_changed_grids_ = 0;
+  for (int i=0; i<=num_grids_; ++i) {
+    const bool changed 
+        = (contact_sequence_changed 
+            || i >= static_cast<int>(grid_prev_.size())
+            || !isStructureEqual(grid_[i], grid_prev_[i]));
+    structure_changed_[i] = changed;
+    if (changed) {
+      ++num_structure_changed_grids_;
+    }
+  }
+}
+
+
 void TimeDiscretization::disp(std::ostream& os) const {
   auto gridTypeToString = [](const GridType& type) {
     switch (type)
@@ -12,19 +12,34 @@ ContactSequence::ContactSequence(const Robot& robot,
                                  const int reserved_num_discrete_events)
   : reserved_num_discrete_events_(reserved_num_discrete_events),
     default_contact_status_(robot.createContactStatus()),
-    contact_statuses_(2*reserved_num_discrete_events+1),
-    impact_events_(reserved_num_discrete_events),
-    event_index_impact_(reserved_num_discrete_events), 
-    event_index_lift_(reserved_num_discrete_events),
-    event_time_(2*reserved_num_discrete_events),
-    impact_time_(reserved_num_discrete_events),
-    lift_time_(reserved_num_discrete_events),
-    is_impact_event_(2*reserved_num_discrete_events),
-    sto_impact_(reserved_num_discrete_events), 
-    sto_lift_(reserved_num_discrete_events) {
+    discrete_event_(default_contact_status_, default_contact_status_),
+    contact_statuses_(), 
+    impact_events_(),
+    event_index_impact_(), 
+    event_index_lift_(),
+    event_time_(),
+    impact_time_(),
+    lift_time_(),
+    is_impact_event_(),
+    sto_impact_(), 
+    sto_lift_(),
+    event_index_offset_(0),
+    structure_version_(0) {
   if (reserved_num_discrete_events < 0) {
     throw std::out_of_range("[ContactSequence] invalid argument: reserved_num_discrete_events must be non-negative!");
   }
+  contact_statuses_ = RingBuffer<ContactStatus>(2*reserved_num_discrete_events+1, 
+                                                default_contact_status_);
+  impact_events_ = RingBuffer<DiscreteEvent>(reserved_num_discrete_events, 
+                                             discrete_event_);
+  event_index_impact_.reserve(reserved_num_discrete_events);
+  event_index_lift_.reserve(reserved_num_discrete_events);
+  event_time_.reserve(2*reserved_num_discrete_events);
+  impact_time_.reserve(reserved_num_discrete_events);
+  lift_time_.reserve(reserved_num_discrete_events);
+  is_impact_event_.reserve(2*reserved_num_discrete_events);
+  sto_impact_.reserve(reserved_num_discrete_events);
+  sto_lift_.reserve(reserved_num_discrete_events);
   clear();
   contact_statuses_.push_back(default_contact_status_);
 }
@@ -33,6 +48,7 @@ ContactSequence::ContactSequence(const Robot& robot,
 ContactSequence::ContactSequence()
   : reserved_num_discrete_events_(0),
     default_contact_status_(),
+    discrete_event_(),
     contact_statuses_(),
     impact_events_(),
     event_index_impact_(), 
@@ -42,11 +58,16 @@ ContactSequence::ContactSequence()
     lift_time_(),
     is_impact_event_(),
     sto_impact_(),
-    sto_lift_() {
+    sto_lift_(),
+    event_index_offset_(0),
+    structure_version_(0) {
 }
 
 
 void ContactSequence::init(const ContactStatus& contact_status) {
+  if (discrete_event_.maxNumContacts() != contact_status.maxNumContacts()) {
+    discrete_event_ = DiscreteEvent(contact_status, contact_status);
+  }
   clear();
   contact_statuses_.push_back(contact_status);
 }
@@ -78,13 +99,13 @@ void ContactSequence::push_back(const DiscreteEvent& discrete_event,
   event_time_.push_back(event_time);
   if (discrete_event.existImpact()) {
     impact_events_.push_back(discrete_event);
-    event_index_impact_.push_back(contact_statuses_.size()-2);
+    event_index_impact_.push_back(numContactPhases()-2+event_index_offset_);
     impact_time_.push_back(event_time);
     is_impact_event_.push_back(true);
     sto_impact_.push_back(sto);
   }
   else {
-    event_index_lift_.push_back(contact_statuses_.size()-2);
+    event_index_lift_.push_back(numContactPhases()-2+event_index_offset_);
     lift_time_.push_back(event_time);
     is_impact_event_.push_back(false);
     sto_lift_.push_back(sto);
@@ -92,13 +113,18 @@ void ContactSequence::push_back(const DiscreteEvent& discrete_event,
   if (reserved_num_discrete_events_ < numDiscreteEvents()) {
     reserved_num_discrete_events_ = numDiscreteEvents();
   }
+  ++structure_version_;
 }
 
 
 void ContactSequence::push_back(const ContactStatus& contact_status, 
                                 const double switching_time, const bool sto) {
-  DiscreteEvent discrete_event(contact_statuses_.back(), contact_status);
-  push_back(discrete_event, switching_time, sto);
+  if (numContactPhases() == 0) {
+    throw std::runtime_error(
+        "[ContactSequence] call init() before calling push_back()!");
+  }
+  discrete_event_.setDiscreteEvent(contact_statuses_.back(), contact_status);
+  push_back(discrete_event_, switching_time, sto);
 }
 
 
@@ -124,6 +150,7 @@ void ContactSequence::pop_back() {
     contact_statuses_.pop_back();
     contact_statuses_.push_back(default_contact_status_);
   }
+  ++structure_version_;
 }
 
 
@@ -143,14 +170,14 @@ void ContactSequence::pop_front() {
     event_time_.pop_front();
     is_impact_event_.pop_front();
     contact_statuses_.pop_front();
-    for (auto& e : event_index_impact_) { e -= 1; }
-    for (auto& e : event_index_lift_) { e -= 1; }
+    ++event_index_offset_;
   }
   else if (numContactPhases() > 0) {
     assert(numContactPhases() == 1);
     contact_statuses_.pop_front();
     contact_statuses_.push_back(default_contact_status_);
   }
+  ++structure_version_;
 }
 
 
@@ -170,7 +197,7 @@ void ContactSequence::setImpactTime(const int impact_index,
         + std::to_string(numImpactEvents()) + ") !");
   }
   impact_time_[impact_index] = impact_time;
-  event_time_[event_index_impact_[impact_index]] = impact_time;
+  event_time_[impactEventIndex(impact_index)] = impact_time;
 }
 
 
@@ -189,7 +216,7 @@ void ContactSequence::setLiftTime(const int lift_index, const double lift_time)
         + std::to_string(numLiftEvents()) + ") !");
   }
   lift_time_[lift_index] = lift_time;
-  event_time_[event_index_lift_[lift_index]] = lift_time;
+  event_time_[liftEventIndex(lift_index)] = lift_time;
 }
 
 
@@ -239,7 +266,7 @@ void ContactSequence::setContactPlacements(
     if (is_impact_event_[contact_phase-1]) {
       for (int impact_index=0; ; ++impact_index) {
         assert(impact_index < numImpactEvents());
-        if (event_index_impact_[impact_index] == contact_phase-1) {
+        if (impactEventIndex(impact_index) == contact_phase-1) {
           impact_events_[impact_index].setContactPlacements(contact_positions);
           break;
         }
@@ -265,7 +292,7 @@ void ContactSequence::setContactPlacements(
     if (is_impact_event_[contact_phase-1]) {
       for (int impact_index=0; ; ++impact_index) {
         assert(impact_index < numImpactEvents());
-        if (event_index_impact_[impact_index] == contact_phase-1) {
+        if (impactEventIndex(impact_index) == contact_phase-1) {
           impact_events_[impact_index].setContactPlacements(contact_positions,
                                                               contact_rotations);
           break;
@@ -289,7 +316,7 @@ void ContactSequence::setContactPlacements(
     if (is_impact_event_[contact_phase-1]) {
       for (int impact_index=0; ; ++impact_index) {
         assert(impact_index < numImpactEvents());
-        if (event_index_impact_[impact_index] == contact_phase-1) {
+        if (impactEventIndex(impact_index) == contact_phase-1) {
           impact_events_[impact_index].setContactPlacements(contact_placements);
           break;
         }
@@ -312,7 +339,7 @@ void ContactSequence::setFrictionCoefficients(
     if (is_impact_event_[contact_phase-1]) {
       for (int impact_index=0; ; ++impact_index) {
         assert(impact_index < numImpactEvents());
-        if (event_index_impact_[impact_index] == contact_phase-1) {
+        if (impactEventIndex(impact_index) == contact_phase-1) {
           impact_events_[impact_index].setFrictionCoefficients(friction_coefficient);
           break;
         }
@@ -322,38 +349,18 @@ void ContactSequence::setFrictionCoefficients(
 }
 
 
-template <typename T> 
-void reserveDeque(std::deque<T>& deq, const int size) {
-  assert(size >= 0);
-  if (deq.empty()) {
-    deq.resize(size);
-  }
-  else {
-    const int current_size = deq.size();
-    if (current_size < size) {
-      while (deq.size() < size) {
-        deq.push_back(deq.back());
-      }
-      while (deq.size() > current_size) {
-        deq.pop_back();
-      }
-    }
-  }
-}
-
-
 void ContactSequence::reserve(const int reserved_num_discrete_events) {
   if (reserved_num_discrete_events_ < reserved_num_discrete_events) {
-    reserveDeque(contact_statuses_, 2*reserved_num_discrete_events+1);
-    reserveDeque(impact_events_, reserved_num_discrete_events);
-    reserveDeque(event_index_impact_, reserved_num_discrete_events);
-    reserveDeque(event_index_lift_, reserved_num_discrete_events);
-    reserveDeque(event_time_, 2*reserved_num_discrete_events);
-    reserveDeque(impact_time_, reserved_num_discrete_events);
-    reserveDeque(lift_time_, reserved_num_discrete_events);
-    reserveDeque(is_impact_event_, 2*reserved_num_discrete_events);
-    reserveDeque(sto_impact_, reserved_num_discrete_events);
-    reserveDeque(sto_lift_, reserved_num_discrete_events);
+    contact_statuses_.reserve(2*reserved_num_discrete_events+1);
+    impact_events_.reserve(reserved_num_discrete_events);
+    event_index_impact_.reserve(reserved_num_discrete_events);
+    event_index_lift_.reserve(reserved_num_discrete_events);
+    event_time_.reserve(2*reserved_num_discrete_events);
+    impact_time_.reserve(reserved_num_discrete_events);
+    lift_time_.reserve(reserved_num_discrete_events);
+    is_impact_event_.reserve(2*reserved_num_discrete_events);
+    sto_impact_.reserve(reserved_num_discrete_events);
+    sto_lift_.reserve(reserved_num_discrete_events);
     reserved_num_discrete_events_ = reserved_num_discrete_events;
   }
 }
@@ -364,6 +371,11 @@ int ContactSequence::reservedNumDiscreteEvents() const {
 }
 
 
+unsigned long ContactSequence::structureVersion() const {
+  return structure_version_;
+}
+
+
 void ContactSequence::clear() {
   contact_statuses_.clear();
   impact_events_.clear();
@@ -375,6 +387,8 @@ void ContactSequence::clear() {
   is_impact_event_.clear();
   sto_impact_.clear();
   sto_lift_.clear();
+  event_index_offset_ = 0;
+  ++structure_version_;
 }
 
 
@@ -14,7 +14,8 @@ RiccatiFactorizer::RiccatiFactorizer(const Robot& robot, const double max_dts0)
     llt_(robot.dimu()),
     llt_s_(),
     backward_recursion_(robot),
-    c_riccati_(robot) {
+    c_riccati_(robot),
+    BtQxu_(Eigen::MatrixXd::Zero(robot.dimu(), robot.dimu())) {
 }
 
 
@@ -27,7 +28,8 @@ RiccatiFactorizer::RiccatiFactorizer()
     llt_(),
     llt_s_(),
     backward_recursion_(),
-    c_riccati_() {
+    c_riccati_(),
+    BtQxu_() {
 }
 
 
@@ -197,6 +199,39 @@ void RiccatiFactorizer::backwardRiccatiRecursion(
 }
 
 
+void RiccatiFactorizer::accumulateMoveBlockedKKT(
+    const SplitKKTMatrix& kkt_matrix_next, 
+    const SplitKKTResidual& kkt_residual_next, SplitKKTMatrix& kkt_matrix, 
+    SplitKKTResidual& kkt_residual) {
+  assert(kkt_matrix.dims() == 0);
+  // The cost-to-go of the next stage includes 
+  // du^T Qxu_next^T dx_next + 1/2 du^T Quu_next du + lu_next^T du, 
+  // where dx_next = Fxx dx + Fxu du + Fx.
+  kkt_matrix.Qxu.noalias() += kkt_matrix.Fxx.transpose() * kkt_matrix_next.Qxu;
+  BtQxu_.noalias() = kkt_matrix.Fvu.transpose() * kkt_matrix_next.Qxu.bottomRows(dimv_);
+  kkt_matrix.Quu.noalias() += BtQxu_;
+  kkt_matrix.Quu.noalias() += BtQxu_.transpose();
+  kkt_matrix.Quu.noalias() += kkt_matrix_next.Quu;
+  kkt_residual.lu.noalias() += kkt_matrix_next.Qxu.transpose() * kkt_residual.Fx;
+  kkt_residual.lu.noalias() += kkt_residual_next.lu;
+}
+
+
+void RiccatiFactorizer::backwardRiccatiRecursionMoveBlocked(
+    const SplitRiccatiFactorization& riccati_next, SplitKKTMatrix& kkt_matrix, 
+    SplitKKTResidual& kkt_residual, SplitRiccatiFactorization& riccati) {
+  assert(kkt_matrix.dims() == 0);
+  backward_recursion_.factorizeKKTMatrix(riccati_next, kkt_matrix, kkt_residual);
+  backward_recursion_.factorizeRiccatiFactorization(riccati_next, kkt_matrix, 
+                                                    kkt_residual, riccati);
+  riccati.setConstraintDimension(0);
+  riccati.Psi.setZero();
+  riccati.xi = 0.;
+  riccati.chi = 0.;
+  riccati.eta = 0.;
+}
+
+
 void forwardRiccatiRecursion(const SplitKKTMatrix& kkt_matrix, 
                              const SplitKKTResidual& kkt_residual, 
                              const LQRPolicy& lqr_policy, 
@@ -231,6 +266,20 @@ void forwardRiccatiRecursion(const SplitKKTMatrix& kkt_matrix,
 }
 
 
+void forwardRiccatiRecursionMoveBlocked(const SplitKKTMatrix& kkt_matrix, 
+                                        const SplitKKTResidual& kkt_residual, 
+                                        const SplitDirection& d_prev, 
+                                        SplitDirection& d, 
+                                        SplitDirection& d_next) {
+  d.du = d_prev.du;
+  d_next.dx = kkt_residual.Fx;
+  d_next.dx.noalias()   += kkt_matrix.Fxx * d.dx;
+  d_next.dv().noalias() += kkt_matrix.Fvu * d.du;
+  d_next.dts = d.dts;
+  d_next.dts_next = d.dts_next;
+}
+
+
 void computeSwitchingTimeDirection(const STOPolicy& sto_policy, SplitDirection& d, 
                                    const bool has_prev_sto_phase) {
   d.dts_next = sto_policy.dtsdx.dot(d.dx) + sto_policy.dts0;
@@ -262,6 +311,14 @@ void computeCostateDirection(const SplitRiccatiFactorization& riccati,
 }
 
 
+void computeCostateDirectionMoveBlocked(const SplitRiccatiFactorization& riccati, 
+                                        const SplitKKTMatrix& kkt_matrix, 
+                                        SplitDirection& d) {
+  d.dlmdgmm.noalias()  = riccati.P * d.dx - riccati.s;
+  d.dlmdgmm.noalias() += kkt_matrix.Qxu * d.du;
+}
+
+
 void computeLagrangeMultiplierDirection(const SplitRiccatiFactorization& riccati, 
                                         SplitDirection& d, const bool sto, 
                                         const bool has_next_sto_phase) {
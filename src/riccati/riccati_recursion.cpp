@@ -32,13 +32,32 @@ void RiccatiRecursion::setRegularization(const double max_dts0) {
 void RiccatiRecursion::backwardRiccatiRecursion(
     const TimeDiscretization& time_discretization, KKTMatrix& kkt_matrix, 
     KKTResidual& kkt_residual, RiccatiFactorization& factorization) {
+  backwardRiccatiRecursion(time_discretization, MoveBlocking(), 
+                           kkt_matrix, kkt_residual, factorization);
+}
+
+
+void RiccatiRecursion::backwardRiccatiRecursion(
+    const TimeDiscretization& time_discretization, 
+    const MoveBlocking& move_blocking, KKTMatrix& kkt_matrix, 
+    KKTResidual& kkt_residual, RiccatiFactorization& factorization) {
   resizeData(time_discretization);
   const int N = time_discretization.size() - 1;
   factorization[N].P = kkt_matrix[N].Qxx;
   factorization[N].s = - kkt_residual[N].lx;
   for (int i=N-1; i>=0; --i) {
     const auto& grid = time_discretization[i];
-    if (grid.type == GridType::Impact) {
+    if (move_blocking.isBlocked(i+1)) {
+      factorizer_.accumulateMoveBlockedKKT(kkt_matrix[i+1], kkt_residual[i+1],
+                                           kkt_matrix[i], kkt_residual[i]);
+    }
+    if (move_blocking.isBlocked(i)) {
+      factorizer_.backwardRiccatiRecursionMoveBlocked(factorization[i+1], 
+                                                      kkt_matrix[i], 
+                                                      kkt_residual[i], 
+                                                      factorization[i]);
+    }
+    else if (grid.type == GridType::Impact) {
       if (time_discretization[i-1].sto || grid.sto) {
         factorizer_.backwardRiccatiRecursionPhaseTransition(
             factorization[i+1], factorization_m_, sto_policy_[i], grid.sto_next);
@@ -77,6 +96,11 @@ void RiccatiRecursion::backwardRiccatiRecursion(
     factorizer_.backwardRiccatiRecursionPhaseTransition(
         factorization[0], factorization_m_, sto_policy_[0], grid.sto_next);
   }
+  for (int i=1; i<N; ++i) {
+    if (move_blocking.isBlocked(i)) {
+      lqr_policy_[i] = lqr_policy_[i-1];
+    }
+  }
 }
 
 
@@ -84,6 +108,16 @@ void RiccatiRecursion::forwardRiccatiRecursion(
     const TimeDiscretization& time_discretization, const KKTMatrix& kkt_matrix, 
     const KKTResidual& kkt_residual, const RiccatiFactorization& factorization,
     Direction& d) const {
+  forwardRiccatiRecursion(time_discretization, MoveBlocking(), kkt_matrix, 
+                          kkt_residual, factorization, d);
+}
+
+
+void RiccatiRecursion::forwardRiccatiRecursion(
+    const TimeDiscretization& time_discretization, 
+    const MoveBlocking& move_blocking, const KKTMatrix& kkt_matrix, 
+    const KKTResidual& kkt_residual, const RiccatiFactorization& factorization,
+    Direction& d) const {
   const int N = time_discretization.size() - 1;
   d[0].dts = 0.0;
   d[0].dts_next = 0.0;
@@ -93,7 +127,13 @@ void RiccatiRecursion::forwardRiccatiRecursion(
   }
   for (int i=0; i<N; ++i) {
     const auto& grid = time_discretization[i];
-    if (grid.type == GridType::Impact) {
+    if (move_blocking.isBlocked(i)) {
+      ::robotoc::forwardRiccatiRecursionMoveBlocked(kkt_matrix[i], kkt_residual[i], 
+                                                    d[i-1], d[i], d[i+1]);
+      ::robotoc::computeCostateDirectionMoveBlocked(factorization[i], 
+                                                    kkt_matrix[i], d[i]);
+    }
+    else if (grid.type == GridType::Impact) {
       d[i].dts = d[i-1].dts_next;
       d[i].dts_next = 0.0;
       ::robotoc::forwardRiccatiRecursion(kkt_matrix[i], kkt_residual[i], d[i], d[i+1]);
@@ -1,10 +1,134 @@
 #include "robotoc/robot/robot.hpp"
 
 #include <stdexcept>
+#include <fstream>
+#include <sstream>
+#include <cstdint>
+#include <cstdio>
+#include <random>
+#include <memory>
+#include <utility>
+
+#include "pinocchio/serialization/model.hpp"
+#include "pinocchio/algorithm/model.hpp"
 
 
 namespace robotoc {
 
+namespace {
+
+void buildModelFromURDF(const RobotModelInfo& info, pinocchio::Model& model) {
+  switch (info.base_joint_type) {
+    case BaseJointType::FloatingBase:
+      pinocchio::urdf::buildModel(info.urdf_path, 
+                                  pinocchio::JointModelFreeFlyer(), model);
+      break;
+    case BaseJointType::FixedBase:
+      pinocchio::urdf::buildModel(info.urdf_path, model);
+      break;
+    default:
+      throw std::invalid_argument(
+          "[Robot] invalid argument: invalid base joint type");
+      break;
+  }
+}
+
+
+// 64-bit FNV-1a hash, which is stable across platforms and builds.
+std::uint64_t hashString(const std::string& str, 
+                         std::uint64_t hash=14695981039346656037ULL) {
+  for (const char c : str) {
+    hash ^= static_cast<unsigned char>(c);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+
+std::string modelCachePath(const RobotModelInfo& info) {
+  std::ifstream urdf(info.urdf_path, std::ios::binary);
+  if (!urdf) {
+    throw std::invalid_argument(
+        "[Robot] invalid argument: cannot open URDF '" + info.urdf_path + "'");
+  }
+  std::stringstream urdf_content;
+  urdf_content << urdf.rdbuf();
+  std::uint64_t hash = hashString(info.urdf_path);
+  hash = hashString(urdf_content.str(), hash);
+  hash = hashString(
+      (info.base_joint_type == BaseJointType::FloatingBase) ? "floating" : "fixed", 
+      hash);
+  std::stringstream path;
+  path << info.model_cache_dir << "/robotoc_model_" << std::hex << hash << ".bin";
+  return path.str();
+}
+
+
+void buildModel(const RobotModelInfo& info, pinocchio::Model& model) {
+  if (info.model_cache_dir.empty()) {
+    buildModelFromURDF(info, model);
+    return;
+  }
+  const std::string cache_path = modelCachePath(info);
+  if (std::ifstream(cache_path)) {
+    try {
+      model.loadFromBinary(cache_path);
+      return;
+    }
+    catch (const std::exception&) {
+      // Falls back to the URDF if the cache is corrupted or outdated.
+      model = pinocchio::Model();
+    }
+  }
+  buildModelFromURDF(info, model);
+  // Writes to a temporary file first and renames it so that other processes 
+  // building the same robot never load a partially written cache.
+  std::stringstream tmp_path;
+  tmp_path << cache_path << ".tmp" << std::hex << std::random_device()();
+  try {
+    model.saveToBinary(tmp_path.str());
+    if (std::rename(tmp_path.str().c_str(), cache_path.c_str()) != 0) {
+      std::remove(tmp_path.str().c_str());
+    }
+  }
+  catch (const std::exception&) {
+    // The cache is optional, e.g., the directory can be read-only.
+    std::remove(tmp_path.str().c_str());
+  }
+}
+
+
+void lockJoints(const RobotModelInfo& info, pinocchio::Model& model) {
+  if (info.locked_joints.empty()) return;
+  Eigen::VectorXd q_locked = pinocchio::neutral(model);
+  std::vector<pinocchio::JointIndex> locked_joint_ids;
+  for (const auto& e : info.locked_joints) {
+    if (!model.existJointName(e.first)) {
+      throw std::invalid_argument(
+          "[Robot] invalid argument: locked joint '" + e.first + "' does not exist");
+    }
+    const pinocchio::JointIndex joint_id = model.getJointId(e.first);
+    if (info.base_joint_type == BaseJointType::FloatingBase && joint_id == 1) {
+      throw std::invalid_argument(
+          "[Robot] invalid argument: the floating base cannot be locked");
+    }
+    const int nq_joint = model.joints[joint_id].nq();
+    if (e.second.size() != nq_joint) {
+      throw std::invalid_argument(
+          "[Robot] invalid argument: size of the configuration of locked joint '" 
+          + e.first + "' must be " + std::to_string(nq_joint));
+    }
+    q_locked.segment(model.joints[joint_id].idx_q(), nq_joint) = e.second;
+    locked_joint_ids.push_back(joint_id);
+  }
+  pinocchio::Model reduced_model;
+  pinocchio::buildReducedModel(model, locked_joint_ids, q_locked, reduced_model);
+  model = reduced_model;
+}
+
+} // namespace
+
+
 Robot::Robot(const RobotModelInfo& info)
   : info_(info),
     model_(),
@@ -25,58 +149,55 @@ Robot::Robot(const RobotModelInfo& info)
     joint_effort_limit_(),
     joint_velocity_limit_(),
     lower_joint_position_limit_(),
-    upper_joint_position_limit_() {
-  switch (info.base_joint_type) {
-    case BaseJointType::FloatingBase:
-      pinocchio::urdf::buildModel(info.urdf_path, 
-                                  pinocchio::JointModelFreeFlyer(), model_);
-      dim_passive_ = 6;
-      break;
-    case BaseJointType::FixedBase:
-      pinocchio::urdf::buildModel(info.urdf_path, model_);
-      dim_passive_ = 0;
-      break;
-    default:
-      std::runtime_error("[Robot] invalid argument: invalid base joint type");
-      break;
-  }
-  impact_model_ = model_;
-  impact_model_.gravity.linear().setZero();
-  data_ = pinocchio::Data(model_);
-  impact_data_ = pinocchio::Data(impact_model_);
+    upper_joint_position_limit_(),
+    q_kinematics_(),
+    has_frame_kinematics_(false) {
+  pinocchio::Model model;
+  buildModel(info, model);
+  lockJoints(info, model);
+  dim_passive_ = (info.base_joint_type == BaseJointType::FloatingBase) ? 6 : 0;
+  // The models are immutable and shared among the copies of this robot, 
+  // e.g., the per-thread robots of the solvers. Only the datas are copied.
+  pinocchio::Model impact_model(model);
+  impact_model.gravity.linear().setZero();
+  impact_model_ = std::make_shared<const pinocchio::Model>(std::move(impact_model));
+  model_ = std::make_shared<const pinocchio::Model>(std::move(model));
+  data_ = pinocchio::Data(*model_);
+  impact_data_ = pinocchio::Data(*impact_model_);
   fjoint_ = pinocchio::container::aligned_vector<pinocchio::Force>(
-                model_.joints.size(), pinocchio::Force::Zero());
+                model_->joints.size(), pinocchio::Force::Zero());
   point_contacts_.clear();
   for (const auto& e : info.point_contacts) {
-    point_contacts_.push_back(PointContact(model_, e));
+    point_contacts_.push_back(PointContact(*model_, e));
   }
   surface_contacts_.clear();
   for (const auto& e : info.surface_contacts) {
-    surface_contacts_.push_back(SurfaceContact(model_, e));
+    surface_contacts_.push_back(SurfaceContact(*model_, e));
   }
-  dimq_ = model_.nq;
-  dimv_ = model_.nv;
-  dimu_ = model_.nv - dim_passive_;
+  dimq_ = model_->nq;
+  dimv_ = model_->nv;
+  dimu_ = model_->nv - dim_passive_;
   max_dimf_ = 3 * point_contacts_.size() + 6 * surface_contacts_.size();
   max_num_contacts_ = point_contacts_.size() + surface_contacts_.size();
   data_.JMinvJt.resize(max_dimf_, max_dimf_);
   data_.JMinvJt.setZero();
-  data_.sDUiJt.resize(model_.nv, max_dimf_);
+  data_.sDUiJt.resize(model_->nv, max_dimf_);
   data_.sDUiJt.setZero();
   impact_data_.JMinvJt.resize(max_dimf_, max_dimf_);
   impact_data_.JMinvJt.setZero();
-  impact_data_.sDUiJt.resize(model_.nv, max_dimf_);
+  impact_data_.sDUiJt.resize(model_->nv, max_dimf_);
   impact_data_.sDUiJt.setZero();
-  dimpact_dv_.resize(model_.nv, model_.nv);
+  dimpact_dv_.resize(model_->nv, model_->nv);
   dimpact_dv_.setZero();
+  q_kinematics_.resize(model_->nq);
   initializeJointLimits();
 }
 
 
 Robot::Robot()
   : info_(),
-    model_(),
-    impact_model_(),
+    model_(std::make_shared<const pinocchio::Model>()),
+    impact_model_(std::make_shared<const pinocchio::Model>()),
     data_(),
     impact_data_(),
     fjoint_(),
@@ -93,7 +214,9 @@ Robot::Robot()
     joint_effort_limit_(),
     joint_velocity_limit_(),
     lower_joint_position_limit_(),
-    upper_joint_position_limit_() {
+    upper_joint_position_limit_(),
+    q_kinematics_(),
+    has_frame_kinematics_(false) {
 }
 
 
@@ -136,7 +259,7 @@ const Eigen::Vector3d& Robot::CoM() const {
 
 Eigen::Vector3d Robot::frameLinearVelocity(
     const int frame_id, const pinocchio::ReferenceFrame reference_frame) const {
-  return pinocchio::getFrameVelocity(model_, data_, frame_id, reference_frame).linear();
+  return pinocchio::getFrameVelocity(*model_, data_, frame_id, reference_frame).linear();
 }
 
 
@@ -149,7 +272,7 @@ Eigen::Vector3d Robot::frameLinearVelocity(
 
 Eigen::Vector3d Robot::frameAngularVelocity(
     const int frame_id, const pinocchio::ReferenceFrame reference_frame) const {
-  return pinocchio::getFrameVelocity(model_, data_, frame_id, reference_frame).angular();
+  return pinocchio::getFrameVelocity(*model_, data_, frame_id, reference_frame).angular();
 }
 
 
@@ -162,7 +285,7 @@ Eigen::Vector3d Robot::frameAngularVelocity(
 
 Robot::Vector6d Robot::frameSpatialVelocity(
     const int frame_id, const pinocchio::ReferenceFrame reference_frame) const {
-  return pinocchio::getFrameVelocity(model_, data_, frame_id, reference_frame).toVector();
+  return pinocchio::getFrameVelocity(*model_, data_, frame_id, reference_frame).toVector();
 }
 
 
@@ -206,6 +329,22 @@ void Robot::setContactForces(const ContactStatus& contact_status,
 }
 
 
+void Robot::swapMJtJFactorization(Eigen::MatrixXd& U, Eigen::VectorXd& D, 
+                                  Eigen::MatrixXd& sDUiJt, Eigen::MatrixXd& L) {
+  assert(U.rows() == dimv_);
+  assert(U.cols() == dimv_);
+  assert(D.size() == dimv_);
+  assert(sDUiJt.rows() == dimv_);
+  assert(sDUiJt.cols() == max_dimf_);
+  assert(L.rows() == max_dimf_);
+  assert(L.cols() == max_dimf_);
+  data_.U.swap(U);
+  data_.D.swap(D);
+  data_.sDUiJt.swap(sDUiJt);
+  data_.JMinvJt.swap(L);
+}
+
+
 Eigen::VectorXd Robot::generateFeasibleConfiguration() const {
   Eigen::VectorXd q_min(dimq_), q_max(dimq_);
   if (info_.base_joint_type == BaseJointType::FloatingBase) {
@@ -214,31 +353,31 @@ Eigen::VectorXd Robot::generateFeasibleConfiguration() const {
   }
   q_min.tail(dimu_) = lower_joint_position_limit_;
   q_max.tail(dimu_) = upper_joint_position_limit_;
-  return pinocchio::randomConfiguration(model_, q_min, q_max);
+  return pinocchio::randomConfiguration(*model_, q_min, q_max);
 }
 
 
 int Robot::frameId(const std::string& frame_name) const {
-  if (!model_.existFrame(frame_name)) {
+  if (!model_->existFrame(frame_name)) {
     throw std::invalid_argument(
         "[Robot] invalid argument: frame '" + frame_name + "' does not exit!");
   }
-  return model_.getFrameId(frame_name);
+  return model_->getFrameId(frame_name);
 }
 
 
 std::string Robot::frameName(const int frame_id) const {
-  return  model_.frames[frame_id].name;
+  return  model_->frames[frame_id].name;
 }
 
 
 double Robot::totalMass() const {
-  return pinocchio::computeTotalMass(model_);
+  return pinocchio::computeTotalMass(*model_);
 }
 
 
 double Robot::totalWeight() const {
-  return (- pinocchio::computeTotalMass(model_) * model_.gravity981.coeff(2));
+  return (- pinocchio::computeTotalMass(*model_) * model_->gravity981.coeff(2));
 }
 
 
@@ -402,15 +541,15 @@ Eigen::VectorXd Robot::upperJointPositionLimit() const {
 
 
 void Robot::initializeJointLimits() {
-  const int njoints = model_.nv - dim_passive_;
+  const int njoints = model_->nv - dim_passive_;
   joint_effort_limit_.resize(njoints);
   joint_velocity_limit_.resize(njoints);
   lower_joint_position_limit_.resize(njoints);
   upper_joint_position_limit_.resize(njoints);
-  joint_effort_limit_ = model_.effortLimit.tail(njoints);
-  joint_velocity_limit_ = model_.velocityLimit.tail(njoints);
-  lower_joint_position_limit_ = model_.lowerPositionLimit.tail(njoints);
-  upper_joint_position_limit_ = model_.upperPositionLimit.tail(njoints);
+  joint_effort_limit_ = model_->effortLimit.tail(njoints);
+  joint_velocity_limit_ = model_->velocityLimit.tail(njoints);
+  lower_joint_position_limit_ = model_->lowerPositionLimit.tail(njoints);
+  upper_joint_position_limit_ = model_->upperPositionLimit.tail(njoints);
 }
 
 
@@ -478,7 +617,7 @@ void Robot::setRobotProperties(const RobotProperties& properties) {
 
 void Robot::disp(std::ostream& os) const {
   os << "Robot:" << std::endl;
-  os << "  name: " << model_.name << std::endl;
+  os << "  name: " << model_->name << std::endl;
   if (info_.base_joint_type == BaseJointType::FloatingBase) {
     os << "  base joint: floating base" << std::endl;
   }
@@ -498,17 +637,17 @@ void Robot::disp(std::ostream& os) const {
   os << "  dim_passive = " << dim_passive_ << std::endl;
   os << std::endl;
   os << "  frames:" << std::endl;
-  for (int i=0; i<model_.nframes; ++i) {
+  for (int i=0; i<model_->nframes; ++i) {
     os << "    frame " << i << std::endl;
-    os << "      name: " << model_.frames[i].name << std::endl;
-    os << "      parent joint id: " << model_.frames[i].parent << std::endl;
+    os << "      name: " << model_->frames[i].name << std::endl;
+    os << "      parent joint id: " << model_->frames[i].parent << std::endl;
     os << std::endl;
   }
   os << "  joints:" << std::endl;
-  for (int i=0; i<model_.njoints; ++i) {
+  for (int i=0; i<model_->njoints; ++i) {
     os << "    joint " << i << std::endl;
-    os << "      name: " << model_.names[i] << std::endl;
-    os << model_.joints[i] << std::endl;
+    os << "      name: " << model_->names[i] << std::endl;
+    os << model_->joints[i] << std::endl;
   }
   os << "  effort limit = [" << joint_effort_limit_.transpose() << "]" 
             << std::endl;
@@ -0,0 +1,98 @@
+#include "robotoc/solver/mesh_refiner.hpp"
+
+#include <stdexcept>
+#include <cmath>
+#include <algorithm>
+
+
+namespace robotoc {
+
+MeshRefiner::MeshRefiner(const double tol, const double coarsening_ratio)
+  : tol_(tol),
+    coarsening_ratio_(coarsening_ratio),
+    num_grids_in_phase_(),
+    phase_error_(),
+    phase_duration_() {
+  setTolerance(tol, coarsening_ratio);
+}
+
+
+void MeshRefiner::setTolerance(const double tol,
+                               const double coarsening_ratio) {
+  if (tol <= 0) {
+    throw std::out_of_range("[MeshRefiner] invalid argument: 'tol' must be positive!");
+  }
+  if (coarsening_ratio < 0 || coarsening_ratio >= 1) {
+    throw std::out_of_range("[MeshRefiner] invalid argument: 'coarsening_ratio' must be in [0, 1)!");
+  }
+  tol_ = tol;
+  coarsening_ratio_ = coarsening_ratio;
+}
+
+
+bool MeshRefiner::refine(const TimeDiscretization& time_discretization,
+                         const Solution& s, const double max_dt) {
+  const int num_phases = time_discretization.numPhases();
+  const int phase0 = time_discretization.front().phase;
+  num_grids_in_phase_.assign(num_phases, 0);
+  phase_error_.assign(num_phases, 0.0);
+  phase_duration_.assign(num_phases, 0.0);
+  const int N = time_discretization.size() - 1;
+  for (int i=0; i<N; ++i) {
+    const auto& grid = time_discretization[i];
+    if (grid.type == GridType::Impact) continue;
+    const int phase = grid.phase - phase0;
+    num_grids_in_phase_[phase] = grid.num_grids_in_phase;
+    phase_duration_[phase] += grid.dt;
+    phase_error_[phase] = std::max(phase_error_[phase],
+                                   estimateError(grid, s[i],
+                                                 time_discretization[i+1], s[i+1]));
+  }
+  // The local error of the forward Euler method is O(dt^2). The number of
+  // grids is therefore scaled by sqrt(error/target), where the target is the
+  // geometric mean of the both ends of the acceptable range.
+  const double target = std::sqrt(coarsening_ratio_) * tol_;
+  bool is_changed = false;
+  for (int phase=0; phase<num_phases; ++phase) {
+    const int num_grids = num_grids_in_phase_[phase];
+    const double error = phase_error_[phase];
+    int num_grids_new = num_grids;
+    if (error > tol_) {
+      num_grids_new = std::min(
+          static_cast<int>(std::ceil(num_grids*std::sqrt(error/target))),
+          2*num_grids);
+    }
+    else if (error < coarsening_ratio_*tol_) {
+      num_grids_new = std::max(
+          static_cast<int>(std::ceil(num_grids*std::sqrt(error/target))),
+          (num_grids+1)/2);
+    }
+    if (max_dt > 0) {
+      num_grids_new = std::max(
+          static_cast<int>(std::ceil(phase_duration_[phase]/max_dt)),
+          num_grids_new);
+    }
+    num_grids_new = std::max(num_grids_new, 1);
+    if (num_grids_new != num_grids) {
+      num_grids_in_phase_[phase] = num_grids_new;
+      is_changed = true;
+    }
+  }
+  return is_changed;
+}
+
+
+double MeshRefiner::estimateError(const GridInfo& grid_info,
+                                  const SplitSolution& s,
+                                  const GridInfo& grid_info_next,
+                                  const SplitSolution& s_next) {
+  const double dt = grid_info.dt;
+  double error = dt * s.a.lpNorm<Eigen::Infinity>();
+  if (grid_info_next.type == GridType::Intermediate
+        && grid_info_next.phase == grid_info.phase) {
+    error += (s_next.a-s.a).lpNorm<Eigen::Infinity>();
+  }
+  return 0.5 * dt * error;
+}
+
+} // namespace robotoc
\ No newline at end of file
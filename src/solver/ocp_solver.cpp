@@ -12,6 +12,7 @@ OCPSolver::OCPSolver(const OCP& ocp,
   : robots_(solver_options.nthreads, ocp.robot),
     contact_sequence_(ocp.contact_sequence),
     time_discretization_(ocp.T, ocp.N, ocp.reserved_num_discrete_events),
+    move_blocking_(ocp.move_blocking),
     dms_(ocp, solver_options.nthreads),
     sto_(ocp),
     riccati_recursion_(ocp, solver_options.max_dts_riccati),
@@ -23,9 +24,12 @@ OCPSolver::OCPSolver(const OCP& ocp,
     d_(ocp.N+1+ocp.reserved_num_discrete_events, SplitDirection(ocp.robot)),
     riccati_factorization_(ocp.N+1+ocp.reserved_num_discrete_events+1, SplitRiccatiFactorization(ocp.robot)),
     solution_interpolator_(solver_options.interpolation_order),
+    mesh_refiner_(solver_options.mesh_refinement_tol, 
+                  solver_options.mesh_coarsening_ratio),
     solver_options_(solver_options),
     solver_statistics_(),
-    timer_() {
+    timer_(),
+    update_all_contact_status_(false) {
   if (!ocp.cost) {
     throw std::out_of_range("[OCPSolver] invalid argument: ocp.cost should not be nullptr!");
   }
@@ -47,6 +51,12 @@ OCPSolver::OCPSolver(const OCP& ocp,
   if (solver_options.nthreads <= 0) {
     throw std::out_of_range("[OCPSolver] invalid argument: solver_options.nthreads must be positive!");
   }
+  if (!ocp.time_steps.empty()) {
+    if (ocp.time_steps.size() != ocp.N) {
+      throw std::out_of_range("[OCPSolver] invalid argument: ocp.time_steps.size() must be ocp.N!");
+    }
+    time_discretization_.setTimeSteps(ocp.time_steps);
+  }
   for (auto& e : s_)  { ocp.robot.normalizeConfiguration(e.q); }
   if (ocp.sto_cost && ocp.sto_constraints) {
     solver_options_.discretization_method = DiscretizationMethod::PhaseBased;
@@ -58,6 +68,7 @@ OCPSolver::OCPSolver()
   : robots_(),
     contact_sequence_(),
     time_discretization_(),
+    move_blocking_(),
     dms_(),
     sto_(),
     riccati_recursion_(),
@@ -69,9 +80,11 @@ OCPSolver::OCPSolver()
     d_(),
     riccati_factorization_(),
     solution_interpolator_(),
+    mesh_refiner_(),
     solver_options_(),
     solver_statistics_(),
-    timer_() {
+    timer_(),
+    update_all_contact_status_(false) {
 }
 
 
@@ -85,6 +98,8 @@ void OCPSolver::setSolverOptions(const SolverOptions& solver_options) {
   dms_.setNumThreads(solver_options.nthreads);
   riccati_recursion_.setRegularization(solver_options_.max_dts_riccati);
   solution_interpolator_.setInterpolationOrder(solver_options.interpolation_order);
+  mesh_refiner_.setTolerance(solver_options.mesh_refinement_tol,
+                             solver_options.mesh_coarsening_ratio);
   line_search_.set(solver_options.line_search_settings);
   solver_options_ = solver_options;
   if (ocp_.sto_cost && ocp_.sto_constraints) {
@@ -115,13 +130,22 @@ void OCPSolver::updateSolution(const double t, const Eigen::VectorXd& q,
   if (solver_options_.discretization_method == DiscretizationMethod::PhaseBased) {
     time_discretization_.correctTimeSteps(contact_sequence_, t);
   }
+  if (move_blocking_.enabled()) {
+    move_blocking_.update(time_discretization_);
+    move_blocking_.projectSolution(s_);
+  }
   dms_.evalKKT(robots_, time_discretization_, q, v, s_, kkt_matrix_, kkt_residual_);
+  if (move_blocking_.enabled()) {
+    dms_.correctKKTError(time_discretization_, move_blocking_);
+  }
   sto_.evalKKT(time_discretization_, kkt_matrix_, kkt_residual_);
   riccati_recursion_.backwardRiccatiRecursion(time_discretization_, 
+                                              move_blocking_, 
                                               kkt_matrix_, kkt_residual_, 
                                               riccati_factorization_);
   dms_.computeInitialStateDirection(robots_[0], q, v, s_, d_);
   riccati_recursion_.forwardRiccatiRecursion(time_discretization_, 
+                                             move_blocking_, 
                                              kkt_matrix_, kkt_residual_, 
                                              riccati_factorization_, d_);
   dms_.computeStepSizes(time_discretization_, d_);
@@ -157,9 +181,15 @@ void OCPSolver::solve(const double t, const Eigen::VectorXd& q,
     timer_.tick();
   }
   if (init_solver) {
+    if (solver_options_.enable_solution_interpolation
+          && solver_options_.interpolation_order == InterpolationOrder::LQRRollout
+          && solution_interpolator_.hasStoredSolution()) {
+      rolloutLQRPolicy(t, q, v);
+    }
     discretize(t);
     if (solver_options_.enable_solution_interpolation) {
       solution_interpolator_.interpolate(robots_[0], time_discretization_, s_);
+      setContactStatus(true);
     }
     dms_.initConstraints(robots_, time_discretization_, s_);
     sto_.initConstraints(time_discretization_);
@@ -176,20 +206,32 @@ void OCPSolver::solve(const double t, const Eigen::VectorXd& q,
       else {
         sto_.setRegularization(0);
       }
-      solver_statistics_.ts.emplace_back(contact_sequence_->eventTimes());
+      const auto& ts = contact_sequence_->eventTimes();
+      solver_statistics_.ts.emplace_back(ts.begin(), ts.end());
     } 
     updateSolution(t, q, v);
     solver_statistics_.performance_index.push_back(dms_.getEval()+sto_.getEval()); 
     const double kkt_error = KKTError();
     if ((ocp_.sto_cost && ocp_.sto_constraints) && (kkt_error < solver_options_.kkt_tol_mesh)) {
-      if (time_discretization_.maxTimeStep() > solver_options_.max_dt_mesh) {
+      if (solver_options_.enable_adaptive_mesh_refinement) {
+        if (refineMesh(t)) {
+          solver_statistics_.mesh_refinement_iter.push_back(iter+1); 
+        }
+        else if (kkt_error < solver_options_.kkt_tol) {
+          solver_statistics_.convergence = true;
+          solver_statistics_.iter = iter+1;
+          break;
+        }
+      }
+      else if (time_discretization_.maxTimeStep() > solver_options_.max_dt_mesh) {
         if (solver_options_.enable_solution_interpolation) {
           time_discretization_.correctTimeSteps(contact_sequence_, t);
-          solution_interpolator_.store(time_discretization_, s_);
+          solution_interpolator_.storeBySwap(time_discretization_, s_);
         }
         discretize(t);
         if (solver_options_.enable_solution_interpolation) {
           solution_interpolator_.interpolate(robots_[0], time_discretization_, s_);
+          setContactStatus(true);
         }
         dms_.initConstraints(robots_, time_discretization_, s_);
         sto_.initConstraints(time_discretization_);
@@ -216,7 +258,7 @@ void OCPSolver::solve(const double t, const Eigen::VectorXd& q,
     if (solver_options_.discretization_method == DiscretizationMethod::PhaseBased) {
       time_discretization_.correctTimeSteps(contact_sequence_, t);
     }
-    solution_interpolator_.store(time_discretization_, s_);
+    solution_interpolator_.storeBySwap(time_discretization_, s_);
   }
   if (solver_options_.enable_benchmark) {
     timer_.tock();
@@ -334,12 +376,18 @@ const RiccatiFactorization& OCPSolver::getRiccatiFactorization() const {
 
 
 void OCPSolver::setSolution(const Solution& s) {
+  // s_ may hold the solution stored by storeBySwap(), which must be kept for 
+  // the interpolation of the next solve.
+  solution_interpolator_.detachStoredSolution(s_);
   s_ = s;
+  // The contact status of s need not match the current discretization.
+  update_all_contact_status_ = true;
 }
 
 
 void OCPSolver::setSolution(const std::string& name, 
                             const Eigen::VectorXd& value) {
+  solution_interpolator_.detachStoredSolution(s_);
   if (name == "q") {
     if (value.size() != robots_[0].dimq()) {
       throw std::out_of_range(
@@ -420,7 +468,13 @@ double OCPSolver::KKTError(const double t, const Eigen::VectorXd& q,
     throw std::out_of_range("[OCPSolver] invalid argument: v.size() must be " + std::to_string(robots_[0].dimv()) + "!");
   }
   resizeData();
+  if (move_blocking_.enabled()) {
+    move_blocking_.update(time_discretization_);
+  }
   dms_.evalKKT(robots_, time_discretization_, q, v, s_, kkt_matrix_, kkt_residual_);
+  if (move_blocking_.enabled()) {
+    dms_.correctKKTError(time_discretization_, move_blocking_);
+  }
   sto_.evalKKT(time_discretization_, kkt_matrix_, kkt_residual_);
   return KKTError();
 }
@@ -436,6 +490,11 @@ const TimeDiscretization& OCPSolver::getTimeDiscretization() const {
 }
 
 
+const MoveBlocking& OCPSolver::getMoveBlocking() const {
+  return move_blocking_;
+}
+
+
 void OCPSolver::setRobotProperties(const RobotProperties& properties) {
   for (auto& e : robots_) {
     e.setRobotProperties(properties);
@@ -452,13 +511,80 @@ void conservativeReserve(const TimeDiscretization& time_discretization,
 }
 
 
+bool OCPSolver::refineMesh(const double t) {
+  time_discretization_.correctTimeSteps(contact_sequence_, t);
+  if (!mesh_refiner_.refine(time_discretization_, s_, 
+                            solver_options_.max_dt_mesh)) {
+    return false;
+  }
+  solution_interpolator_.storeBySwap(time_discretization_, s_);
+  time_discretization_.remesh(contact_sequence_, t, 
+                              mesh_refiner_.numGridsInPhase());
+  resizeData();
+  solution_interpolator_.interpolate(robots_[0], time_discretization_, s_);
+  setContactStatus(true);
+  dms_.warmStartConstraints(robots_, time_discretization_, s_);
+  sto_.initConstraints(time_discretization_);
+  line_search_.clearHistory();
+  return true;
+}
+
+
+void OCPSolver::rolloutLQRPolicy(const double t, const Eigen::VectorXd& q, 
+                                 const Eigen::VectorXd& v) {
+  // The previous solution is still on the previous time discretization here.
+  // It is corrected in place, i.e., the solution stored by storeBySwap() is 
+  // modified on purpose so that the corrected one is interpolated.
+  // The rollout starts from the last grid not after t.
+  const auto& lqr_policy = riccati_recursion_.getLQRPolicy();
+  const int N = time_discretization_.size() - 1;
+  int i0 = 0;
+  while ((i0 < N) && (time_discretization_[i0+1].t <= t)) {
+    ++i0;
+  }
+  for (int i=i0; i<=N; ++i) {
+    d_[i].setZero();
+  }
+  robots_[0].subtractConfiguration(q, s_[i0].q, d_[i0].dq());
+  d_[i0].dv() = v - s_[i0].v;
+  for (int i=i0; i<N; ++i) {
+    const auto& grid = time_discretization_[i];
+    d_[i+1].dx.noalias() = kkt_matrix_[i].Fxx * d_[i].dx;
+    if (grid.type != GridType::Impact) {
+      // The policy of a blocked grid maps the state deviation at the first 
+      // grid of the block, whose control input deviation is reused instead.
+      if ((i > i0) && move_blocking_.isBlocked(i)) {
+        d_[i].du = d_[i-1].du;
+      }
+      else {
+        d_[i].du.noalias() = lqr_policy[i].K * d_[i].dx;
+      }
+      d_[i+1].dv().noalias() += kkt_matrix_[i].Fvu * d_[i].du;
+    }
+  }
+  for (int i=i0; i<=N; ++i) {
+    const bool impact = (time_discretization_[i].type == GridType::Impact);
+    s_[i].integrate(robots_[0], 1.0, d_[i], impact);
+  }
+}
+
+
 void OCPSolver::resizeData() {
   conservativeReserve(time_discretization_, kkt_matrix_);
   conservativeReserve(time_discretization_, kkt_residual_);
   conservativeReserve(time_discretization_, s_);
   conservativeReserve(time_discretization_, d_);
   conservativeReserve(time_discretization_, riccati_factorization_);
+  setContactStatus(update_all_contact_status_);
+  dms_.resizeData(time_discretization_);
+  riccati_recursion_.resizeData(time_discretization_);
+  line_search_.resizeData(time_discretization_);
+}
+
+
+void OCPSolver::setContactStatus(const bool all_grids) {
   for (int i=0; i<time_discretization_.size(); ++i) {
+    if (!all_grids && !time_discretization_.isStructureChanged(i)) continue;
     const auto& grid = time_discretization_[i];
     if (grid.type == GridType::Intermediate || grid.type == GridType::Lift) {
       s_[i].setContactStatus(contact_sequence_->contactStatus(grid.phase));
@@ -476,9 +602,7 @@ void OCPSolver::resizeData() {
       s_[i].setSwitchingConstraintDimension(0);
     }
   }
-  dms_.resizeData(time_discretization_);
-  riccati_recursion_.resizeData(time_discretization_);
-  line_search_.resizeData(time_discretization_);
+  update_all_contact_status_ = false;
 }
 
 
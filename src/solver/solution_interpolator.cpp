@@ -9,7 +9,9 @@ SolutionInterpolator::SolutionInterpolator(const InterpolationOrder order)
   : order_(order),
     stored_time_discretization_(),
     stored_solution_(),
-    has_stored_solution_(false) {
+    stored_contact_status_(),
+    has_stored_solution_(false),
+    swap_stored_solution_(false) {
 }
 
 
@@ -24,14 +26,72 @@ void SolutionInterpolator::store(const TimeDiscretization& time_discretization,
   stored_time_discretization_ = time_discretization;
   stored_solution_ = solution;
   has_stored_solution_ = true;
+  swap_stored_solution_ = false;
+}
+
+
+void SolutionInterpolator::storeBySwap(
+    const TimeDiscretization& time_discretization, const Solution& solution) {
+  assert(solution.size() >= time_discretization.size());
+  stored_time_discretization_ = time_discretization;
+  // Only the contact status and the switching constraint dimension are 
+  // copied. The elements are allocated only when the size grows.
+  const int size = time_discretization.size();
+  while (stored_contact_status_.size() < size) {
+    stored_contact_status_.push_back(solution[stored_contact_status_.size()]);
+  }
+  for (int i=0; i<size; ++i) {
+    stored_contact_status_[i].setContactStatus(solution[i]);
+    stored_contact_status_[i].setSwitchingConstraintDimension(solution[i].dims());
+  }
+  has_stored_solution_ = true;
+  swap_stored_solution_ = true;
+}
+
+
+void SolutionInterpolator::swapStoredSolution(Solution& solution) {
+  // After the swap, stored_solution_ holds the values of the stored solution.
+  // Its contact status and switching constraint dimension may have been 
+  // updated to the current time discretization in the meantime, and are 
+  // therefore restored from those at storeBySwap().
+  const int size = solution.size();
+  stored_solution_.swap(solution);
+  while (solution.size() < size) {
+    solution.push_back(stored_solution_[solution.size()]);
+  }
+  restoreStoredContactStatus();
+  swap_stored_solution_ = false;
+}
+
+
+void SolutionInterpolator::detachStoredSolution(const Solution& solution) {
+  if (!swap_stored_solution_) return;
+  assert(solution.size() >= stored_time_discretization_.size());
+  stored_solution_ = solution;
+  restoreStoredContactStatus();
+  swap_stored_solution_ = false;
+}
+
+
+void SolutionInterpolator::restoreStoredContactStatus() {
+  for (int i=0; i<stored_time_discretization_.size(); ++i) {
+    stored_solution_[i].setContactStatus(stored_contact_status_[i]);
+    stored_solution_[i].setSwitchingConstraintDimension(
+        stored_contact_status_[i].dims());
+    stored_solution_[i].set_f_stack();
+    stored_solution_[i].set_mu_stack();
+  }
 }
 
 
 void SolutionInterpolator::interpolate(
     const Robot& robot, const TimeDiscretization& time_discretization, 
-    Solution& solution) const {
+    Solution& solution) {
   assert(solution.size() >= time_discretization.size());
   if (!has_stored_solution_) return;
+  if (swap_stored_solution_) {
+    swapStoredSolution(solution);
+  }
 
   const int N = time_discretization.size() - 1;
   for (int i=0; i<=N; ++i) {
@@ -22,11 +22,15 @@ void SolverOptions::disp(std::ostream& os) const {
   os << "  initial_sto_reg: " << initial_sto_reg << "\n";
   os << "  kkt_tol_mesh: " << kkt_tol_mesh << "\n";
   os << "  max_dt_mesh: " << max_dt_mesh << "\n";
+  os << "  enable_adaptive_mesh_refinement: " << std::boolalpha << enable_adaptive_mesh_refinement << "\n";
+  os << "  mesh_refinement_tol: " << mesh_refinement_tol << "\n";
+  os << "  mesh_coarsening_ratio: " << mesh_coarsening_ratio << "\n";
   os << "  mex_dts_riccati: " << max_dts_riccati << "\n";
   os << "  enable_solution_interpolation: " << std::boolalpha << enable_solution_interpolation << "\n";
   os << "  interpolation_order: ";
   if (interpolation_order == InterpolationOrder::Linear) os << "Linear" << "\n";
-  else os << "Zero" << "\n";
+  else if (interpolation_order == InterpolationOrder::Zero) os << "Zero" << "\n";
+  else os << "LQRRollout" << "\n";
   os << "  enable_benchmark: " << std::boolalpha << enable_benchmark << std::flush;
 }
 
@@ -60,7 +60,7 @@ void ParNMPCIntermediateStage::evalOCP(Robot& robot, const GridInfo& grid_info,
                                        SplitKKTResidual& kkt_residual) const {
   assert(q_prev.size() == robot.dimq());
   assert(v_prev.size() == robot.dimv());
-  robot.updateKinematics(s.q);
+  robot.updateFrameKinematics(s.q);
   data.performance_index.setZero();
   kkt_residual.setZero();
   data.performance_index.cost = cost_->evalStageCost(robot, contact_status_, 
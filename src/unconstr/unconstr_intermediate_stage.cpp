@@ -53,7 +53,7 @@ void UnconstrIntermediateStage::evalOCP(Robot& robot, const GridInfo& grid_info,
                                         const SplitSolution& s_next, 
                                         UnconstrOCPData& data, 
                                         SplitKKTResidual& kkt_residual) const {
-  robot.updateKinematics(s.q);
+  robot.updateFrameKinematics(s.q);
   data.performance_index.setZero();
   kkt_residual.setZero();
   data.performance_index.cost = cost_->evalStageCost(robot, contact_status_, 
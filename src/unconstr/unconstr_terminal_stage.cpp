@@ -52,7 +52,7 @@ void UnconstrTerminalStage::evalOCP(Robot& robot, const GridInfo& grid_info,
                                     const SplitSolution& s, 
                                     UnconstrOCPData& data, 
                                     SplitKKTResidual& kkt_residual) const {
-  robot.updateKinematics(s.q);
+  robot.updateFrameKinematics(s.q);
   data.performance_index.setZero();
   kkt_residual.setZero();
   data.performance_index.cost = cost_->evalTerminalCost(robot, data.cost_data, 
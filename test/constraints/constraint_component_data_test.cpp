@@ -1,3 +1,5 @@
+#include <utility>
+
 #include <gtest/gtest.h>
 
 #include "robotoc/constraints/constraint_component_data.hpp"
@@ -46,6 +48,128 @@ TEST_F(ConstraintComponentDataTest, err) {
   EXPECT_DOUBLE_EQ(vio, vio_ref);
 }
 
+
+TEST_F(ConstraintComponentDataTest, extraData) {
+  const int dimc = 5;
+  const double barrier_param = 0.01;
+  ConstraintComponentData data(dimc, barrier_param);
+  EXPECT_EQ(data.extraDataSize(), 0);
+  const int v0 = data.allocateExtraVector(3);
+  const int m0 = data.allocateExtraMatrix(5, 4);
+  const int v1 = data.allocateExtraVector(6);
+  const int m1 = data.allocateExtraMatrix(2, 3);
+  EXPECT_EQ(v0, 0);
+  EXPECT_EQ(v1, 1);
+  EXPECT_EQ(m0, 0);
+  EXPECT_EQ(m1, 1);
+  EXPECT_EQ(data.extraDataSize(), 3+5*4+6+2*3);
+  EXPECT_EQ(data.extraVector(v0).size(), 3);
+  EXPECT_EQ(data.extraVector(v1).size(), 6);
+  EXPECT_EQ(data.extraMatrix(m0).rows(), 5);
+  EXPECT_EQ(data.extraMatrix(m0).cols(), 4);
+  EXPECT_EQ(data.extraMatrix(m1).rows(), 2);
+  EXPECT_EQ(data.extraMatrix(m1).cols(), 3);
+  EXPECT_TRUE(data.extraVector(v0).isZero());
+  EXPECT_TRUE(data.extraMatrix(m0).isZero());
+  const Eigen::VectorXd v0_ref = Eigen::VectorXd::Random(3);
+  const Eigen::VectorXd v1_ref = Eigen::VectorXd::Random(6);
+  const Eigen::MatrixXd m0_ref = Eigen::MatrixXd::Random(5, 4);
+  const Eigen::MatrixXd m1_ref = Eigen::MatrixXd::Random(2, 3);
+  data.extraVector(v0) = v0_ref;
+  data.extraVector(v1) = v1_ref;
+  data.extraMatrix(m0) = m0_ref;
+  data.extraMatrix(m1) = m1_ref;
+  EXPECT_TRUE(data.extraVector(v0).isApprox(v0_ref));
+  EXPECT_TRUE(data.extraVector(v1).isApprox(v1_ref));
+  EXPECT_TRUE(data.extraMatrix(m0).isApprox(m0_ref));
+  EXPECT_TRUE(data.extraMatrix(m1).isApprox(m1_ref));
+  // The copy owns its own storage. 
+  ConstraintComponentData data_copy = data;
+  data.extraVector(v0).setZero();
+  data.extraMatrix(m1).setZero();
+  EXPECT_TRUE(data_copy.extraVector(v0).isApprox(v0_ref));
+  EXPECT_TRUE(data_copy.extraMatrix(m1).isApprox(m1_ref));
+  const ConstraintComponentData& data_const = data_copy;
+  EXPECT_TRUE(data_const.extraMatrix(m0).isApprox(m0_ref));
+  data.clearExtraData();
+  EXPECT_EQ(data.extraDataSize(), 0);
+}
+
+
+TEST_F(ConstraintComponentDataTest, copyAndMove) {
+  const int dimc = 5;
+  const double barrier_param = 0.01;
+  ConstraintComponentData data(dimc, barrier_param);
+  data.slack.setRandom();
+  data.dual.setRandom();
+  data.residual.setRandom();
+  data.cmpl.setRandom();
+  data.dslack.setRandom();
+  data.ddual.setRandom();
+  data.cond.setRandom();
+  data.log_barrier = 1.0;
+  // The copy owns its own storage.
+  ConstraintComponentData data_copy = data;
+  EXPECT_TRUE(data_copy.isApprox(data));
+  EXPECT_NE(data_copy.slack.data(), data.slack.data());
+  data_copy.slack.setZero();
+  EXPECT_FALSE(data.slack.isZero());
+  data_copy = data;
+  EXPECT_TRUE(data_copy.isApprox(data));
+  // The move keeps the storage.
+  const double* slack_ptr = data.slack.data();
+  ConstraintComponentData data_moved = std::move(data);
+  EXPECT_EQ(data_moved.slack.data(), slack_ptr);
+  EXPECT_TRUE(data_moved.isApprox(data_copy));
+  ConstraintComponentData data_move_assigned;
+  data_move_assigned = std::move(data_moved);
+  EXPECT_EQ(data_move_assigned.slack.data(), slack_ptr);
+  EXPECT_TRUE(data_move_assigned.isApprox(data_copy));
+  EXPECT_TRUE(data_move_assigned.checkDimensionalConsistency());
+}
+
+
+TEST_F(ConstraintComponentDataTest, bindToBuffer) {
+  const int dimc = 5;
+  const int stride = 8;
+  const double barrier_param = 0.01;
+  ConstraintComponentData data(dimc, barrier_param);
+  data.slack.setRandom();
+  data.dual.setRandom();
+  data.residual.setRandom();
+  data.cmpl.setRandom();
+  data.dslack.setRandom();
+  data.ddual.setRandom();
+  data.cond.setRandom();
+  const ConstraintComponentData data_ref = data;
+  EXPECT_FALSE(data.isBoundToBuffer());
+  Eigen::VectorXd buffer = Eigen::VectorXd::Zero(
+      ConstraintComponentData::numBufferVectors()*stride);
+  data.bindToBuffer(buffer.data()+1, stride);
+  EXPECT_TRUE(data.isBoundToBuffer());
+  EXPECT_TRUE(data.isApprox(data_ref));
+  EXPECT_TRUE(buffer.segment(1, dimc).isApprox(data_ref.slack));
+  EXPECT_TRUE(buffer.segment(1+stride, dimc).isApprox(data_ref.dual));
+  EXPECT_TRUE(buffer.segment(1+2*stride, dimc).isApprox(data_ref.residual));
+  EXPECT_TRUE(buffer.segment(1+3*stride, dimc).isApprox(data_ref.cmpl));
+  EXPECT_TRUE(buffer.segment(1+4*stride, dimc).isApprox(data_ref.dslack));
+  EXPECT_TRUE(buffer.segment(1+5*stride, dimc).isApprox(data_ref.ddual));
+  EXPECT_TRUE(buffer.segment(1+6*stride, dimc).isApprox(data_ref.cond));
+  buffer.segment(1, dimc).setZero();
+  EXPECT_TRUE(data.slack.isZero());
+  // Assigning the same dimension keeps the binding.
+  data = data_ref;
+  EXPECT_TRUE(data.isBoundToBuffer());
+  EXPECT_TRUE(buffer.segment(1, dimc).isApprox(data_ref.slack));
+  // Resizing releases the binding and keeps the slack and dual.
+  data.resize(dimc+2);
+  EXPECT_FALSE(data.isBoundToBuffer());
+  EXPECT_EQ(data.dimc(), dimc+2);
+  EXPECT_TRUE(data.checkDimensionalConsistency());
+  EXPECT_TRUE(data.slack.head(dimc).isApprox(data_ref.slack));
+  EXPECT_TRUE(data.dual.head(dimc).isApprox(data_ref.dual));
+}
+
 } // namespace robotoc
 
 
@@ -1,6 +1,13 @@
+#include <vector>
+#include <algorithm>
+#include <utility>
+
 #include <gtest/gtest.h>
+#include "Eigen/Core"
 
 #include "robotoc/constraints/constraints_data.hpp"
+#include "robotoc/constraints/constraint_component_data.hpp"
+#include "robotoc/constraints/pdipm.hpp"
 
 namespace robotoc {
 
@@ -83,6 +90,134 @@ TEST_F(ConstraintsDataTest, timestepminus1) {
   EXPECT_TRUE(data.impact_level_data.empty());
 }
 
+
+ConstraintsData CreateConstraintsData(const int time_stage) {
+  const double barrier_param = 0.001;
+  ConstraintsData data(time_stage);
+  data.position_level_data.push_back(ConstraintComponentData(3, barrier_param));
+  data.position_level_data.push_back(ConstraintComponentData(2, barrier_param));
+  data.velocity_level_data.push_back(ConstraintComponentData(4, barrier_param));
+  data.acceleration_level_data.push_back(ConstraintComponentData(5, barrier_param));
+  data.acceleration_level_data.push_back(ConstraintComponentData(1, barrier_param));
+  data.acceleration_level_data.push_back(ConstraintComponentData(6, barrier_param));
+  data.impact_level_data.push_back(ConstraintComponentData(7, barrier_param));
+  for (auto components : {&data.position_level_data, &data.velocity_level_data,
+                          &data.acceleration_level_data, &data.impact_level_data}) {
+    for (auto& e : *components) {
+      e.slack = Eigen::VectorXd::Random(e.dimc()).array().abs();
+      e.dual = Eigen::VectorXd::Random(e.dimc()).array().abs();
+      e.residual.setRandom();
+      e.cmpl.setRandom();
+      e.dslack.setRandom();
+      e.ddual.setRandom();
+    }
+  }
+  return data;
+}
+
+
+std::vector<const ConstraintComponentData*> ValidComponents(
+    const ConstraintsData& data) {
+  std::vector<const ConstraintComponentData*> components;
+  if (data.isPositionLevelValid()) {
+    for (const auto& e : data.position_level_data) components.push_back(&e);
+  }
+  if (data.isVelocityLevelValid()) {
+    for (const auto& e : data.velocity_level_data) components.push_back(&e);
+  }
+  if (data.isAccelerationLevelValid()) {
+    for (const auto& e : data.acceleration_level_data) components.push_back(&e);
+  }
+  if (data.isImpactLevelValid()) {
+    for (const auto& e : data.impact_level_data) components.push_back(&e);
+  }
+  return components;
+}
+
+
+TEST_F(ConstraintsDataTest, bindComponentsToBuffer) {
+  for (const int time_stage : {-1, 0, 1, 2}) {
+    auto data = CreateConstraintsData(time_stage);
+    EXPECT_FALSE(data.isBoundToBuffer());
+    const ConstraintsData data_ref = data;
+    const double kkt_error_ref = data_ref.KKTError();
+    data.bindComponentsToBuffer();
+    EXPECT_TRUE(data.isBoundToBuffer());
+    EXPECT_DOUBLE_EQ(data.KKTError(), kkt_error_ref);
+    // The valid components are consecutive in the buffer.
+    const auto components = ValidComponents(data);
+    int offset = 0;
+    for (const auto e : components) {
+      EXPECT_TRUE(e->isBoundToBuffer());
+      EXPECT_EQ(e->slack.data(), data.slack().data()+offset);
+      EXPECT_EQ(e->dual.data(), data.dual().data()+offset);
+      EXPECT_TRUE(data.dslack().segment(offset, e->dimc()).isApprox(e->dslack));
+      EXPECT_TRUE(data.ddual().segment(offset, e->dimc()).isApprox(e->ddual));
+      EXPECT_TRUE(data.residual().segment(offset, e->dimc()).isApprox(e->residual));
+      EXPECT_TRUE(data.cmpl().segment(offset, e->dimc()).isApprox(e->cmpl));
+      offset += e->dimc();
+    }
+    EXPECT_EQ(data.slack().size(), offset);
+    // The stage-wide kernels give the per-component results.
+    const double fraction_rate = 0.995;
+    double step_slack_ref = 1.0, step_dual_ref = 1.0;
+    for (const auto e : components) {
+      step_slack_ref = std::min(step_slack_ref, 
+                                pdipm::fractionToBoundarySlack(fraction_rate, *e));
+      step_dual_ref = std::min(step_dual_ref, 
+                               pdipm::fractionToBoundaryDual(fraction_rate, *e));
+    }
+    EXPECT_DOUBLE_EQ(pdipm::fractionToBoundary(fraction_rate, data.slack(), 
+                                               data.dslack()), step_slack_ref);
+    EXPECT_DOUBLE_EQ(pdipm::fractionToBoundary(fraction_rate, data.dual(), 
+                                               data.ddual()), step_dual_ref);
+    data.slack().noalias() += step_slack_ref * data.dslack();
+    const auto components_ref = ValidComponents(data_ref);
+    for (int i=0; i<components.size(); ++i) {
+      const Eigen::VectorXd slack_ref 
+          = components_ref[i]->slack + step_slack_ref * components_ref[i]->dslack;
+      EXPECT_TRUE(components[i]->slack.isApprox(slack_ref));
+    }
+  }
+}
+
+
+TEST_F(ConstraintsDataTest, copyBoundData) {
+  auto data = CreateConstraintsData(2);
+  data.bindComponentsToBuffer();
+  // The copy is bound to its own buffer.
+  ConstraintsData data_copy = data;
+  EXPECT_TRUE(data_copy.isBoundToBuffer());
+  EXPECT_NE(data_copy.slack().data(), data.slack().data());
+  EXPECT_TRUE(data_copy.slack().isApprox(data.slack()));
+  EXPECT_EQ(data_copy.position_level_data[0].slack.data(), data_copy.slack().data());
+  // Assigning the same dimensions keeps the buffer.
+  const double* slack_ptr = data_copy.slack().data();
+  data.dual().setConstant(1.0);
+  data_copy = data;
+  EXPECT_TRUE(data_copy.isBoundToBuffer());
+  EXPECT_EQ(data_copy.slack().data(), slack_ptr);
+  EXPECT_TRUE(data_copy.dual().isApprox(data.dual()));
+  EXPECT_TRUE(data_copy.acceleration_level_data[2].dual.isOnes());
+  // Assigning different dimensions rebinds to a new buffer.
+  auto data_other = CreateConstraintsData(1);
+  data_other.acceleration_level_data.pop_back();
+  data_other.bindComponentsToBuffer();
+  data_copy = data_other;
+  EXPECT_TRUE(data_copy.isBoundToBuffer());
+  EXPECT_TRUE(data_copy.isVelocityLevelValid());
+  EXPECT_FALSE(data_copy.isPositionLevelValid());
+  EXPECT_EQ(data_copy.acceleration_level_data.size(), 2);
+  EXPECT_TRUE(data_copy.slack().isApprox(data_other.slack()));
+  EXPECT_EQ(data_copy.velocity_level_data[0].slack.data(), data_copy.slack().data());
+  // The move keeps the buffer.
+  slack_ptr = data_copy.slack().data();
+  ConstraintsData data_moved = std::move(data_copy);
+  EXPECT_TRUE(data_moved.isBoundToBuffer());
+  EXPECT_EQ(data_moved.slack().data(), slack_ptr);
+  EXPECT_EQ(data_moved.velocity_level_data[0].slack.data(), slack_ptr);
+}
+
 } // namespace robotoc
 
 
@@ -1,4 +1,6 @@
 #include <memory>
+#include <vector>
+#include <algorithm>
 
 #include <gtest/gtest.h>
 #include "Eigen/Core"
@@ -45,6 +47,8 @@ protected:
   void timeStage0(Robot& robot, const ContactStatus& contact_status) const;
   void timeStage1(Robot& robot, const ContactStatus& contact_status) const;
   void timeStage2(Robot& robot, const ContactStatus& contact_status) const;
+  void checkStepSizeAndUpdate(const Constraints& constraints, 
+                              ConstraintsData& data) const;
 
   double barrier_param, mu;
 };
@@ -115,6 +119,8 @@ void ConstraintsTest::timeStage0(Robot& robot,
     EXPECT_FALSE(kkt_residual.lf().isZero());
     EXPECT_FALSE(kkt_matrix.Qff().isZero());
   }
+  constraints->expandSlackAndDual(contact_status, data, d);
+  checkStepSizeAndUpdate(*constraints, data);
   EXPECT_NO_THROW(
     std::cout << constraints << std::endl;
   );
@@ -160,6 +166,8 @@ void ConstraintsTest::timeStage1(Robot& robot,
     EXPECT_FALSE(kkt_residual.lf().isZero());
     EXPECT_FALSE(kkt_matrix.Qff().isZero());
   }
+  constraints->expandSlackAndDual(contact_status, data, d);
+  checkStepSizeAndUpdate(*constraints, data);
   EXPECT_NO_THROW(
     std::cout << constraints << std::endl;
   );
@@ -205,6 +213,8 @@ void ConstraintsTest::timeStage2(Robot& robot,
     EXPECT_FALSE(kkt_residual.lf().isZero());
     EXPECT_FALSE(kkt_matrix.Qff().isZero());
   }
+  constraints->expandSlackAndDual(contact_status, data, d);
+  checkStepSizeAndUpdate(*constraints, data);
   EXPECT_NO_THROW(
     std::cout << constraints << std::endl;
     std::cout << *constraints.get() << std::endl;
@@ -212,6 +222,45 @@ void ConstraintsTest::timeStage2(Robot& robot,
 }
 
 
+void ConstraintsTest::checkStepSizeAndUpdate(const Constraints& constraints, 
+                                             ConstraintsData& data) const {
+  EXPECT_TRUE(data.isBoundToBuffer());
+  std::vector<ConstraintComponentData*> components;
+  if (data.isPositionLevelValid()) {
+    for (auto& e : data.position_level_data) components.push_back(&e);
+  }
+  if (data.isVelocityLevelValid()) {
+    for (auto& e : data.velocity_level_data) components.push_back(&e);
+  }
+  if (data.isAccelerationLevelValid()) {
+    for (auto& e : data.acceleration_level_data) components.push_back(&e);
+  }
+  const double fraction_rate = constraints.getFractionToBoundaryRule();
+  double step_slack_ref = 1.0, step_dual_ref = 1.0, kkt_error_ref = 0.0;
+  for (const auto e : components) {
+    step_slack_ref = std::min(step_slack_ref, 
+                              pdipm::fractionToBoundarySlack(fraction_rate, *e));
+    step_dual_ref = std::min(step_dual_ref, 
+                             pdipm::fractionToBoundaryDual(fraction_rate, *e));
+    kkt_error_ref += e->KKTError();
+  }
+  EXPECT_DOUBLE_EQ(constraints.maxSlackStepSize(data), step_slack_ref);
+  EXPECT_DOUBLE_EQ(constraints.maxDualStepSize(data), step_dual_ref);
+  EXPECT_DOUBLE_EQ(data.KKTError(), kkt_error_ref);
+  std::vector<Eigen::VectorXd> slack_ref, dual_ref;
+  for (const auto e : components) {
+    slack_ref.push_back(e->slack + step_slack_ref * e->dslack);
+    dual_ref.push_back(e->dual + step_dual_ref * e->ddual);
+  }
+  constraints.updateSlack(data, step_slack_ref);
+  constraints.updateDual(data, step_dual_ref);
+  for (int i=0; i<components.size(); ++i) {
+    EXPECT_TRUE(components[i]->slack.isApprox(slack_ref[i]));
+    EXPECT_TRUE(components[i]->dual.isApprox(dual_ref[i]));
+  }
+}
+
+
 TEST_F(ConstraintsTest, fixedBase) {
   auto robot = testhelper::CreateRobotManipulator(0.001);
   auto contact_status = robot.createContactStatus();
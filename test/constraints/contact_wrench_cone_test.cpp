@@ -247,10 +247,10 @@ void ContactWrenchConeTest::test_condenseSlackAndDual(Robot& robot,
         break;
       case ContactType::SurfaceContact:
         if (contact_status.isContactActive(i)) {
-          data_ref.r[0].array() = data_ref.dual.segment(c_begin, 17).array() 
+          data_ref.extraVector(0).array() = data_ref.dual.segment(c_begin, 17).array() 
                                     / data_ref.slack.segment(c_begin, 17).array();
           kkt_mat_ref.Qff().block(dimf_stack, dimf_stack, 6, 6).noalias()
-              += cone.transpose() * data_ref.r[0].asDiagonal() * cone;
+              += cone.transpose() * data_ref.extraVector(0).asDiagonal() * cone;
           pdipm::computeCondensingCoeffcient(data_ref, c_begin, 17);
           kkt_res_ref.lf().segment(dimf_stack, 6).noalias()
               += cone.transpose() * data_ref.cond.segment(c_begin, 17);
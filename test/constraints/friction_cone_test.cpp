@@ -379,6 +379,53 @@ TEST_F(FrictionConeTest, floatingBase) {
 }
 
 
+TEST_F(FrictionConeTest, screening) {
+  auto robot = testhelper::CreateQuadrupedalRobot(dt);
+  auto contact_status = robot.createContactStatus();
+  for (int i=0; i<contact_status.maxNumContacts(); ++i) {
+    contact_status.activateContact(i);
+    contact_status.setContactPlacement(i, Eigen::Vector3d::Random(), contact_surface);
+  }
+  FrictionCone constr(robot), constr_ref(robot); 
+  EXPECT_DOUBLE_EQ(constr.getScreeningRatio(), 0.0);
+  EXPECT_THROW(constr.setScreeningRatio(-1.0), std::out_of_range);
+  constr.setScreeningRatio(10.0);
+  EXPECT_DOUBLE_EQ(constr.getScreeningRatio(), 10.0);
+  ConstraintComponentData data(constr.dimc(), constr.getBarrierParam());
+  constr.allocateExtraData(data);
+  const auto s = SplitSolution::Random(robot, contact_status);
+  robot.updateKinematics(s.q);
+  constr.setSlack(robot, contact_status, data, s);
+  // Far from active: large slacks and small duals.
+  data.slack = 1.0 + data.slack.array().abs();
+  data.dual = constr.getBarrierParam() / data.slack.array();
+  auto kkt_mat = SplitKKTMatrix::Random(robot, contact_status);
+  auto kkt_res = SplitKKTResidual::Random(robot, contact_status);
+  constr.evalConstraint(robot, contact_status, data, s);
+  constr.evalDerivatives(robot, contact_status, data, s, kkt_res);
+  auto data_ref = data;
+  auto kkt_mat_ref = kkt_mat;
+  auto kkt_res_ref = kkt_res;
+  constr.condenseSlackAndDual(contact_status, data, kkt_mat, kkt_res);
+  constr_ref.condenseSlackAndDual(contact_status, data_ref, kkt_mat_ref, kkt_res_ref);
+  // The gradients are exact.
+  EXPECT_TRUE(kkt_res.isApprox(kkt_res_ref));
+  EXPECT_TRUE(kkt_mat.Qff().isApprox(kkt_mat_ref.Qff()));
+  // The Hessians with respect to q of the far-from-active blocks are skipped.
+  EXPECT_FALSE(kkt_mat.Qqq().isApprox(kkt_mat_ref.Qqq()));
+  // Near the boundary, the exact treatment is used.
+  data.slack.fill(constr.getBarrierParam());
+  data.dual.fill(1.0);
+  data_ref = data;
+  kkt_mat_ref = kkt_mat;
+  kkt_res_ref = kkt_res;
+  constr.condenseSlackAndDual(contact_status, data, kkt_mat, kkt_res);
+  constr_ref.condenseSlackAndDual(contact_status, data_ref, kkt_mat_ref, kkt_res_ref);
+  EXPECT_TRUE(kkt_res.isApprox(kkt_res_ref));
+  EXPECT_TRUE(kkt_mat.isApprox(kkt_mat_ref));
+}
+
+
 TEST_F(FrictionConeTest, humanoidRobot) {
   auto robot = testhelper::CreateHumanoidRobot(dt);
   auto contact_status = robot.createContactStatus();
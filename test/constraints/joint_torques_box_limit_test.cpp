@@ -0,0 +1,115 @@
+#include <memory>
+
+#include <gtest/gtest.h>
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/core/split_solution.hpp"
+#include "robotoc/core/split_direction.hpp"
+#include "robotoc/core/split_kkt_matrix.hpp"
+#include "robotoc/core/split_kkt_residual.hpp"
+#include "robotoc/constraints/joint_torques_box_limit.hpp"
+#include "robotoc/constraints/joint_torques_lower_limit.hpp"
+#include "robotoc/constraints/joint_torques_upper_limit.hpp"
+#include "robotoc/constraints/pdipm.hpp"
+
+#include "robot_factory.hpp"
+
+namespace robotoc {
+
+class JointTorquesBoxLimitTest : public ::testing::Test {
+protected:
+  virtual void SetUp() {
+    srand((unsigned int) time(0));
+    barrier_param = 1.0e-03;
+    dt = std::abs(Eigen::VectorXd::Random(1)[0]);
+  }
+
+  virtual void TearDown() {
+  }
+
+  void test(Robot& robot) const;
+
+  double barrier_param, dt;
+};
+
+
+// Compares with the pair of JointTorquesLowerLimit and JointTorquesUpperLimit.
+void JointTorquesBoxLimitTest::test(Robot& robot) const {
+  JointTorquesBoxLimit constr(robot); 
+  JointTorquesLowerLimit constr_lower(robot); 
+  JointTorquesUpperLimit constr_upper(robot); 
+  EXPECT_TRUE(constr.kinematicsLevel() == constr_lower.kinematicsLevel());
+  EXPECT_EQ(constr.dimc(), constr_lower.dimc()+constr_upper.dimc());
+  const int dim = constr_lower.dimc();
+  const auto contact_status = robot.createContactStatus();
+  ConstraintComponentData data(constr.dimc(), barrier_param),
+                          data_lower(dim, barrier_param),
+                          data_upper(dim, barrier_param);
+  const auto s = SplitSolution::Random(robot);
+  EXPECT_EQ(constr.isFeasible(robot, contact_status, data, s),
+            (constr_lower.isFeasible(robot, contact_status, data_lower, s)
+              && constr_upper.isFeasible(robot, contact_status, data_upper, s)));
+  constr.setSlack(robot, contact_status, data, s);
+  constr_lower.setSlack(robot, contact_status, data_lower, s);
+  constr_upper.setSlack(robot, contact_status, data_upper, s);
+  EXPECT_TRUE(data.slack.head(dim).isApprox(data_lower.slack));
+  EXPECT_TRUE(data.slack.tail(dim).isApprox(data_upper.slack));
+  data.slack.setRandom();
+  data.dual.setRandom();
+  data.slack = data.slack.array().abs();
+  data.dual = data.dual.array().abs();
+  data_lower.slack = data.slack.head(dim);
+  data_lower.dual = data.dual.head(dim);
+  data_upper.slack = data.slack.tail(dim);
+  data_upper.dual = data.dual.tail(dim);
+  constr.evalConstraint(robot, contact_status, data, s);
+  constr_lower.evalConstraint(robot, contact_status, data_lower, s);
+  constr_upper.evalConstraint(robot, contact_status, data_upper, s);
+  EXPECT_TRUE(data.residual.head(dim).isApprox(data_lower.residual));
+  EXPECT_TRUE(data.residual.tail(dim).isApprox(data_upper.residual));
+  EXPECT_TRUE(data.cmpl.head(dim).isApprox(data_lower.cmpl));
+  EXPECT_TRUE(data.cmpl.tail(dim).isApprox(data_upper.cmpl));
+  EXPECT_NEAR(data.log_barrier, data_lower.log_barrier+data_upper.log_barrier, 1.0e-12);
+  auto kkt_mat = SplitKKTMatrix::Random(robot);
+  auto kkt_res = SplitKKTResidual::Random(robot);
+  auto kkt_mat_ref = kkt_mat;
+  auto kkt_res_ref = kkt_res;
+  constr.evalDerivatives(robot, contact_status, data, s, kkt_res);
+  constr_lower.evalDerivatives(robot, contact_status, data_lower, s, kkt_res_ref);
+  constr_upper.evalDerivatives(robot, contact_status, data_upper, s, kkt_res_ref);
+  EXPECT_TRUE(kkt_res.isApprox(kkt_res_ref));
+  constr.condenseSlackAndDual(contact_status, data, kkt_mat, kkt_res);
+  constr_lower.condenseSlackAndDual(contact_status, data_lower, kkt_mat_ref, kkt_res_ref);
+  constr_upper.condenseSlackAndDual(contact_status, data_upper, kkt_mat_ref, kkt_res_ref);
+  EXPECT_TRUE(kkt_res.isApprox(kkt_res_ref));
+  EXPECT_TRUE(kkt_mat.isApprox(kkt_mat_ref));
+  const auto d = SplitDirection::Random(robot);
+  constr.expandSlackAndDual(contact_status, data, d);
+  constr_lower.expandSlackAndDual(contact_status, data_lower, d);
+  constr_upper.expandSlackAndDual(contact_status, data_upper, d);
+  EXPECT_TRUE(data.dslack.head(dim).isApprox(data_lower.dslack));
+  EXPECT_TRUE(data.dslack.tail(dim).isApprox(data_upper.dslack));
+  EXPECT_TRUE(data.ddual.head(dim).isApprox(data_lower.ddual));
+  EXPECT_TRUE(data.ddual.tail(dim).isApprox(data_upper.ddual));
+}
+
+
+TEST_F(JointTorquesBoxLimitTest, fixedBase) {
+  auto robot = testhelper::CreateRobotManipulator(dt);
+  test(robot);
+}
+
+
+TEST_F(JointTorquesBoxLimitTest, floatingBase) {
+  auto robot = testhelper::CreateQuadrupedalRobot(dt);
+  test(robot);
+}
+
+} // namespace robotoc
+
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
\ No newline at end of file
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include <gtest/gtest.h>
 #include "Eigen/Core"
 
@@ -60,6 +62,35 @@ TEST_F(PDIPMTest, fractionToBoundary) {
 }
 
 
+TEST_F(PDIPMTest, fractionToBoundaryVectorized) {
+  Eigen::VectorXd vec = Eigen::VectorXd::Random(dim).array().abs();
+  Eigen::VectorXd dvec = Eigen::VectorXd::Random(dim);
+  dvec.head(dim/10).setZero();
+  vec.segment(dim/10, dim/10).setZero();
+  const double fraction_rate = 0.995;
+  double step_size_ref = 1.0;
+  for (int i=0; i<dim; ++i) {
+    step_size_ref = std::min(step_size_ref, 
+                             pdipm::fractionToBoundary(fraction_rate, vec(i), dvec(i)));
+  }
+  EXPECT_DOUBLE_EQ(pdipm::fractionToBoundary(fraction_rate, vec, dvec), 
+                   step_size_ref);
+  EXPECT_DOUBLE_EQ(pdipm::fractionToBoundary(dim, fraction_rate, vec, dvec), 
+                   step_size_ref);
+  // Segments of a larger vector give the minimum of the segments.
+  const int dim_head = dim / 3;
+  const double step_size_head = pdipm::fractionToBoundary(
+      fraction_rate, vec.head(dim_head), dvec.head(dim_head));
+  const double step_size_tail = pdipm::fractionToBoundary(
+      fraction_rate, vec.tail(dim-dim_head), dvec.tail(dim-dim_head));
+  EXPECT_DOUBLE_EQ(std::min(step_size_head, step_size_tail), step_size_ref);
+  EXPECT_DOUBLE_EQ(pdipm::fractionToBoundary(fraction_rate, vec.head(0), 
+                                             dvec.head(0)), 1.0);
+  EXPECT_DOUBLE_EQ(pdipm::fractionToBoundary(fraction_rate, vec, 
+                                             Eigen::VectorXd::Ones(dim)), 1.0);
+}
+
+
 TEST_F(PDIPMTest, fractionToBoundarySlack) {
   EXPECT_TRUE(data.slack.minCoeff() >= 0);
   const double fraction_rate = 0.995;
@@ -0,0 +1,221 @@
+#include <memory>
+
+#include <gtest/gtest.h>
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/planner/contact_sequence.hpp"
+#include "robotoc/ocp/grid_info.hpp"
+#include "robotoc/ocp/time_discretization.hpp"
+#include "robotoc/cost/grid_ref_cache.hpp"
+#include "robotoc/cost/periodic_swing_foot_ref.hpp"
+#include "robotoc/cost/periodic_com_ref.hpp"
+#include "robotoc/cost/cached_task_space_3d_ref.hpp"
+#include "robotoc/cost/cached_com_ref.hpp"
+
+#include "robot_factory.hpp"
+
+namespace robotoc {
+
+class GridRefCacheTest : public ::testing::Test {
+protected:
+  virtual void SetUp() {
+    srand((unsigned int) time(0));
+    T = 1.0;
+    N = 20;
+    t = std::abs(Eigen::VectorXd::Random(1)[0]);
+    dt = T / N;
+  }
+
+  virtual void TearDown() {
+  }
+
+  TimeDiscretization createTimeDiscretization() const;
+
+  double T, t, dt;
+  int N;
+};
+
+
+TimeDiscretization GridRefCacheTest::createTimeDiscretization() const {
+  auto robot = testhelper::CreateQuadrupedalRobot(dt);
+  auto contact_sequence = std::make_shared<ContactSequence>(robot);
+  auto contact_status = robot.createContactStatus();
+  contact_status.activateContacts(std::vector<int>({0, 1, 2, 3}));
+  contact_sequence->init(contact_status);
+  TimeDiscretization time_discretization(T, N);
+  time_discretization.discretize(contact_sequence, t);
+  return time_discretization;
+}
+
+
+TEST_F(GridRefCacheTest, cache) {
+  const int dim = 5;
+  const int num_grids = 10;
+  GridRefCache cache(dim);
+  cache.reset(num_grids);
+  EXPECT_EQ(cache.size(), num_grids);
+  std::vector<GridInfo> grids(num_grids);
+  for (int i=0; i<num_grids; ++i) {
+    grids[i].setRandom();
+    grids[i].stage = i;
+    EXPECT_FALSE(cache.isCached(grids[i]));
+  }
+  std::vector<Eigen::VectorXd> refs(num_grids);
+  for (int i=0; i<num_grids; ++i) {
+    refs[i] = Eigen::VectorXd::Random(dim);
+    cache.cache(grids[i], (i%2==0));
+    cache.ref(i) = refs[i];
+  }
+  for (int i=0; i<num_grids; ++i) {
+    EXPECT_TRUE(cache.isCached(grids[i]));
+    EXPECT_EQ(cache.isActive(i), (i%2==0));
+    EXPECT_TRUE(cache.ref(i).isApprox(refs[i]));
+  }
+  auto grid = grids[0];
+  grid.t += dt;
+  EXPECT_FALSE(cache.isCached(grid));
+  grid = grids[0];
+  grid.dt += dt;
+  EXPECT_FALSE(cache.isCached(grid));
+  grid = grids[0];
+  grid.stage_in_phase += 1;
+  EXPECT_FALSE(cache.isCached(grid));
+  grid = grids[0];
+  grid.num_grids_in_phase += 1;
+  EXPECT_FALSE(cache.isCached(grid));
+  grid = grids[0];
+  grid.stage = num_grids;
+  EXPECT_FALSE(cache.isCached(grid));
+  EXPECT_THROW(cache.cache(grid, true), std::out_of_range);
+  cache.clear();
+  for (int i=0; i<num_grids; ++i) {
+    EXPECT_FALSE(cache.isCached(grids[i]));
+  }
+  EXPECT_THROW(GridRefCache(-1), std::out_of_range);
+  EXPECT_THROW(cache.reset(-1), std::out_of_range);
+}
+
+
+TEST_F(GridRefCacheTest, moveEventTime) {
+  auto robot = testhelper::CreateQuadrupedalRobot(dt);
+  auto contact_sequence = std::make_shared<ContactSequence>(robot);
+  auto contact_status = robot.createContactStatus();
+  contact_status.activateContacts(std::vector<int>({0, 1, 2, 3}));
+  contact_sequence->init(contact_status);
+  contact_status.deactivateContacts(std::vector<int>({0, 3}));
+  contact_sequence->push_back(contact_status, t+0.35*T);
+  contact_status.activateContacts(std::vector<int>({0, 3}));
+  contact_sequence->push_back(contact_status, t+0.65*T);
+  TimeDiscretization time_discretization(T, N, 2);
+  time_discretization.discretize(contact_sequence, t);
+  const int dim = 3;
+  GridRefCache cache(dim);
+  cache.reset(time_discretization.size());
+  for (int i=0; i<time_discretization.size(); ++i) {
+    cache.cache(time_discretization[i], true);
+  }
+  std::vector<GridInfo> grids;
+  for (int i=0; i<time_discretization.size(); ++i) {
+    grids.push_back(time_discretization[i]);
+  }
+  // The impact is moved without shifting the initial time. The grids whose 
+  // time is unchanged but whose place in the phase changes are not cached.
+  contact_sequence->setImpactTime(0, t+0.45*T);
+  time_discretization.discretize(contact_sequence, t);
+  int num_moved_grids = 0;
+  for (int i=0; i<time_discretization.size(); ++i) {
+    const auto& grid = time_discretization[i];
+    if (i >= grids.size()) {
+      EXPECT_FALSE(cache.isCached(grid));
+      continue;
+    }
+    const auto& prev_grid = grids[i];
+    const bool is_unchanged 
+        = (grid.type == prev_grid.type && grid.t == prev_grid.t 
+            && grid.t0 == prev_grid.t0 && grid.dt == prev_grid.dt 
+            && grid.phase == prev_grid.phase 
+            && grid.impact_index == prev_grid.impact_index
+            && grid.lift_index == prev_grid.lift_index
+            && grid.stage_in_phase == prev_grid.stage_in_phase
+            && grid.num_grids_in_phase == prev_grid.num_grids_in_phase);
+    EXPECT_EQ(cache.isCached(grid), is_unchanged);
+    if (grid.type == prev_grid.type && grid.t == prev_grid.t 
+          && grid.phase == prev_grid.phase && !is_unchanged) {
+      ++num_moved_grids;
+    }
+  }
+  EXPECT_GT(num_moved_grids, 0);
+}
+
+
+TEST_F(GridRefCacheTest, cachedTaskSpace3DRef) {
+  const auto time_discretization = createTimeDiscretization();
+  const Eigen::Vector3d x3d0 = Eigen::Vector3d::Random();
+  const Eigen::Vector3d step_length = Eigen::Vector3d::Random();
+  const double step_height = std::abs(Eigen::VectorXd::Random(1)[0]);
+  const double swing_start_time = t + 0.1;
+  const double period_swing = 0.25;
+  const double period_stance = 0.15;
+  auto ref = std::make_shared<PeriodicSwingFootRef>(x3d0, step_length, step_height, 
+                                                    swing_start_time, period_swing, 
+                                                    period_stance, false);
+  auto cached_ref = std::make_shared<CachedTaskSpace3DRef>(ref);
+  EXPECT_EQ(cached_ref->getRef(), ref);
+  cached_ref->updateCache(time_discretization);
+  Eigen::VectorXd x3d_ref(3), x3d_ref_cached(3);
+  for (int i=0; i<time_discretization.size(); ++i) {
+    const auto& grid_info = time_discretization[i];
+    EXPECT_EQ(cached_ref->isActive(grid_info), ref->isActive(grid_info));
+    if (ref->isActive(grid_info)) {
+      ref->updateRef(grid_info, x3d_ref);
+      cached_ref->updateRef(grid_info, x3d_ref_cached);
+      EXPECT_TRUE(x3d_ref_cached.isApprox(x3d_ref));
+    }
+  }
+  // Grids that are not in the cache are passed through.
+  auto grid_info = time_discretization[0];
+  grid_info.t += 0.5 * dt;
+  EXPECT_EQ(cached_ref->isActive(grid_info), ref->isActive(grid_info));
+  ref->updateRef(grid_info, x3d_ref);
+  cached_ref->updateRef(grid_info, x3d_ref_cached);
+  EXPECT_TRUE(x3d_ref_cached.isApprox(x3d_ref));
+  EXPECT_THROW(CachedTaskSpace3DRef(nullptr), std::invalid_argument);
+}
+
+
+TEST_F(GridRefCacheTest, cachedCoMRef) {
+  const auto time_discretization = createTimeDiscretization();
+  const Eigen::Vector3d com_ref0 = Eigen::Vector3d::Random();
+  const Eigen::Vector3d vcom_ref = Eigen::Vector3d::Random();
+  const double swing_start_time = t + 0.1;
+  const double period_active = 0.25;
+  const double period_inactive = 0.15;
+  auto ref = std::make_shared<PeriodicCoMRef>(com_ref0, vcom_ref, 
+                                              swing_start_time, period_active, 
+                                              period_inactive, false);
+  auto cached_ref = std::make_shared<CachedCoMRef>(ref);
+  cached_ref->updateCache(time_discretization);
+  const auto& grid_info = time_discretization[time_discretization.size()-1];
+  Eigen::VectorXd com_ref(3), com_ref_cached(3);
+  ref->updateRef(grid_info, com_ref);
+  cached_ref->updateRef(grid_info, com_ref_cached);
+  EXPECT_TRUE(com_ref_cached.isApprox(com_ref));
+  // The cache is kept until it is explicitly invalidated.
+  ref->setCoMRef(com_ref0+Eigen::Vector3d::Ones(), vcom_ref, swing_start_time, 
+                 period_active, period_inactive, false);
+  cached_ref->updateRef(grid_info, com_ref_cached);
+  EXPECT_TRUE(com_ref_cached.isApprox(com_ref));
+  cached_ref->clearCache();
+  ref->updateRef(grid_info, com_ref);
+  cached_ref->updateRef(grid_info, com_ref_cached);
+  EXPECT_TRUE(com_ref_cached.isApprox(com_ref));
+}
+
+} // namespace robotoc
+
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
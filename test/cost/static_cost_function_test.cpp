@@ -0,0 +1,225 @@
+#include <memory>
+
+#include <gtest/gtest.h>
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/cost/cost_function.hpp"
+#include "robotoc/cost/cost_function_data.hpp"
+#include "robotoc/cost/static_cost_function.hpp"
+#include "robotoc/cost/configuration_space_cost.hpp"
+#include "robotoc/cost/com_cost.hpp"
+#include "robotoc/cost/task_space_3d_cost.hpp"
+#include "robotoc/core/split_solution.hpp"
+#include "robotoc/core/split_kkt_residual.hpp"
+#include "robotoc/core/split_kkt_matrix.hpp"
+
+#include "robot_factory.hpp"
+
+namespace robotoc {
+
+class StaticCostFunctionTest : public ::testing::Test {
+protected:
+  virtual void SetUp() {
+    grid_info = GridInfo::Random();
+    dt = grid_info.dt;
+  }
+
+  virtual void TearDown() {
+  }
+
+  void test(Robot& robot) const;
+  void testSameTypeComponents(Robot& robot, const int frame_id1, 
+                              const int frame_id2) const;
+
+  GridInfo grid_info;
+  double dt;
+};
+
+
+void StaticCostFunctionTest::test(Robot& robot) const {
+  const int dimv = robot.dimv();
+  const int dimu = robot.dimu();
+  ConfigurationSpaceCost config_cost(robot);
+  config_cost.set_q_weight(Eigen::VectorXd::Random(dimv).array().abs().matrix());
+  config_cost.set_v_weight(Eigen::VectorXd::Random(dimv).array().abs().matrix());
+  config_cost.set_a_weight(Eigen::VectorXd::Random(dimv).array().abs().matrix());
+  config_cost.set_u_weight(Eigen::VectorXd::Random(dimu).array().abs().matrix());
+  config_cost.set_q_weight_terminal(Eigen::VectorXd::Random(dimv).array().abs().matrix());
+  config_cost.set_v_weight_terminal(Eigen::VectorXd::Random(dimv).array().abs().matrix());
+  config_cost.set_q_weight_impact(Eigen::VectorXd::Random(dimv).array().abs().matrix());
+  config_cost.set_v_weight_impact(Eigen::VectorXd::Random(dimv).array().abs().matrix());
+  config_cost.set_dv_weight_impact(Eigen::VectorXd::Random(dimv).array().abs().matrix());
+  config_cost.set_q_ref(robot.generateFeasibleConfiguration());
+  config_cost.set_v_ref(Eigen::VectorXd::Random(dimv));
+  config_cost.set_u_ref(Eigen::VectorXd::Random(dimu));
+  CoMCost com_cost(robot);
+  com_cost.set_weight(Eigen::Vector3d::Random().array().abs().matrix());
+  com_cost.set_weight_terminal(Eigen::Vector3d::Random().array().abs().matrix());
+  com_cost.set_weight_impact(Eigen::Vector3d::Random().array().abs().matrix());
+  com_cost.set_const_ref(Eigen::Vector3d::Random());
+
+  auto static_cost 
+      = std::make_shared<StaticCostFunction<ConfigurationSpaceCost, CoMCost>>(
+          config_cost, com_cost);
+  EXPECT_EQ(static_cost->size(), 2u);
+  auto cost = std::make_shared<CostFunction>();
+  cost->add("static_cost", static_cost);
+  auto cost_ref = std::make_shared<CostFunction>();
+  cost_ref->add("config_cost", std::make_shared<ConfigurationSpaceCost>(config_cost));
+  cost_ref->add("com_cost", std::make_shared<CoMCost>(com_cost));
+  // Only the composed cost goes through the fused computations.
+  EXPECT_TRUE(static_cost->hasFusedEvaluation());
+  EXPECT_FALSE(cost_ref->get("com_cost")->hasFusedEvaluation());
+  EXPECT_EQ(cost->createCostFunctionData(robot).kkt_residual.lx.size(), 
+            2*robot.dimv());
+  EXPECT_EQ(cost_ref->createCostFunctionData(robot).kkt_residual.lx.size(), 0);
+
+  CostFunctionData data(robot), data_ref(robot);
+  auto contact_status = robot.createContactStatus();
+  contact_status.setRandom();
+  const auto s = SplitSolution::Random(robot, contact_status);
+  robot.updateKinematics(s.q, s.v, s.a);
+  auto kkt_mat = SplitKKTMatrix::Random(robot);
+  auto kkt_res = SplitKKTResidual::Random(robot);
+  auto kkt_mat_ref = kkt_mat;
+  auto kkt_res_ref = kkt_res;
+  EXPECT_DOUBLE_EQ(
+      cost->quadratizeStageCost(robot, contact_status, data, grid_info, s, 
+                                kkt_res, kkt_mat),
+      cost_ref->quadratizeStageCost(robot, contact_status, data_ref, grid_info, 
+                                    s, kkt_res_ref, kkt_mat_ref));
+  EXPECT_TRUE(kkt_res.isApprox(kkt_res_ref));
+  EXPECT_TRUE(kkt_mat.isApprox(kkt_mat_ref));
+
+  EXPECT_DOUBLE_EQ(
+      cost->quadratizeTerminalCost(robot, data, grid_info, s, kkt_res, kkt_mat),
+      cost_ref->quadratizeTerminalCost(robot, data_ref, grid_info, s, 
+                                       kkt_res_ref, kkt_mat_ref));
+  EXPECT_TRUE(kkt_res.isApprox(kkt_res_ref));
+  EXPECT_TRUE(kkt_mat.isApprox(kkt_mat_ref));
+
+  auto impact_status = robot.createImpactStatus();
+  impact_status.setRandom();
+  const auto s_impact = SplitSolution::Random(robot, impact_status);
+  robot.updateKinematics(s_impact.q, s_impact.v);
+  EXPECT_DOUBLE_EQ(
+      cost->quadratizeImpactCost(robot, impact_status, data, grid_info, 
+                                 s_impact, kkt_res, kkt_mat),
+      cost_ref->quadratizeImpactCost(robot, impact_status, data_ref, grid_info, 
+                                     s_impact, kkt_res_ref, kkt_mat_ref));
+  EXPECT_TRUE(kkt_res.isApprox(kkt_res_ref));
+  EXPECT_TRUE(kkt_mat.isApprox(kkt_mat_ref));
+
+  static_cost->get<1>().set_const_ref(Eigen::Vector3d::Zero());
+  cost_ref->get("com_cost")->as_shared_ptr<CoMCost>()->set_const_ref(Eigen::Vector3d::Zero());
+  robot.updateKinematics(s.q, s.v, s.a);
+  EXPECT_DOUBLE_EQ(
+      cost->evalStageCost(robot, contact_status, data, grid_info, s),
+      cost_ref->evalStageCost(robot, contact_status, data_ref, grid_info, s));
+}
+
+
+void StaticCostFunctionTest::testSameTypeComponents(
+    Robot& robot, const int frame_id1, const int frame_id2) const {
+  // The components share the intermediate data, e.g., CostFunctionData::J_3d.
+  TaskSpace3DCost task_cost1(robot, frame_id1), task_cost2(robot, frame_id2);
+  for (auto* e : {&task_cost1, &task_cost2}) {
+    e->set_weight(Eigen::Vector3d::Random().array().abs().matrix());
+    e->set_weight_terminal(Eigen::Vector3d::Random().array().abs().matrix());
+    e->set_weight_impact(Eigen::Vector3d::Random().array().abs().matrix());
+    e->set_const_ref(Eigen::Vector3d::Random());
+  }
+  auto static_cost 
+      = std::make_shared<StaticCostFunction<TaskSpace3DCost, TaskSpace3DCost>>(
+          task_cost1, task_cost2);
+  auto cost = std::make_shared<CostFunction>();
+  cost->add("static_cost", static_cost);
+  auto cost_ref = std::make_shared<CostFunction>();
+  cost_ref->add("task_cost1", std::make_shared<TaskSpace3DCost>(task_cost1));
+  cost_ref->add("task_cost2", std::make_shared<TaskSpace3DCost>(task_cost2));
+
+  CostFunctionData data(robot), data_ref(robot);
+  auto contact_status = robot.createContactStatus();
+  contact_status.setRandom();
+  const auto s = SplitSolution::Random(robot, contact_status);
+  robot.updateKinematics(s.q, s.v, s.a);
+  auto kkt_mat = SplitKKTMatrix::Random(robot);
+  auto kkt_res = SplitKKTResidual::Random(robot);
+  auto kkt_mat_ref = kkt_mat;
+  auto kkt_res_ref = kkt_res;
+  EXPECT_DOUBLE_EQ(
+      cost->linearizeStageCost(robot, contact_status, data, grid_info, s, 
+                               kkt_res),
+      cost_ref->linearizeStageCost(robot, contact_status, data_ref, grid_info, 
+                                   s, kkt_res_ref));
+  EXPECT_TRUE(kkt_res.isApprox(kkt_res_ref));
+  EXPECT_DOUBLE_EQ(
+      cost->quadratizeStageCost(robot, contact_status, data, grid_info, s, 
+                                kkt_res, kkt_mat),
+      cost_ref->quadratizeStageCost(robot, contact_status, data_ref, grid_info, 
+                                    s, kkt_res_ref, kkt_mat_ref));
+  EXPECT_TRUE(kkt_res.isApprox(kkt_res_ref));
+  EXPECT_TRUE(kkt_mat.isApprox(kkt_mat_ref));
+  EXPECT_DOUBLE_EQ(
+      cost->quadratizeTerminalCost(robot, data, grid_info, s, kkt_res, kkt_mat),
+      cost_ref->quadratizeTerminalCost(robot, data_ref, grid_info, s, 
+                                       kkt_res_ref, kkt_mat_ref));
+  EXPECT_TRUE(kkt_res.isApprox(kkt_res_ref));
+  EXPECT_TRUE(kkt_mat.isApprox(kkt_mat_ref));
+
+  // The separate calls, e.g., by DerivativeChecker, are also consistent.
+  auto kkt_mat_split = SplitKKTMatrix::Random(robot);
+  auto kkt_mat_split_ref = kkt_mat_split;
+  static_cost->evalStageCost(robot, contact_status, data, grid_info, s);
+  static_cost->evalStageCostDerivatives(robot, contact_status, data, grid_info, 
+                                        s, kkt_res);
+  static_cost->evalStageCostHessian(robot, contact_status, data, grid_info, s, 
+                                    kkt_mat_split);
+  for (const auto& name : {"task_cost1", "task_cost2"}) {
+    const auto e = cost_ref->get(name);
+    e->evalStageCost(robot, contact_status, data_ref, grid_info, s);
+    e->evalStageCostDerivatives(robot, contact_status, data_ref, grid_info, s, 
+                                kkt_res_ref);
+    e->evalStageCostHessian(robot, contact_status, data_ref, grid_info, s, 
+                            kkt_mat_split_ref);
+  }
+  EXPECT_TRUE(kkt_res.isApprox(kkt_res_ref));
+  EXPECT_TRUE(kkt_mat_split.isApprox(kkt_mat_split_ref));
+
+  auto impact_status = robot.createImpactStatus();
+  impact_status.setRandom();
+  const auto s_impact = SplitSolution::Random(robot, impact_status);
+  robot.updateKinematics(s_impact.q, s_impact.v);
+  EXPECT_DOUBLE_EQ(
+      cost->quadratizeImpactCost(robot, impact_status, data, grid_info, 
+                                 s_impact, kkt_res, kkt_mat),
+      cost_ref->quadratizeImpactCost(robot, impact_status, data_ref, grid_info, 
+                                     s_impact, kkt_res_ref, kkt_mat_ref));
+  EXPECT_TRUE(kkt_res.isApprox(kkt_res_ref));
+  EXPECT_TRUE(kkt_mat.isApprox(kkt_mat_ref));
+}
+
+
+TEST_F(StaticCostFunctionTest, fixedBase) {
+  auto robot = testhelper::CreateRobotManipulator(dt);
+  test(robot);
+  const int frame_id = robot.contactFrames()[0];
+  testSameTypeComponents(robot, frame_id, frame_id-2);
+}
+
+
+TEST_F(StaticCostFunctionTest, floatingBase) {
+  auto robot = testhelper::CreateQuadrupedalRobot(dt);
+  test(robot);
+  testSameTypeComponents(robot, robot.contactFrames()[0], 
+                         robot.contactFrames()[3]);
+}
+
+} // namespace robotoc
+
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
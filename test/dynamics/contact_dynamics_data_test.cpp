@@ -57,8 +57,8 @@ TEST_P(ContactDynamicsDataTest, test) {
   EXPECT_EQ(data.dCdq().cols(), dimv);
   EXPECT_EQ(data.dCdv().rows(), dimf);
   EXPECT_EQ(data.dCdv().cols(), dimv);
-  EXPECT_EQ(data.MJtJinv().rows(), dimv+dimf);
-  EXPECT_EQ(data.MJtJinv().cols(), dimv+dimf);
+  EXPECT_EQ(data.MJtJinv_IO().rows(), dimv+dimf);
+  EXPECT_EQ(data.MJtJinv_IO().cols(), dimv);
   EXPECT_EQ(data.MJtJinv_dIDCdqv().rows(), dimv+dimf);
   EXPECT_EQ(data.MJtJinv_dIDCdqv().cols(), dimx);
   EXPECT_EQ(data.Qafqv().rows(), dimv+dimf);
@@ -84,7 +84,7 @@ TEST_P(ContactDynamicsDataTest, test) {
   const Eigen::MatrixXd dIDda_ref = Eigen::MatrixXd::Random(dimv, dimv);
   const Eigen::MatrixXd dCda_ref = Eigen::MatrixXd::Random(dimf, dimv);
   const Eigen::MatrixXd dIDCdqv_ref = Eigen::MatrixXd::Random(dimv+dimf, dimx);
-  const Eigen::MatrixXd MJtJinv_ref = Eigen::MatrixXd::Random(dimv+dimf, dimv+dimf);
+  const Eigen::MatrixXd MJtJinv_IO_ref = Eigen::MatrixXd::Random(dimv+dimf, dimv);
   const Eigen::MatrixXd MJtJinv_dIDCdqv_ref = Eigen::MatrixXd::Random(dimv+dimf, dimx);
   const Eigen::MatrixXd Qafqv_ref = Eigen::MatrixXd::Random(dimv+dimf, dimx);
   const Eigen::MatrixXd Qafu_full_ref = Eigen::MatrixXd::Random(dimv+dimf, dimv);
@@ -95,7 +95,7 @@ TEST_P(ContactDynamicsDataTest, test) {
   data.dIDda = dIDda_ref;
   data.dCda() = dCda_ref;
   data.dIDCdqv() = dIDCdqv_ref;
-  data.MJtJinv() = MJtJinv_ref;
+  data.MJtJinv_IO() = MJtJinv_IO_ref;
   data.MJtJinv_dIDCdqv() = MJtJinv_dIDCdqv_ref;
   data.Qafqv() = Qafqv_ref;
   data.Qafu_full() = Qafu_full_ref;
@@ -110,7 +110,7 @@ TEST_P(ContactDynamicsDataTest, test) {
   EXPECT_TRUE(data.dIDdv().isApprox(dIDCdqv_ref.topRightCorner(dimv, dimv)));
   EXPECT_TRUE(data.dCdq().isApprox(dIDCdqv_ref.bottomLeftCorner(dimf, dimv)));
   EXPECT_TRUE(data.dCdv().isApprox(dIDCdqv_ref.bottomRightCorner(dimf, dimv)));
-  EXPECT_TRUE(data.MJtJinv().isApprox(MJtJinv_ref));
+  EXPECT_TRUE(data.MJtJinv_IO().isApprox(MJtJinv_IO_ref));
   EXPECT_TRUE(data.MJtJinv_dIDCdqv().isApprox(MJtJinv_dIDCdqv_ref));
   EXPECT_TRUE(data.Qafqv().isApprox(Qafqv_ref));
   EXPECT_TRUE(data.Qafqv().isApprox(data.Qdvfqv()));
@@ -117,9 +117,10 @@ TEST_P(ContactDynamicsTest, condense) {
   auto kkt_residual_ref = kkt_residual;
   auto kkt_matrix_ref = kkt_matrix;
   condenseContactDynamics(robot, contact_status, dt, data, kkt_matrix, kkt_residual);
-  robot.computeMJtJinv(data_ref.dIDda, data_ref.dCda(), data_ref.MJtJinv());
-  data_ref.MJtJinv_dIDCdqv() = data_ref.MJtJinv() * data_ref.dIDCdqv();
-  data_ref.MJtJinv_IDC()     = data_ref.MJtJinv() * data_ref.IDC();
+  Eigen::MatrixXd MJtJinv = Eigen::MatrixXd::Zero(data_ref.dimvf(), data_ref.dimvf());
+  robot.computeMJtJinv(data_ref.dIDda, data_ref.dCda(), MJtJinv);
+  data_ref.MJtJinv_dIDCdqv() = MJtJinv * data_ref.dIDCdqv();
+  data_ref.MJtJinv_IDC()     = MJtJinv * data_ref.IDC();
   Eigen::MatrixXd Qaaff = Eigen::MatrixXd::Zero(dimv+dimf, dimv+dimf);
   Qaaff.topLeftCorner(dimv, dimv) = kkt_matrix_ref.Qaa;
   Qaaff.bottomRightCorner(dimf, dimf) = kkt_matrix_ref.Qff();
@@ -127,19 +128,19 @@ TEST_P(ContactDynamicsTest, condense) {
   data_ref.Qafqv().bottomLeftCorner(dimf, dimv) -= kkt_matrix_ref.Qqf().transpose();
   Eigen::MatrixXd IO_mat = Eigen::MatrixXd::Zero(dimv+dimf, dimv);
   IO_mat.topRows(dimv).setIdentity();
-  data_ref.Qafu_full() = Qaaff * data_ref.MJtJinv() * IO_mat;
+  data_ref.Qafu_full() = Qaaff * MJtJinv * IO_mat;
   data_ref.la() = kkt_residual_ref.la;
   data_ref.lf() = - kkt_residual_ref.lf();
-  data_ref.laf() -= Qaaff * data_ref.MJtJinv() * data_ref.IDC();
+  data_ref.laf() -= Qaaff * MJtJinv * data_ref.IDC();
   kkt_matrix_ref.Qxx -= data_ref.MJtJinv_dIDCdqv().transpose() * data_ref.Qafqv();
   kkt_matrix_ref.Qxx.topRows(dimv) += kkt_matrix_ref.Qqf() * data_ref.MJtJinv_dIDCdqv().bottomRows(dimf);
   Eigen::MatrixXd Qxu_full = Eigen::MatrixXd::Zero(2*dimv, dimv);
   Qxu_full.rightCols(dimu) = kkt_matrix_ref.Qxu;
   Qxu_full -= data_ref.MJtJinv_dIDCdqv().transpose() * data_ref.Qafu_full();
-  Qxu_full.topRows(dimv) -= kkt_matrix_ref.Qqf() * data_ref.MJtJinv().bottomLeftCorner(dimf, dimv);
+  Qxu_full.topRows(dimv) -= kkt_matrix_ref.Qqf() * MJtJinv.bottomLeftCorner(dimf, dimv);
   data_ref.Qxu_passive   = Qxu_full.leftCols(dim_passive);
   kkt_matrix_ref.Qxu = Qxu_full.rightCols(dimu);
-  const Eigen::MatrixXd Quu_full = IO_mat.transpose() * data_ref.MJtJinv() * data_ref.Qafu_full();
+  const Eigen::MatrixXd Quu_full = IO_mat.transpose() * MJtJinv * data_ref.Qafu_full();
   data_ref.Quu_passive_topRight = Quu_full.topRightCorner(dim_passive, dimu);
   kkt_matrix_ref.Quu       += Quu_full.bottomRightCorner(dimu, dimu);
   kkt_residual_ref.lx -= data_ref.MJtJinv_dIDCdqv().transpose() * data_ref.laf();
@@ -147,16 +148,16 @@ TEST_P(ContactDynamicsTest, condense) {
   Eigen::VectorXd lu_full = Eigen::VectorXd::Zero(dimv);
   lu_full.head(dim_passive) = s.nu_passive - s.beta.head(dim_passive);
   lu_full.tail(dimu)        = kkt_residual_ref.lu;
-  lu_full += IO_mat.transpose() * data_ref.MJtJinv() * data_ref.laf();
+  lu_full += IO_mat.transpose() * MJtJinv * data_ref.laf();
   data_ref.lu_passive     = lu_full.head(dim_passive);
   kkt_residual_ref.lu = lu_full.tail(dimu);
   Eigen::MatrixXd OOIO_mat = Eigen::MatrixXd::Zero(2*dimv, dimv+dimf);
   OOIO_mat.bottomLeftCorner(dimv, dimv) = dt * Eigen::MatrixXd::Identity(dimv, dimv);
   kkt_matrix_ref.Fvv() = Eigen::MatrixXd::Identity(dimv, dimv);
   kkt_matrix_ref.Fxx  -= OOIO_mat * data_ref.MJtJinv_dIDCdqv();
-  const Eigen::MatrixXd Fxu_full = OOIO_mat * data_ref.MJtJinv() * IO_mat;
+  const Eigen::MatrixXd Fxu_full = OOIO_mat * MJtJinv * IO_mat;
   kkt_matrix_ref.Fvu = Fxu_full.bottomRows(dimv).rightCols(dimu);
-  kkt_residual_ref.Fx -= (OOIO_mat * data_ref.MJtJinv() * data_ref.IDC());
+  kkt_residual_ref.Fx -= (OOIO_mat * MJtJinv * data_ref.IDC());
 
   data_ref.ha() = kkt_matrix_ref.ha;
   data_ref.hf() = - kkt_matrix_ref.hf();
@@ -165,7 +166,7 @@ TEST_P(ContactDynamicsTest, condense) {
   kkt_matrix_ref.hq() += (1.0/dt) * kkt_matrix_ref.Qqf() * data_ref.MJtJinv_IDC().tail(dimf);
   Eigen::VectorXd hu_full = Eigen::VectorXd::Zero(dimv);
   hu_full.tail(dimu)        = kkt_matrix_ref.hu;
-  hu_full += IO_mat.transpose() * data_ref.MJtJinv() * data_ref.haf();
+  hu_full += IO_mat.transpose() * MJtJinv * data_ref.haf();
   kkt_matrix_ref.hu = hu_full.tail(dimu);
 
   EXPECT_TRUE(kkt_residual_ref.isApprox(kkt_residual));
@@ -179,21 +180,21 @@ TEST_P(ContactDynamicsTest, condense) {
   IO_mat.topRows(dimv).setIdentity();
   Eigen::VectorXd du_full = Eigen::VectorXd::Zero(dimv);
   du_full.tail(robot.dimu()) = d_ref.du;
-  d_ref.daf() = - data_ref.MJtJinv() * (data_ref.dIDCdqv() * d.dx - IO_mat * du_full + data_ref.IDC());
+  d_ref.daf() = - MJtJinv * (data_ref.dIDCdqv() * d.dx - IO_mat * du_full + data_ref.IDC());
   d_ref.df().array() *= -1;
   EXPECT_TRUE(d.isApprox(d_ref));
 
   const auto d_next = SplitDirection::Random(robot);
   const double dts = Eigen::VectorXd::Random(1)[0];
-  expandContactDynamicsDual(dt, dts, data, d_next, d);
+  expandContactDynamicsDual(robot, dt, dts, data, d_next, d);
   if (robot.hasFloatingBase()) {
     Eigen::VectorXd du_full = Eigen::VectorXd::Zero(dimv);
     du_full.tail(dimu) = d_ref.du; 
     d_ref.dnu_passive = - (data_ref.lu_passive + data_ref.Qxu_passive.transpose() * d_ref.dx 
                             + data_ref.Quu_passive_topRight * d_ref.du
-                            + (IO_mat.transpose() * data_ref.MJtJinv() * OOIO_mat.transpose() * d_next.dlmdgmm).head(dim_passive));
+                            + (IO_mat.transpose() * MJtJinv * OOIO_mat.transpose() * d_next.dlmdgmm).head(dim_passive));
   }
-  d_ref.dbetamu() = - data_ref.MJtJinv() * (data_ref.Qafqv() * d_ref.dx 
+  d_ref.dbetamu() = - MJtJinv * (data_ref.Qafqv() * d_ref.dx 
                                         + data_ref.Qafu_full() * du_full 
                                         + OOIO_mat.transpose() * d_next.dlmdgmm
                                         + data_ref.laf() + dts * data_ref.haf());
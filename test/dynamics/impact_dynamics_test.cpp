@@ -98,9 +98,10 @@ TEST_P(ImpactDynamicsTest, condense) {
   auto kkt_residual_ref = kkt_residual;
   auto kkt_matrix_ref = kkt_matrix;
   condenseImpactDynamics(robot, impact_status, data, kkt_matrix, kkt_residual);
-  robot.computeMJtJinv(data_ref.dIDddv, data_ref.dCdv(), data_ref.MJtJinv());
-  data_ref.MJtJinv_dIDCdqv() = data_ref.MJtJinv() * data_ref.dIDCdqv();
-  data_ref.MJtJinv_IDC()     = data_ref.MJtJinv() * data_ref.IDC();
+  Eigen::MatrixXd MJtJinv = Eigen::MatrixXd::Zero(data_ref.dimvf(), data_ref.dimvf());
+  robot.computeMJtJinv(data_ref.dIDddv, data_ref.dCdv(), MJtJinv);
+  data_ref.MJtJinv_dIDCdqv() = MJtJinv * data_ref.dIDCdqv();
+  data_ref.MJtJinv_IDC()     = MJtJinv * data_ref.IDC();
   Eigen::MatrixXd Qdvdvff = Eigen::MatrixXd::Zero(dimv+dimf, dimv+dimf);
   Qdvdvff.topLeftCorner(dimv, dimv) = kkt_matrix_ref.Qdvdv;
   Qdvdvff.bottomRightCorner(dimf, dimf) = kkt_matrix_ref.Qff();
@@ -124,12 +125,12 @@ TEST_P(ImpactDynamicsTest, condense) {
   auto d = SplitDirection::Random(robot, impact_status);
   auto d_ref = d;
   expandImpactDynamicsPrimal(data, d);
-  d_ref.ddvf() = - data_ref.MJtJinv() * (data_ref.dIDCdqv() * d_ref.dx + data_ref.IDC());
+  d_ref.ddvf() = - MJtJinv * (data_ref.dIDCdqv() * d_ref.dx + data_ref.IDC());
   d_ref.df().array() *= -1;
   EXPECT_TRUE(d.isApprox(d_ref));
   const auto d_next = SplitDirection::Random(robot);
-  expandImpactDynamicsDual(data, d_next, d);
-  d_ref.dbetamu() = - data_ref.MJtJinv() * (data_ref.Qdvfqv() * d.dx 
+  expandImpactDynamicsDual(robot, data, d_next, d);
+  d_ref.dbetamu() = - MJtJinv * (data_ref.Qdvfqv() * d.dx 
                                          + OOIO_mat.transpose() * d_next.dlmdgmm
                                          + data_ref.ldvf());
   EXPECT_TRUE(d.isApprox(d_ref));
@@ -100,6 +100,32 @@ TEST_P(SwitchingConstraintTest, linearize) {
   kkt_matrix_ref.hv().noalias() += 2.0 * PqT_xi;
   kkt_matrix_ref.ha.noalias()  += (2.0*dt1) * PqT_xi;
   EXPECT_TRUE(kkt_residual.isApprox(kkt_residual_ref));
+  EXPECT_TRUE(kkt_matrix.isApprox(kkt_matrix_ref));
+}
+
+
+TEST_P(SwitchingConstraintTest, linearizeConsistentWithEval) {
+  auto robot = GetParam();
+  auto impact_status = robot.createImpactStatus();
+  impact_status.setRandom();
+  if (!impact_status.hasActiveImpact()) {
+    impact_status.activateImpact(0);
+  }
+  const SplitSolution s = SplitSolution::Random(robot, impact_status);
+  SwitchingConstraintData data(robot);
+  SplitKKTResidual kkt_residual_eval(robot);
+  evalSwitchingConstraint(robot, impact_status, data, dt1, dt2, s, 
+                          kkt_residual_eval);
+  const Eigen::VectorXd q_eval = data.q;
+  SplitKKTResidual kkt_residual(robot);
+  SplitKKTMatrix kkt_matrix(robot);
+  linearizeSwitchingConstraint(robot, impact_status, data, dt1, dt2,
+                               s, kkt_matrix, kkt_residual);
+  EXPECT_TRUE(data.q.isApprox(q_eval));
+  EXPECT_TRUE(kkt_residual.P().isApprox(kkt_residual_eval.P()));
+  // The Jacobian of the residual w.r.t. the acceleration is dt1*dt2 times 
+  // that w.r.t. the velocity divided by (dt1+dt2).
+  EXPECT_TRUE(((dt1+dt2)*kkt_matrix.Phia()).isApprox((dt1*dt2)*kkt_matrix.Phiv()));
 }
 
 
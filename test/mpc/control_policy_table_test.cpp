@@ -0,0 +1,205 @@
+#include <vector>
+#include <memory>
+
+#include <gtest/gtest.h>
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/planner/contact_sequence.hpp"
+#include "robotoc/cost/cost_function.hpp"
+#include "robotoc/cost/configuration_space_cost.hpp"
+#include "robotoc/constraints/constraints.hpp"
+#include "robotoc/ocp/ocp.hpp"
+#include "robotoc/solver/ocp_solver.hpp"
+#include "robotoc/solver/solver_options.hpp"
+#include "robotoc/mpc/control_policy.hpp"
+#include "robotoc/mpc/control_policy_table.hpp"
+#include "robotoc/mpc/state_feedback_policy.hpp"
+
+#include "robot_factory.hpp"
+
+
+namespace robotoc {
+
+class ControlPolicyTableTest : public ::testing::Test {
+protected:
+  virtual void SetUp() {
+    srand((unsigned int) time(0));
+    robot = testhelper::CreateQuadrupedalRobot(0.025);
+    t0 = 0.1;
+    T = 0.5;
+    N = 20;
+    const double t_lift = t0 + 0.11;
+    const double t_touchdown = t0 + 0.31;
+
+    q_standing = Eigen::VectorXd(robot.dimq());
+    q_standing << 0, 0, 0.4792, 0, 0, 0, 1, 
+                  -0.1,  0.7, -1.0, 
+                  -0.1, -0.7,  1.0, 
+                   0.1,  0.7, -1.0, 
+                   0.1, -0.7,  1.0;
+    auto cost = std::make_shared<CostFunction>();
+    auto config_cost = std::make_shared<ConfigurationSpaceCost>(robot);
+    config_cost->set_q_weight(Eigen::VectorXd::Constant(robot.dimv(), 10));
+    config_cost->set_q_ref(q_standing);
+    config_cost->set_q_weight_terminal(Eigen::VectorXd::Constant(robot.dimv(), 10));
+    config_cost->set_v_weight(Eigen::VectorXd::Constant(robot.dimv(), 1));
+    config_cost->set_v_weight_terminal(Eigen::VectorXd::Constant(robot.dimv(), 1));
+    config_cost->set_a_weight(Eigen::VectorXd::Constant(robot.dimv(), 0.01));
+    cost->add("config_cost", config_cost);
+    auto constraints = std::make_shared<Constraints>();
+
+    auto contact_sequence = std::make_shared<ContactSequence>(robot);
+    auto contact_status_standing = robot.createContactStatus();
+    contact_status_standing.activateContacts({0, 1, 2, 3});
+    robot.updateFrameKinematics(q_standing);
+    std::vector<Eigen::Vector3d> contact_positions;
+    for (const auto frame : robot.contactFrames()) {
+      contact_positions.push_back(robot.framePosition(frame));
+    }
+    contact_status_standing.setContactPlacements(contact_positions);
+    contact_sequence->init(contact_status_standing);
+    auto contact_status_flying = robot.createContactStatus();
+    contact_sequence->push_back(contact_status_flying, t_lift);
+    contact_sequence->push_back(contact_status_standing, t_touchdown);
+
+    OCP ocp(robot, cost, constraints, contact_sequence, T, N, 2);
+    auto solver_options = SolverOptions();
+    solver_options.max_iter = 3;
+    ocp_solver = OCPSolver(ocp, solver_options);
+    const Eigen::VectorXd v = Eigen::VectorXd::Zero(robot.dimv());
+    ocp_solver.discretize(t0);
+    ocp_solver.setSolution("q", q_standing);
+    ocp_solver.setSolution("v", v);
+    Eigen::Vector3d f_init;
+    f_init << 0, 0, 0.25*robot.totalWeight();
+    ocp_solver.setSolution("f", f_init);
+    ocp_solver.solve(t0, q_standing, v);
+  }
+
+  virtual void TearDown() {
+  }
+
+  void testPolicy(ControlPolicyTable& table, const double t) const;
+
+  Robot robot;
+  double t0, T;
+  int N;
+  Eigen::VectorXd q_standing;
+  OCPSolver ocp_solver;
+};
+
+
+void ControlPolicyTableTest::testPolicy(ControlPolicyTable& table, 
+                                        const double t) const {
+  const ControlPolicy policy_ref(ocp_solver, t);
+  const auto& policy = table.get(t);
+  EXPECT_DOUBLE_EQ(policy.t, t);
+  EXPECT_TRUE(policy.tauJ.isApprox(policy_ref.tauJ)) << "t = " << t;
+  EXPECT_TRUE(policy.qJ.isApprox(policy_ref.qJ)) << "t = " << t;
+  EXPECT_TRUE(policy.dqJ.isApprox(policy_ref.dqJ)) << "t = " << t;
+  EXPECT_TRUE(policy.Kp.isApprox(policy_ref.Kp)) << "t = " << t;
+  EXPECT_TRUE(policy.Kd.isApprox(policy_ref.Kd)) << "t = " << t;
+}
+
+
+TEST_F(ControlPolicyTableTest, monotone) {
+  ControlPolicyTable table(ocp_solver);
+  EXPECT_EQ(table.size(), ocp_solver.getTimeDiscretization().N());
+  const double dt = 0.0031;
+  for (double t=t0-0.05; t<t0+T+0.05; t+=dt) {
+    testPolicy(table, t);
+  }
+}
+
+
+TEST_F(ControlPolicyTableTest, grids) {
+  ControlPolicyTable table(ocp_solver);
+  const auto& time_discretization = ocp_solver.getTimeDiscretization();
+  bool has_impact = false;
+  for (int i=0; i<time_discretization.size(); ++i) {
+    // The impact grid and the next grid have the same time.
+    if (time_discretization[i].type == GridType::Impact) {
+      has_impact = true;
+    }
+    testPolicy(table, time_discretization[i].t);
+  }
+  EXPECT_TRUE(has_impact);
+  for (int i=time_discretization.size()-1; i>=0; --i) {
+    testPolicy(table, time_discretization[i].t);
+  }
+}
+
+
+TEST_F(ControlPolicyTableTest, nonMonotone) {
+  ControlPolicyTable table(ocp_solver);
+  for (int i=0; i<500; ++i) {
+    const double t = t0 + (T + 0.2) * std::abs(Eigen::VectorXd::Random(1)[0]) - 0.1;
+    testPolicy(table, t);
+  }
+  const double dt = 0.0031;
+  for (double t=t0+T+0.05; t>t0-0.05; t-=dt) {
+    testPolicy(table, t);
+  }
+}
+
+
+TEST_F(ControlPolicyTableTest, findInterval) {
+  const auto& time_discretization = ocp_solver.getTimeDiscretization();
+  const int N = time_discretization.N();
+  // The linear scan over the grids.
+  auto findIntervalRef = [&](const double t) {
+    if (t < time_discretization[0].t) return 0;
+    for (int i=1; i<N-1; ++i) {
+      if ((t < time_discretization[i].t) 
+            && (time_discretization[i-1].type != GridType::Impact)) {
+        return i;
+      }
+    }
+    return N-1;
+  };
+  std::vector<double> ts;
+  for (int i=0; i<time_discretization.size(); ++i) {
+    ts.push_back(time_discretization[i].t);
+  }
+  const double dt = 0.0031;
+  for (double t=t0-0.05; t<t0+T+0.05; t+=dt) {
+    ts.push_back(t);
+  }
+  StateFeedbackPolicy state_feedback_policy(robot);
+  for (const auto t : ts) {
+    EXPECT_EQ(ControlPolicy::findInterval(time_discretization, t), 
+              findIntervalRef(t)) << "t = " << t;
+    // StateFeedbackPolicy interpolates over the same interval.
+    const ControlPolicy policy(ocp_solver, t);
+    state_feedback_policy.set(robot, ocp_solver, t);
+    EXPECT_TRUE(state_feedback_policy.u.isApprox(policy.tauJ)) << "t = " << t;
+    EXPECT_TRUE(state_feedback_policy.v.tail(robot.dimu()).isApprox(policy.dqJ)) 
+        << "t = " << t;
+  }
+}
+
+
+TEST_F(ControlPolicyTableTest, update) {
+  ControlPolicyTable table(ocp_solver);
+  const double dt = 0.0031;
+  for (double t=t0; t<t0+0.5*T; t+=dt) {
+    table.get(t);
+  }
+  // The table is rebuilt from the solution on the shifted horizon.
+  const double t_next = t0 + 0.015;
+  ocp_solver.solve(t_next, q_standing, Eigen::VectorXd::Zero(robot.dimv()));
+  table.update(ocp_solver);
+  EXPECT_EQ(table.size(), ocp_solver.getTimeDiscretization().N());
+  for (double t=t_next-0.05; t<t_next+T+0.05; t+=dt) {
+    testPolicy(table, t);
+  }
+}
+
+} // namespace robotoc
+
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
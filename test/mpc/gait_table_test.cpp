@@ -0,0 +1,58 @@
+#include <vector>
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "robotoc/mpc/gait_table.hpp"
+
+
+namespace robotoc {
+
+class GaitTableTest : public ::testing::Test {
+protected:
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+
+TEST_F(GaitTableTest, test) {
+  const std::vector<std::vector<int>> active_contacts 
+      = {{0, 1, 2, 3}, {3, 0}, {0, 1, 2, 3}, {1, 2}};
+  const std::vector<double> durations = {0.1, 0.25, 0.05, 0.25};
+  GaitTable gait_table(active_contacts, durations);
+  EXPECT_EQ(gait_table.numPhases(), 4);
+  EXPECT_EQ(gait_table.activeContacts(0), std::vector<int>({0, 1, 2, 3}));
+  EXPECT_EQ(gait_table.activeContacts(1), std::vector<int>({0, 3}));
+  EXPECT_EQ(gait_table.activeContacts(3), std::vector<int>({1, 2}));
+  for (int i=0; i<4; ++i) {
+    EXPECT_DOUBLE_EQ(gait_table.duration(i), durations[i]);
+  }
+  EXPECT_DOUBLE_EQ(gait_table.period(), 0.65);
+  EXPECT_DOUBLE_EQ(gait_table.minDuration(), 0.05);
+  GaitTable single_phase({{0, 1}}, {0.2});
+  EXPECT_EQ(single_phase.numPhases(), 1);
+  EXPECT_DOUBLE_EQ(single_phase.period(), 0.2);
+}
+
+
+TEST_F(GaitTableTest, invalidArguments) {
+  EXPECT_THROW(GaitTable({}, {}), std::out_of_range);
+  EXPECT_THROW(GaitTable({{0, 3}, {1, 2}}, {0.25}), std::out_of_range);
+  EXPECT_THROW(GaitTable({{0, 3}, {1, 2}}, {0.25, 0}), std::out_of_range);
+  // consecutive phases with the same active contacts 
+  EXPECT_THROW(GaitTable({{0, 3}, {3, 0}}, {0.25, 0.25}), std::out_of_range);
+  EXPECT_THROW(GaitTable({{0, 3}, {1, 2}, {0, 3}}, {0.25, 0.25, 0.25}), 
+               std::out_of_range);
+  EXPECT_NO_THROW(GaitTable({{0, 3}, {1, 2}, {0, 1, 2, 3}}, {0.25, 0.25, 0.1}));
+}
+
+} // namespace robotoc
+
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
\ No newline at end of file
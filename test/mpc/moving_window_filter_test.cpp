@@ -31,6 +31,32 @@ TEST_F(MovingWindowFilterTest, test) {
   EXPECT_EQ(filter.size(), 4);
 }
 
+
+TEST_F(MovingWindowFilterTest, average) {
+  const double time_length = 0.5;
+  const double sampling_period = 0.01;
+  MovingWindowFilter<2> filter(time_length);
+  std::vector<Eigen::Vector2d> data;
+  double t = 0;
+  for (int i=0; i<1000; ++i) {
+    data.push_back(Eigen::Vector2d::Random());
+    filter.push_back(t, data.back());
+    t += sampling_period;
+  }
+  const int size = filter.size();
+  EXPECT_GT(size, 1);
+  Eigen::Vector2d average = Eigen::Vector2d::Zero();
+  for (int i=data.size()-size; i<data.size(); ++i) {
+    average += data[i];
+  }
+  average /= size;
+  EXPECT_TRUE(filter.average().isApprox(average));
+  filter.clear();
+  EXPECT_EQ(filter.size(), 0);
+  filter.push_back(t, data.front());
+  EXPECT_TRUE(filter.average().isApprox(data.front()));
+}
+
 } // namespace robotoc
 
 
@@ -0,0 +1,175 @@
+#include <vector>
+#include <memory>
+#include <cmath>
+
+#include <gtest/gtest.h>
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/solver/solver_options.hpp"
+#include "robotoc/mpc/gait_table.hpp"
+#include "robotoc/mpc/trot_foot_step_planner.hpp"
+#include "robotoc/mpc/pace_foot_step_planner.hpp"
+#include "robotoc/mpc/mpc_gait.hpp"
+
+#include "robot_factory.hpp"
+
+
+namespace robotoc {
+
+class MPCGaitTest : public ::testing::Test {
+protected:
+  virtual void SetUp() {
+    robot = testhelper::CreateQuadrupedalRobot(0.025);
+    T = 0.5;
+    N = 20;
+    dt = T / N;
+    swing_height = 0.1;
+    gait_start_time = 0.1;
+    trot_table = GaitTable({{0, 3}, {0, 1, 2, 3}, {1, 2}, {0, 1, 2, 3}},
+                           {0.25, 0.1, 0.25, 0.1});
+    pace_table = GaitTable({{2, 3}, {0, 1, 2, 3}, {0, 1}, {0, 1, 2, 3}},
+                           {0.2, 0.1, 0.2, 0.1});
+    max_num_discrete_events
+        = static_cast<int>(std::ceil(T/trot_table.minDuration())) + 1;
+    const Eigen::Vector3d step_length = (Eigen::Vector3d() << 0.1, 0, 0).finished();
+    trot_planner = std::make_shared<TrotFootStepPlanner>(robot);
+    trot_planner->setGaitPattern(step_length, 0.0, true);
+    pace_planner = std::make_shared<PaceFootStepPlanner>(robot);
+    pace_planner->setGaitPattern(step_length, 0.0, true);
+    q = Eigen::VectorXd(robot.dimq());
+    q << 0, 0, 0.4792, 0, 0, 0, 1,
+         -0.1,  0.7, -1.0,
+         -0.1, -0.7,  1.0,
+          0.1,  0.7, -1.0,
+          0.1, -0.7,  1.0;
+    v = Eigen::VectorXd::Zero(robot.dimv());
+    solver_options = SolverOptions();
+    solver_options.max_iter = 2;
+  }
+
+  virtual void TearDown() {
+  }
+
+  static std::vector<bool> isContactActive(const GaitTable& gait_table,
+                                           const int phase) {
+    std::vector<bool> is_contact_active(4, false);
+    for (const auto e : gait_table.activeContacts(phase)) {
+      is_contact_active[e] = true;
+    }
+    return is_contact_active;
+  }
+
+  Robot robot;
+  double T, dt, swing_height, gait_start_time;
+  int N, max_num_discrete_events;
+  GaitTable trot_table, pace_table;
+  std::shared_ptr<TrotFootStepPlanner> trot_planner;
+  std::shared_ptr<PaceFootStepPlanner> pace_planner;
+  Eigen::VectorXd q, v;
+  SolverOptions solver_options;
+};
+
+
+TEST_F(MPCGaitTest, invalidArguments) {
+  EXPECT_THROW(MPCGait(robot, T, N, -1), std::out_of_range);
+  MPCGait mpc(robot, T, N, max_num_discrete_events);
+  EXPECT_THROW(mpc.setGait(trot_planner, GaitTable(), swing_height, gait_start_time),
+               std::out_of_range);
+  EXPECT_THROW(mpc.setGait(trot_planner, trot_table, 0.0, gait_start_time),
+               std::out_of_range);
+  EXPECT_THROW(mpc.setGait(trot_planner, trot_table, swing_height, 0.0),
+               std::out_of_range);
+  const GaitTable invalid_table({{0, 4}, {0, 1, 2, 3}}, {0.2, 0.1});
+  EXPECT_THROW(mpc.setGait(trot_planner, invalid_table, swing_height, gait_start_time),
+               std::out_of_range);
+  mpc.setGait(trot_planner, trot_table, swing_height, gait_start_time);
+  EXPECT_THROW(mpc.init(gait_start_time, q, v, solver_options), std::out_of_range);
+}
+
+
+TEST_F(MPCGaitTest, init) {
+  MPCGait mpc(robot, T, N, max_num_discrete_events);
+  mpc.setGait(trot_planner, trot_table, swing_height, gait_start_time);
+  const double t0 = 0.0;
+  mpc.init(t0, q, v, solver_options);
+  const auto& contact_sequence = mpc.getContactSequence();
+  EXPECT_TRUE(contact_sequence->numContactPhases() > 1);
+  EXPECT_TRUE(contact_sequence->numDiscreteEvents() <= max_num_discrete_events);
+  EXPECT_EQ(contact_sequence->contactStatus(0).isContactActive(),
+            std::vector<bool>(4, true));
+  EXPECT_DOUBLE_EQ(contact_sequence->eventTimes().front(), gait_start_time);
+  for (int phase=1; phase<contact_sequence->numContactPhases(); ++phase) {
+    EXPECT_EQ(contact_sequence->contactStatus(phase).isContactActive(),
+              isContactActive(trot_table, (phase-1)%trot_table.numPhases()));
+  }
+  EXPECT_TRUE(std::isfinite(mpc.KKTError()));
+  EXPECT_TRUE(mpc.getInitialControlInput().allFinite());
+}
+
+
+TEST_F(MPCGaitTest, switchGait) {
+  MPCGait mpc(robot, T, N, max_num_discrete_events);
+  mpc.setGait(trot_planner, trot_table, swing_height, gait_start_time);
+  double t = 0.0;
+  mpc.init(t, q, v, solver_options);
+  // Steps into the first swing phase of the trot.
+  while (t < gait_start_time + 0.5*trot_table.duration(0)) {
+    mpc.updateSolution(t, dt, q, v);
+    t += dt;
+  }
+  const auto& contact_sequence = mpc.getContactSequence();
+  const std::vector<bool> current_phase
+      = contact_sequence->contactStatus(0).isContactActive();
+  EXPECT_EQ(current_phase, isContactActive(trot_table, 0));
+  const double next_event_time = contact_sequence->eventTimes().front();
+
+  mpc.switchGait(pace_planner, pace_table, swing_height, t, q);
+  EXPECT_EQ(mpc.getGaitTable().numPhases(), pace_table.numPhases());
+  for (int phase=0; phase<pace_table.numPhases(); ++phase) {
+    EXPECT_EQ(mpc.getGaitTable().activeContacts(phase),
+              pace_table.activeContacts(phase));
+    EXPECT_DOUBLE_EQ(mpc.getGaitTable().duration(phase),
+                     pace_table.duration(phase));
+  }
+  // The current phase is kept and the new gait starts at its end.
+  EXPECT_EQ(contact_sequence->contactStatus(0).isContactActive(), current_phase);
+  EXPECT_TRUE(contact_sequence->numContactPhases() > 1);
+  EXPECT_TRUE(contact_sequence->numDiscreteEvents() <= max_num_discrete_events);
+  EXPECT_DOUBLE_EQ(contact_sequence->eventTimes().front(), next_event_time);
+  // The phases of the new gait follow, those with the same active contacts as
+  // the preceding phase being merged into it.
+  int pace_phase = 0;
+  for (int phase=1; phase<contact_sequence->numContactPhases(); ++phase) {
+    const auto& prev_phase
+        = contact_sequence->contactStatus(phase-1).isContactActive();
+    while (isContactActive(pace_table, pace_phase) == prev_phase) {
+      pace_phase = (pace_phase+1) % pace_table.numPhases();
+    }
+    EXPECT_EQ(contact_sequence->contactStatus(phase).isContactActive(),
+              isContactActive(pace_table, pace_phase));
+    pace_phase = (pace_phase+1) % pace_table.numPhases();
+  }
+  for (int event=1; event<contact_sequence->numDiscreteEvents(); ++event) {
+    EXPECT_TRUE(contact_sequence->eventTimes()[event-1]
+                  < contact_sequence->eventTimes()[event]);
+  }
+
+  // The MPC keeps solving over the switch.
+  const double t_end = t + pace_table.period();
+  while (t < t_end) {
+    mpc.updateSolution(t, dt, q, v);
+    EXPECT_TRUE(std::isfinite(mpc.KKTError()));
+    EXPECT_TRUE(mpc.getInitialControlInput().allFinite());
+    t += dt;
+  }
+  EXPECT_TRUE(contact_sequence->numDiscreteEvents() <= max_num_discrete_events);
+}
+
+} // namespace robotoc
+
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
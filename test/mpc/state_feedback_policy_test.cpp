@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/mpc/state_feedback_policy.hpp"
+
+#include "robot_factory.hpp"
+
+
+namespace robotoc {
+
+class StateFeedbackPolicyTest : public ::testing::TestWithParam<Robot> {
+protected:
+  virtual void SetUp() {
+    srand((unsigned int) time(0));
+  }
+
+  virtual void TearDown() {
+  }
+};
+
+
+TEST_P(StateFeedbackPolicyTest, computeControlInput) {
+  const auto robot = GetParam();
+  StateFeedbackPolicy policy(robot);
+  EXPECT_EQ(policy.u.size(), robot.dimu());
+  EXPECT_EQ(policy.q.size(), robot.dimq());
+  EXPECT_EQ(policy.v.size(), robot.dimv());
+  EXPECT_EQ(policy.K.rows(), robot.dimu());
+  EXPECT_EQ(policy.K.cols(), 2*robot.dimv());
+  policy.u.setRandom();
+  policy.q = robot.generateFeasibleConfiguration();
+  policy.v.setRandom();
+  policy.K.setRandom();
+  const Eigen::VectorXd q = robot.generateFeasibleConfiguration();
+  const Eigen::VectorXd v = Eigen::VectorXd::Random(robot.dimv());
+  Eigen::VectorXd u = Eigen::VectorXd::Zero(robot.dimu());
+  policy.computeControlInput(robot, q, v, u);
+  Eigen::VectorXd dx = Eigen::VectorXd::Zero(2*robot.dimv());
+  robot.subtractConfiguration(q, policy.q, dx.head(robot.dimv()));
+  dx.tail(robot.dimv()) = v - policy.v;
+  const Eigen::VectorXd u_ref = policy.u + policy.K * dx;
+  EXPECT_TRUE(u.isApprox(u_ref));
+  // No feedback at the reference state.
+  policy.computeControlInput(robot, policy.q, policy.v, u);
+  EXPECT_TRUE(u.isApprox(policy.u));
+  if (robot.hasFloatingBase()) {
+    // The configuration error of the floating base is not the difference of 
+    // the configuration vectors.
+    Eigen::VectorXd dx_vec = Eigen::VectorXd::Zero(2*robot.dimv());
+    dx_vec.head(robot.dimv()) = (q - policy.q).tail(robot.dimv());
+    dx_vec.tail(robot.dimv()) = v - policy.v;
+    EXPECT_FALSE(dx_vec.isApprox(dx));
+  }
+  EXPECT_THROW(
+    policy.computeControlInput(robot, Eigen::VectorXd::Zero(robot.dimq()+1), v, u),
+    std::out_of_range
+  );
+  EXPECT_THROW(
+    policy.computeControlInput(robot, q, Eigen::VectorXd::Zero(robot.dimv()+1), u),
+    std::out_of_range
+  );
+}
+
+
+INSTANTIATE_TEST_SUITE_P(
+  TestWithMultipleRobots, StateFeedbackPolicyTest,
+  ::testing::Values(testhelper::CreateRobotManipulator(0.01),
+                    testhelper::CreateQuadrupedalRobot(0.01))
+);
+
+} // namespace robotoc
+
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
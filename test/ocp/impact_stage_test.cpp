@@ -133,11 +133,11 @@ TEST_P(ImpactStageTest, evalKKT) {
   auto d_ocp = d;
   const SplitDirection d_next = SplitDirection::Random(robot);
   stage.expandPrimal(grid_info, data, d);
-  stage.expandDual(grid_info, data, d_next, d);
+  stage.expandDual(robot, grid_info, data, d_next, d);
   d_ref.setContactDimension(impact_status.dimf());
   expandImpactDynamicsPrimal(data_ref.contact_dynamics_data, d_ref);
   constraints->expandSlackAndDual(impact_status, data_ref.constraints_data, d_ref);
-  expandImpactDynamicsDual(data_ref.contact_dynamics_data, d_next, d_ref);
+  expandImpactDynamicsDual(robot, data_ref.contact_dynamics_data, d_next, d_ref);
   correctCostateDirection(data_ref.state_equation_data, d_ref);
   EXPECT_TRUE(d.isApprox(d_ref));
 }
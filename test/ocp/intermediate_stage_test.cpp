@@ -180,11 +180,11 @@ TEST_P(IntermediateStageTest, evalKKT) {
   const SplitDirection d_next = SplitDirection::Random(robot);
   const double dts = (d.dts_next - d.dts) / grid_info.num_grids_in_phase;
   stage.expandPrimal(grid_info, data, d);
-  stage.expandDual(grid_info, data, d_next, d);
+  stage.expandDual(robot, grid_info, data, d_next, d);
   d_ref.setContactDimension(contact_status.dimf());
   expandContactDynamicsPrimal(data_ref.contact_dynamics_data, d_ref);
   constraints->expandSlackAndDual(contact_status, data_ref.constraints_data, d_ref);
-  expandContactDynamicsDual(grid_info.dt, dts, data_ref.contact_dynamics_data, d_next, d_ref);
+  expandContactDynamicsDual(robot, grid_info.dt, dts, data_ref.contact_dynamics_data, d_next, d_ref);
   correctCostateDirection(data_ref.state_equation_data, d_ref);
   EXPECT_TRUE(d.isApprox(d_ref));
 }
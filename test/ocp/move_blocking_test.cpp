@@ -0,0 +1,147 @@
+#include <vector>
+#include <memory>
+
+#include <gtest/gtest.h>
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/core/solution.hpp"
+#include "robotoc/planner/contact_sequence.hpp"
+#include "robotoc/ocp/time_discretization.hpp"
+#include "robotoc/ocp/move_blocking.hpp"
+
+#include "robot_factory.hpp"
+
+
+namespace robotoc {
+
+class MoveBlockingTest : public ::testing::TestWithParam<Robot> {
+protected:
+  virtual void SetUp() {
+    srand((unsigned int) time(0));
+    N = 20;
+    max_num_events = 5;
+    t = std::abs(Eigen::VectorXd::Random(1)[0]);
+    T = 1;
+    dt = T / N;
+    block_sizes = {1, 1, 2, 3, 4};
+  }
+
+  virtual void TearDown() {
+  }
+
+  std::shared_ptr<ContactSequence> createContactSequence(const Robot& robot) const;
+
+  int N, max_num_events;
+  double t, T, dt;
+  std::vector<int> block_sizes;
+};
+
+
+std::shared_ptr<ContactSequence> MoveBlockingTest::createContactSequence(const Robot& robot) const {
+  ContactStatus pre_contact_status = robot.createContactStatus();
+  pre_contact_status.setRandom();
+  auto contact_sequence = std::make_shared<ContactSequence>(robot, max_num_events);
+  contact_sequence->init(pre_contact_status);
+  ContactStatus post_contact_status = pre_contact_status;
+  const double event_period = 3 * dt;
+  for (int i=0; i<max_num_events; ++i) {
+    DiscreteEvent tmp(pre_contact_status, post_contact_status);
+    while (!tmp.existDiscreteEvent()) {
+      post_contact_status.setRandom();
+      tmp.setDiscreteEvent(pre_contact_status, post_contact_status);
+    }
+    const double event_time = t + i * event_period + dt * std::abs(Eigen::VectorXd::Random(1)[0]);
+    contact_sequence->push_back(tmp, event_time, false);
+    pre_contact_status = post_contact_status;
+  }
+  return contact_sequence;
+}
+
+
+TEST_P(MoveBlockingTest, withoutEvents) {
+  const auto robot = GetParam();
+  auto contact_sequence = std::make_shared<ContactSequence>(robot, max_num_events);
+  contact_sequence->init(robot.createContactStatus());
+  TimeDiscretization time_discretization(T, N, max_num_events);
+  time_discretization.discretize(contact_sequence, t);
+  MoveBlocking move_blocking(block_sizes);
+  EXPECT_TRUE(move_blocking.enabled());
+  EXPECT_EQ(move_blocking.blockSizes(), block_sizes);
+  move_blocking.update(time_discretization);
+  std::vector<bool> is_blocked_ref(N+1, false);
+  int grid = 0;
+  int num_blocked_grids = 0;
+  for (const auto e : block_sizes) {
+    for (int i=grid+1; i<grid+e; ++i) {
+      is_blocked_ref[i] = true;
+      ++num_blocked_grids;
+    }
+    grid += e;
+  }
+  for (int i=0; i<=N; ++i) {
+    EXPECT_EQ(move_blocking.isBlocked(i), is_blocked_ref[i]);
+  }
+  EXPECT_EQ(move_blocking.numBlockedGrids(), num_blocked_grids);
+  EXPECT_FALSE(move_blocking.isBlocked(N+10));
+  Solution s(N+1, SplitSolution::Random(robot));
+  for (auto& e : s) { e.u.setRandom(); }
+  move_blocking.projectSolution(s);
+  grid = 0;
+  for (const auto e : block_sizes) {
+    for (int i=grid+1; i<grid+e; ++i) {
+      EXPECT_TRUE(s[i].u.isApprox(s[grid].u));
+    }
+    grid += e;
+  }
+  EXPECT_FALSE(s[grid].u.isApprox(s[grid-1].u));
+  MoveBlocking no_move_blocking;
+  EXPECT_FALSE(no_move_blocking.enabled());
+  no_move_blocking.update(time_discretization);
+  for (int i=0; i<=N; ++i) {
+    EXPECT_FALSE(no_move_blocking.isBlocked(i));
+  }
+  EXPECT_THROW(MoveBlocking({1, 0, 2}), std::out_of_range);
+}
+
+
+TEST_P(MoveBlockingTest, withEvents) {
+  const auto robot = GetParam();
+  const auto contact_sequence = createContactSequence(robot);
+  TimeDiscretization time_discretization(T, N, max_num_events);
+  time_discretization.discretize(contact_sequence, t);
+  MoveBlocking move_blocking(std::vector<int>(N, 3));
+  move_blocking.update(time_discretization);
+  int num_blocked_grids = 0;
+  for (int i=0; i<time_discretization.size(); ++i) {
+    if (!move_blocking.isBlocked(i)) continue;
+    ++num_blocked_grids;
+    EXPECT_TRUE(MoveBlocking::isBlockable(time_discretization[i-1]));
+    EXPECT_TRUE(MoveBlocking::isBlockable(time_discretization[i]));
+    EXPECT_EQ(time_discretization[i].phase, time_discretization[i-1].phase);
+  }
+  EXPECT_EQ(move_blocking.numBlockedGrids(), num_blocked_grids);
+  EXPECT_GT(num_blocked_grids, 0);
+  for (int i=0; i<time_discretization.size(); ++i) {
+    const auto& grid = time_discretization[i];
+    if (grid.type != GridType::Intermediate || grid.switching_constraint) {
+      EXPECT_FALSE(move_blocking.isBlocked(i));
+      EXPECT_FALSE(move_blocking.isBlocked(i+1));
+    }
+  }
+}
+
+
+INSTANTIATE_TEST_SUITE_P(
+  TestWithMultipleRobots, MoveBlockingTest,
+  ::testing::Values(testhelper::CreateRobotManipulator(0.01),
+                    testhelper::CreateQuadrupedalRobot(0.01))
+);
+
+} // namespace robotoc
+
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
\ No newline at end of file
@@ -91,6 +91,159 @@ TEST_P(TimeDiscretizationTest, constructor) {
 }
 
 
+TEST_P(TimeDiscretizationTest, structureChanges) {
+  TimeDiscretization time_discretization(T, N, max_num_events);
+  const auto robot = GetParam();
+  const auto contact_sequence = createContactSequence(robot);
+  time_discretization.discretize(contact_sequence, t);
+  EXPECT_EQ(time_discretization.numStructureChangedGrids(), 
+            time_discretization.size());
+  for (int i=0; i<time_discretization.size(); ++i) {
+    EXPECT_TRUE(time_discretization.isStructureChanged(i));
+  }
+  time_discretization.discretize(contact_sequence, t);
+  EXPECT_EQ(time_discretization.numStructureChangedGrids(), 0);
+  for (int i=0; i<time_discretization.size(); ++i) {
+    EXPECT_FALSE(time_discretization.isStructureChanged(i));
+  }
+  // Moving the last event only changes the grids around it.
+  const int last_event_index = contact_sequence->numDiscreteEvents() - 1;
+  if (contact_sequence->eventType(last_event_index) == DiscreteEventType::Impact) {
+    const int impact_index = contact_sequence->numImpactEvents() - 1;
+    contact_sequence->setImpactTime(
+        impact_index, contact_sequence->impactTime(impact_index)+dt);
+  }
+  else {
+    const int lift_index = contact_sequence->numLiftEvents() - 1;
+    contact_sequence->setLiftTime(
+        lift_index, contact_sequence->liftTime(lift_index)+dt);
+  }
+  time_discretization.discretize(contact_sequence, t);
+  EXPECT_GT(time_discretization.numStructureChangedGrids(), 0);
+  EXPECT_LT(time_discretization.numStructureChangedGrids(), 
+            time_discretization.size());
+  EXPECT_FALSE(time_discretization.isStructureChanged(0));
+  EXPECT_FALSE(time_discretization.isStructureChanged(time_discretization.size()-1));
+  // Removing an event changes the structure of the contact sequence.
+  contact_sequence->pop_back();
+  time_discretization.discretize(contact_sequence, t);
+  EXPECT_EQ(time_discretization.numStructureChangedGrids(), 
+            time_discretization.size());
+}
+
+
+TEST_P(TimeDiscretizationTest, remesh) {
+  TimeDiscretization time_discretization(T, N, max_num_events);
+  const auto robot = GetParam();
+  const auto contact_sequence = createContactSequence(robot);
+  time_discretization.discretize(contact_sequence, t);
+  time_discretization.correctTimeSteps(contact_sequence, t);
+  const auto time_discretization_ref = time_discretization;
+  const int num_phases = time_discretization.numPhases();
+  std::vector<int> num_grids_in_phase(num_phases, 0);
+  for (int i=0; i<time_discretization_ref.size()-1; ++i) {
+    const auto& grid = time_discretization_ref[i];
+    if (grid.type == GridType::Impact) continue;
+    num_grids_in_phase[grid.phase-time_discretization_ref[0].phase] = grid.num_grids_in_phase;
+  }
+  // The same number of grids reproduces the phase-based discretization.
+  time_discretization.remesh(contact_sequence, t, num_grids_in_phase);
+  EXPECT_EQ(time_discretization.size(), time_discretization_ref.size());
+  EXPECT_EQ(time_discretization.numStructureChangedGrids(), 0);
+  for (int i=0; i<time_discretization.size(); ++i) {
+    EXPECT_TRUE(time_discretization[i].type == time_discretization_ref[i].type);
+    EXPECT_EQ(time_discretization[i].phase, time_discretization_ref[i].phase);
+    EXPECT_EQ(time_discretization[i].stage_in_phase, time_discretization_ref[i].stage_in_phase);
+    EXPECT_NEAR(time_discretization[i].t, time_discretization_ref[i].t, min_dt);
+    EXPECT_NEAR(time_discretization[i].dt, time_discretization_ref[i].dt, min_dt);
+  }
+  // Refine the last phase.
+  num_grids_in_phase.back() += 3;
+  time_discretization.remesh(contact_sequence, t, num_grids_in_phase);
+  EXPECT_EQ(time_discretization.size(), time_discretization_ref.size()+3);
+  EXPECT_EQ(time_discretization.numPhases(), num_phases);
+  EXPECT_FALSE(time_discretization.isStructureChanged(0));
+  EXPECT_TRUE(time_discretization.isStructureChanged(time_discretization.size()-1));
+  EXPECT_DOUBLE_EQ(time_discretization.back().t, t+T);
+  for (int i=0; i<time_discretization.size()-1; ++i) {
+    const auto& grid = time_discretization[i];
+    EXPECT_EQ(grid.stage, i);
+    EXPECT_NEAR(grid.t+grid.dt, time_discretization[i+1].t, min_dt);
+    if (grid.type == GridType::Impact) {
+      EXPECT_DOUBLE_EQ(grid.t, contact_sequence->impactTime(grid.impact_index));
+    }
+    else {
+      EXPECT_EQ(grid.num_grids_in_phase, 
+                num_grids_in_phase[grid.phase-time_discretization[0].phase]);
+    }
+    if (grid.type == GridType::Lift) {
+      EXPECT_DOUBLE_EQ(grid.t, contact_sequence->liftTime(grid.lift_index));
+    }
+  }
+  num_grids_in_phase.back() = 0;
+  EXPECT_THROW(time_discretization.remesh(contact_sequence, t, num_grids_in_phase), 
+               std::out_of_range);
+  num_grids_in_phase.push_back(1);
+  EXPECT_THROW(time_discretization.remesh(contact_sequence, t, num_grids_in_phase), 
+               std::out_of_range);
+}
+
+
+TEST_P(TimeDiscretizationTest, nonUniformTimeSteps) {
+  TimeDiscretization time_discretization(T, N, max_num_events);
+  const auto robot = GetParam();
+  const auto time_steps = TimeDiscretization::GeometricTimeSteps(T, N/2, 1.2);
+  ASSERT_EQ(time_steps.size(), N/2);
+  double sum = 0;
+  for (int i=0; i<time_steps.size(); ++i) {
+    sum += time_steps[i];
+    if (i > 0) {
+      EXPECT_DOUBLE_EQ(time_steps[i], 1.2*time_steps[i-1]);
+    }
+  }
+  EXPECT_DOUBLE_EQ(sum, T);
+  time_discretization.setTimeSteps(time_steps);
+  EXPECT_EQ(time_discretization.N(), N/2);
+  EXPECT_EQ(time_discretization.timeSteps(), time_steps);
+  // Without discrete events, the grids are the partial sums of the time steps.
+  auto contact_sequence = std::make_shared<ContactSequence>(robot, max_num_events);
+  contact_sequence->init(robot.createContactStatus());
+  time_discretization.discretize(contact_sequence, t);
+  ASSERT_EQ(time_discretization.size(), N/2+1);
+  double ti = t;
+  for (int i=0; i<N/2; ++i) {
+    EXPECT_NEAR(time_discretization[i].t, ti, min_dt);
+    EXPECT_NEAR(time_discretization[i].dt, time_steps[i], min_dt);
+    ti += time_steps[i];
+  }
+  EXPECT_DOUBLE_EQ(time_discretization.back().t, t+T);
+  // The discrete events are inserted between the non-uniform grids.
+  contact_sequence = createContactSequence(robot);
+  time_discretization.discretize(contact_sequence, t);
+  EXPECT_DOUBLE_EQ(time_discretization.back().t, t+T);
+  for (int i=0; i<time_discretization.size()-1; ++i) {
+    const auto& grid = time_discretization[i];
+    EXPECT_NEAR(grid.t+grid.dt, time_discretization[i+1].t, min_dt);
+    if (grid.type == GridType::Impact) {
+      EXPECT_DOUBLE_EQ(grid.t, contact_sequence->impactTime(grid.impact_index));
+    }
+    if (grid.type == GridType::Lift) {
+      EXPECT_DOUBLE_EQ(grid.t, contact_sequence->liftTime(grid.lift_index));
+    }
+  }
+  EXPECT_THROW(time_discretization.setTimeSteps(std::vector<double>()), 
+               std::out_of_range);
+  EXPECT_THROW(time_discretization.setTimeSteps(std::vector<double>(N, dt/2)), 
+               std::out_of_range);
+  auto time_steps_negative = time_steps;
+  time_steps_negative[0] = - time_steps_negative[0];
+  EXPECT_THROW(time_discretization.setTimeSteps(time_steps_negative), 
+               std::out_of_range);
+  EXPECT_THROW(TimeDiscretization::GeometricTimeSteps(T, 0, 1.2), 
+               std::out_of_range);
+}
+
+
 // TEST_P(TimeDiscretizationTest, discretizeGridBased) {
 //   TimeDiscretization time_discretization(T, N, max_num_events);
 //   const auto robot = GetParam();
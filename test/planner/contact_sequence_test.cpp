@@ -36,6 +36,7 @@ protected:
   void test_pop_back(const Robot& robot) const;
   void test_pop_front(const Robot& robot) const;
   void test_setContactPlacements(const Robot& robot) const;
+  void test_recedingHorizon(const Robot& robot) const;
 
   int max_num_each_events;
 };
@@ -312,6 +313,57 @@ void ContactSequenceTest::test_setContactPlacements(const Robot& robot) const {
 }
 
 
+void ContactSequenceTest::test_recedingHorizon(const Robot& robot) const {
+  const int reserved_num_discrete_events = 3;
+  ContactSequence contact_sequence(robot, reserved_num_discrete_events);
+  ContactStatus pre_contact_status = robot.createContactStatus();
+  pre_contact_status.setRandom();
+  contact_sequence.init(pre_contact_status);
+  double event_time = 0.1;
+  ContactStatus post_contact_status = robot.createContactStatus();
+  for (int step=0; step<50; ++step) {
+    if (contact_sequence.numDiscreteEvents() >= reserved_num_discrete_events) {
+      contact_sequence.pop_front();
+    }
+    DiscreteEvent discrete_event(pre_contact_status, post_contact_status);
+    while (!discrete_event.existDiscreteEvent()) {
+      post_contact_status.setRandom();
+      discrete_event.setDiscreteEvent(pre_contact_status, post_contact_status);
+    }
+    contact_sequence.push_back(discrete_event, event_time);
+    pre_contact_status = post_contact_status;
+    EXPECT_TRUE(contact_sequence.contactStatus(contact_sequence.numContactPhases()-1) 
+                  == discrete_event.postContactStatus());
+    event_time += 0.1;
+    EXPECT_TRUE(contact_sequence.numDiscreteEvents() <= reserved_num_discrete_events);
+    EXPECT_EQ(contact_sequence.reservedNumDiscreteEvents(), reserved_num_discrete_events);
+    EXPECT_EQ(contact_sequence.eventTimes().size(), contact_sequence.numDiscreteEvents());
+    int impact_index = 0;
+    int lift_index = 0;
+    for (int event_index=0; event_index<contact_sequence.numDiscreteEvents(); ++event_index) {
+      if (contact_sequence.eventType(event_index) == DiscreteEventType::Impact) {
+        contact_sequence.setImpactTime(impact_index, 
+                                       contact_sequence.impactTime(impact_index)+0.01);
+        EXPECT_DOUBLE_EQ(contact_sequence.eventTimes()[event_index], 
+                         contact_sequence.impactTime(impact_index));
+        ++impact_index;
+      }
+      else {
+        contact_sequence.setLiftTime(lift_index, 
+                                     contact_sequence.liftTime(lift_index)+0.01);
+        EXPECT_DOUBLE_EQ(contact_sequence.eventTimes()[event_index], 
+                         contact_sequence.liftTime(lift_index));
+        ++lift_index;
+      }
+    }
+    EXPECT_EQ(impact_index, contact_sequence.numImpactEvents());
+    EXPECT_EQ(lift_index, contact_sequence.numLiftEvents());
+    EXPECT_TRUE(contact_sequence.isEventTimeConsistent());
+    event_time += 0.01;
+  }
+}
+
+
 TEST_F(ContactSequenceTest, fixedBase) {
   const double dt = 0.001;
   auto robot = testhelper::CreateRobotManipulator(dt);
@@ -321,6 +373,7 @@ TEST_F(ContactSequenceTest, fixedBase) {
   test_pop_back(robot);
   test_pop_front(robot);
   test_setContactPlacements(robot);
+  test_recedingHorizon(robot);
 }
 
 
@@ -333,6 +386,7 @@ TEST_F(ContactSequenceTest, floatingBase) {
   test_pop_back(robot);
   test_pop_front(robot);
   test_setContactPlacements(robot);
+  test_recedingHorizon(robot);
 }
 
 } // namespace robotoc
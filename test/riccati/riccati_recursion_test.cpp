@@ -12,6 +12,7 @@
 #include "robotoc/riccati/lqr_policy.hpp"
 #include "robotoc/riccati/riccati_factorizer.hpp"
 #include "robotoc/riccati/riccati_recursion.hpp"
+#include "robotoc/ocp/move_blocking.hpp"
 
 #include "test_helper.hpp"
 #include "robot_factory.hpp"
@@ -63,6 +64,102 @@ TEST_P(RiccatiRecursionTest, riccatiRecursion) {
 }
 
 
+TEST_P(RiccatiRecursionTest, moveBlocking) {
+  const auto robot = GetParam();
+  auto cost = testhelper::CreateCost(robot);
+  auto constraints = testhelper::CreateConstraints(robot);
+  auto contact_sequence = std::make_shared<ContactSequence>(robot, max_num_impact);
+  contact_sequence->init(robot.createContactStatus());
+  OCP ocp(robot, cost, constraints, contact_sequence, T, N, max_num_impact);
+  TimeDiscretization time_discretization(T, N, max_num_impact);
+  time_discretization.discretize(contact_sequence, t);
+  MoveBlocking move_blocking({1, 3, 2, 5, 4});
+  move_blocking.update(time_discretization);
+  const int dimx = 2 * robot.dimv();
+  const int dimu = robot.dimu();
+  KKTMatrix kkt_matrix(N+1, SplitKKTMatrix(robot));
+  KKTResidual kkt_residual(N+1, SplitKKTResidual(robot));
+  for (int i=0; i<=N; ++i) {
+    const Eigen::MatrixXd seed = Eigen::MatrixXd::Random(dimx+dimu, dimx+dimu);
+    const Eigen::MatrixXd H = seed * seed.transpose() 
+                                + Eigen::MatrixXd::Identity(dimx+dimu, dimx+dimu);
+    kkt_matrix[i].Qxx = H.topLeftCorner(dimx, dimx);
+    kkt_matrix[i].Qxu = H.topRightCorner(dimx, dimu);
+    kkt_matrix[i].Quu = H.bottomRightCorner(dimu, dimu);
+    kkt_matrix[i].Fxx.setIdentity();
+    kkt_matrix[i].Fxx.noalias() += 0.1 * Eigen::MatrixXd::Random(dimx, dimx);
+    kkt_matrix[i].Fvu.setRandom();
+    kkt_residual[i].Fx.setRandom();
+    kkt_residual[i].lx.setRandom();
+    kkt_residual[i].lu.setRandom();
+  }
+  const auto kkt_matrix_ref = kkt_matrix;
+  const auto kkt_residual_ref = kkt_residual;
+  RiccatiRecursion riccati_recursion(ocp);
+  RiccatiFactorization factorization(N+1, SplitRiccatiFactorization(robot));
+  Direction d(N+1, SplitDirection(robot));
+  d[0].dx.setRandom();
+  riccati_recursion.backwardRiccatiRecursion(time_discretization, move_blocking,
+                                             kkt_matrix, kkt_residual, factorization);
+  riccati_recursion.forwardRiccatiRecursion(time_discretization, move_blocking,
+                                            kkt_matrix, kkt_residual, factorization, d);
+  // Solves the condensed problem whose decision variables are the control 
+  // inputs of the first grids of the blocks.
+  std::vector<int> block(N);
+  int num_blocks = 0;
+  for (int i=0; i<N; ++i) {
+    block[i] = move_blocking.isBlocked(i) ? block[i-1] : num_blocks++;
+  }
+  EXPECT_EQ(num_blocks, N-move_blocking.numBlockedGrids());
+  const int dimU = num_blocks * dimu;
+  std::vector<Eigen::VectorXd> x0(N+1);
+  std::vector<Eigen::MatrixXd> Gx(N+1);
+  x0[0] = d[0].dx;
+  Gx[0] = Eigen::MatrixXd::Zero(dimx, dimU);
+  for (int i=0; i<N; ++i) {
+    x0[i+1] = kkt_matrix_ref[i].Fxx * x0[i] + kkt_residual_ref[i].Fx;
+    Gx[i+1] = kkt_matrix_ref[i].Fxx * Gx[i];
+    Gx[i+1].bottomRows(robot.dimv()).middleCols(block[i]*dimu, dimu) 
+        += kkt_matrix_ref[i].Fvu;
+  }
+  Eigen::MatrixXd H = Eigen::MatrixXd::Zero(dimU, dimU);
+  Eigen::VectorXd g = Eigen::VectorXd::Zero(dimU);
+  for (int i=0; i<=N; ++i) {
+    H += Gx[i].transpose() * kkt_matrix_ref[i].Qxx * Gx[i];
+    g += Gx[i].transpose() * (kkt_matrix_ref[i].Qxx * x0[i] + kkt_residual_ref[i].lx);
+    if (i == N) break;
+    Eigen::MatrixXd Gu = Eigen::MatrixXd::Zero(dimu, dimU);
+    Gu.middleCols(block[i]*dimu, dimu).setIdentity();
+    const Eigen::MatrixXd GxtQxuGu = Gx[i].transpose() * kkt_matrix_ref[i].Qxu * Gu;
+    H += GxtQxuGu + GxtQxuGu.transpose();
+    H += Gu.transpose() * kkt_matrix_ref[i].Quu * Gu;
+    g += Gu.transpose() * (kkt_matrix_ref[i].Qxu.transpose() * x0[i] + kkt_residual_ref[i].lu);
+  }
+  const Eigen::VectorXd U = - H.ldlt().solve(g);
+  const double tol = 1.0e-08;
+  for (int i=0; i<N; ++i) {
+    EXPECT_TRUE(d[i].du.isApprox(U.segment(block[i]*dimu, dimu), tol));
+  }
+  for (int i=0; i<=N; ++i) {
+    EXPECT_TRUE(d[i].dx.isApprox(x0[i]+Gx[i]*U, tol));
+  }
+  Eigen::VectorXd dlmdgmm = kkt_matrix_ref[N].Qxx * d[N].dx + kkt_residual_ref[N].lx;
+  EXPECT_TRUE(d[N].dlmdgmm.isApprox(dlmdgmm, tol));
+  for (int i=N-1; i>=0; --i) {
+    dlmdgmm = kkt_matrix_ref[i].Fxx.transpose() * dlmdgmm;
+    dlmdgmm += kkt_matrix_ref[i].Qxx * d[i].dx + kkt_matrix_ref[i].Qxu * d[i].du 
+                + kkt_residual_ref[i].lx;
+    EXPECT_TRUE(d[i].dlmdgmm.isApprox(dlmdgmm, tol));
+  }
+  const auto& lqr_policy = riccati_recursion.getLQRPolicy();
+  for (int i=1; i<N; ++i) {
+    if (move_blocking.isBlocked(i)) {
+      EXPECT_TRUE(lqr_policy[i].K.isApprox(lqr_policy[i-1].K));
+    }
+  }
+}
+
+
 INSTANTIATE_TEST_SUITE_P(
   TestWithMultipleRobots, RiccatiRecursionTest, 
   ::testing::Values(testhelper::CreateRobotManipulator(),
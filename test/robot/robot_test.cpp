@@ -1,6 +1,10 @@
 #include <vector>
 #include <string>
 #include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <dirent.h>
+#include <unistd.h>
 
 #include <gtest/gtest.h>
 #include "Eigen/Core"
@@ -11,6 +15,7 @@
 #include "pinocchio/algorithm/crba.hpp"
 #include "pinocchio/algorithm/rnea.hpp"
 #include "pinocchio/algorithm/rnea-derivatives.hpp"
+#include "pinocchio/serialization/model.hpp"
 
 #include "robotoc/robot/point_contact.hpp"
 #include "robotoc/robot/robot.hpp"
@@ -48,6 +53,9 @@ TEST_P(RobotTest, constructor) {
   EXPECT_EQ(robot_empty.maxNumPointContacts(), 0);
   EXPECT_EQ(robot_empty.maxNumSurfaceContacts(), 0);
   EXPECT_FALSE(robot_empty.hasFloatingBase());
+  EXPECT_DOUBLE_EQ(robot_empty.totalMass(), 0);
+  const Robot robot_empty_copy = robot_empty;
+  EXPECT_DOUBLE_EQ(robot_empty_copy.totalMass(), 0);
 
   const auto model_info = GetParam();
   Robot robot(model_info);
@@ -114,6 +122,88 @@ TEST_P(RobotTest, constructor) {
 }
 
 
+TEST_P(RobotTest, modelCache) {
+  auto model_info = GetParam();
+  std::string cache_dir = ::testing::TempDir() + "robotoc_model_cache_XXXXXX";
+  ASSERT_NE(mkdtemp(&cache_dir[0]), nullptr);
+  model_info.model_cache_dir = cache_dir;
+  auto listCacheDir = [&]() {
+    std::vector<std::string> files;
+    DIR* dir = opendir(cache_dir.c_str());
+    for (dirent* e = readdir(dir); e != nullptr; e = readdir(dir)) {
+      const std::string name(e->d_name);
+      if (name != "." && name != "..") files.push_back(name);
+    }
+    closedir(dir);
+    return files;
+  };
+  const Robot robot_ref(GetParam());
+  const Robot robot_built(model_info);
+  // Exactly the cache file is created, i.e., no temporary file is left.
+  const std::vector<std::string> files = listCacheDir();
+  ASSERT_EQ(files.size(), 1u);
+  EXPECT_EQ(files[0].find("robotoc_model_"), 0u);
+  EXPECT_EQ(files[0].substr(files[0].size()-4), ".bin");
+  const std::string cache_path = cache_dir + "/" + files[0];
+  // Tags the cached model to detect whether the next build loads it.
+  pinocchio::Model model_cached;
+  model_cached.loadFromBinary(cache_path);
+  const double effort_limit_tag = 123.0;
+  model_cached.effortLimit.setConstant(effort_limit_tag);
+  model_cached.saveToBinary(cache_path);
+  Robot robot_loaded(model_info);
+  EXPECT_TRUE(robot_loaded.jointEffortLimit().isConstant(effort_limit_tag));
+  EXPECT_EQ(robot_loaded.dimq(), robot_ref.dimq());
+  EXPECT_EQ(robot_loaded.dimv(), robot_ref.dimv());
+  EXPECT_EQ(robot_loaded.dimu(), robot_ref.dimu());
+  EXPECT_EQ(robot_loaded.max_dimf(), robot_ref.max_dimf());
+  EXPECT_EQ(robot_loaded.contactFrameNames(), robot_ref.contactFrameNames());
+  EXPECT_DOUBLE_EQ(robot_loaded.totalMass(), robot_ref.totalMass());
+  EXPECT_TRUE(robot_loaded.lowerJointPositionLimit().isApprox(robot_ref.lowerJointPositionLimit()));
+  EXPECT_TRUE(robot_loaded.upperJointPositionLimit().isApprox(robot_ref.upperJointPositionLimit()));
+  Robot robot(GetParam());
+  const Eigen::VectorXd q = robot.generateFeasibleConfiguration();
+  robot.updateFrameKinematics(q);
+  robot_loaded.updateFrameKinematics(q);
+  EXPECT_TRUE(robot_loaded.CoM().isApprox(robot.CoM()));
+  EXPECT_EQ(listCacheDir().size(), 1u);
+  EXPECT_EQ(std::remove(cache_path.c_str()), 0);
+  EXPECT_EQ(rmdir(cache_dir.c_str()), 0);
+}
+
+
+TEST_P(RobotTest, lockedJoints) {
+  auto model_info = GetParam();
+  const Robot robot_ref(GetParam());
+  pinocchio::Model model_ref;
+  if (model_info.base_joint_type == BaseJointType::FloatingBase) {
+    pinocchio::urdf::buildModel(model_info.urdf_path, pinocchio::JointModelFreeFlyer(), model_ref);
+  }
+  else {
+    pinocchio::urdf::buildModel(model_info.urdf_path, model_ref);
+  }
+  const std::string locked_joint = model_ref.names.back();
+  const auto& joint = model_ref.joints.back();
+  const Eigen::VectorXd q_locked 
+      = pinocchio::neutral(model_ref).segment(joint.idx_q(), joint.nq());
+  model_info.locked_joints[locked_joint] = q_locked;
+  const Robot robot(model_info);
+  EXPECT_EQ(robot.dimq(), robot_ref.dimq()-joint.nq());
+  EXPECT_EQ(robot.dimv(), robot_ref.dimv()-joint.nv());
+  EXPECT_EQ(robot.dimu(), robot_ref.dimu()-joint.nv());
+  EXPECT_EQ(robot.dim_passive(), robot_ref.dim_passive());
+  EXPECT_EQ(robot.max_dimf(), robot_ref.max_dimf());
+  EXPECT_EQ(robot.contactFrameNames(), robot_ref.contactFrameNames());
+  EXPECT_DOUBLE_EQ(robot.totalMass(), robot_ref.totalMass());
+  auto model_info_invalid = GetParam();
+  model_info_invalid.locked_joints["not_a_joint"] = q_locked;
+  EXPECT_THROW(Robot{model_info_invalid}, std::invalid_argument);
+  model_info_invalid = GetParam();
+  model_info_invalid.locked_joints[locked_joint] = Eigen::VectorXd::Zero(joint.nq()+1);
+  EXPECT_THROW(Robot{model_info_invalid}, std::invalid_argument);
+}
+
+
 TEST_P(RobotTest, integrateConfiguration) {
   const auto model_info = GetParam();
   Robot robot(model_info);
@@ -276,6 +366,58 @@ TEST_P(RobotTest, frameKinematics) {
 }
 
 
+TEST_P(RobotTest, kinematicsCache) {
+  const auto model_info = GetParam();
+  Robot robot(model_info);
+  pinocchio::Model model;
+  if (model_info.base_joint_type == BaseJointType::FloatingBase) {
+    pinocchio::urdf::buildModel(model_info.urdf_path, pinocchio::JointModelFreeFlyer(), model);
+  }
+  else {
+    pinocchio::urdf::buildModel(model_info.urdf_path, model);
+  }
+  auto data = pinocchio::Data(model);
+  const int frame_id = model.nframes - 1;
+
+  const Eigen::VectorXd q = pinocchio::randomConfiguration(
+      model, -Eigen::VectorXd::Ones(model.nq), Eigen::VectorXd::Ones(model.nq));
+  const Eigen::VectorXd v = Eigen::VectorXd::Random(model.nv);
+  const Eigen::VectorXd a = Eigen::VectorXd::Random(model.nv);
+  robot.updateKinematics(q, v, a);
+  Eigen::MatrixXd J = Eigen::MatrixXd::Zero(6, model.nv);
+  robot.getFrameJacobian(frame_id, J);
+  robot.updateFrameKinematics(q);
+  robot.updateKinematics(q, v);
+  Eigen::MatrixXd J_same_q = Eigen::MatrixXd::Zero(6, model.nv);
+  robot.getFrameJacobian(frame_id, J_same_q);
+  EXPECT_TRUE(J_same_q.isApprox(J));
+  pinocchio::framesForwardKinematics(model, data, q);
+  EXPECT_TRUE(robot.framePlacement(frame_id).isApprox(data.oMf[frame_id]));
+
+  const Eigen::VectorXd q_new = pinocchio::randomConfiguration(
+      model, -Eigen::VectorXd::Ones(model.nq), Eigen::VectorXd::Ones(model.nq));
+  // RNEA at another configuration overwrites the joint placements, so the 
+  // cached kinematics at q are recomputed by updateFrameKinematics().
+  Eigen::VectorXd tau = Eigen::VectorXd::Zero(model.nv);
+  robot.RNEA(q_new, v, a, tau);
+  robot.updateFrameKinematics(q);
+  Eigen::MatrixXd J_recomputed = Eigen::MatrixXd::Zero(6, model.nv);
+  robot.getFrameJacobian(frame_id, J_recomputed);
+  EXPECT_TRUE(J_recomputed.isApprox(J));
+  EXPECT_TRUE(robot.framePlacement(frame_id).isApprox(data.oMf[frame_id]));
+
+  robot.updateFrameKinematics(q_new);
+  pinocchio::framesForwardKinematics(model, data, q_new);
+  EXPECT_TRUE(robot.framePlacement(frame_id).isApprox(data.oMf[frame_id]));
+  robot.updateKinematics(q_new);
+  robot.getFrameJacobian(frame_id, J);
+  pinocchio::computeJointJacobians(model, data, q_new);
+  Eigen::MatrixXd J_ref = Eigen::MatrixXd::Zero(6, model.nv);
+  pinocchio::getFrameJacobian(model, data, frame_id, pinocchio::LOCAL, J_ref);
+  EXPECT_TRUE(J.isApprox(J_ref));
+}
+
+
 TEST_P(RobotTest, transformFromLocalToWorld) {
   const auto model_info = GetParam();
   Robot robot(model_info);
@@ -727,11 +869,29 @@ TEST_P(RobotTest, MJtJinv) {
     MJtJ.bottomRightCorner(dimf, dimf).diagonal().array() = - model_info.contact_inv_damping;
     const Eigen::MatrixXd MJtJinv_ref = MJtJ.inverse();
     EXPECT_TRUE(MJtJinv.isApprox(MJtJinv_ref));
+    const Eigen::MatrixXd B = Eigen::MatrixXd::Random(model.nv+dimf, 2*model.nv);
+    Eigen::MatrixXd X = B;
+    robot.solveMJtJ(X);
+    EXPECT_TRUE(X.isApprox(MJtJinv_ref*B));
+    X = B;
+    robot.factorizeMJtJ(dRNEA_da, J);
+    robot.solveMJtJ(X);
+    EXPECT_TRUE(X.isApprox(MJtJinv_ref*B));
+    if (dimf == 3) {
+      X = B;
+      robot.factorizeMJtJ<3>(dRNEA_da, J);
+      robot.solveMJtJ(X);
+      EXPECT_TRUE(X.isApprox(MJtJinv_ref*B));
+    }
   }
   Eigen::MatrixXd Minv = dRNEA_da;
   robot.computeMinv(dRNEA_da, Minv);
   EXPECT_TRUE((dRNEA_da*Minv).isIdentity());
   EXPECT_TRUE((Minv*dRNEA_da).isIdentity());
+  const Eigen::VectorXd b = Eigen::VectorXd::Random(model.nv);
+  Eigen::VectorXd x = b;
+  robot.solveMJtJ(x);
+  EXPECT_TRUE(x.isApprox(Minv*b));
 }
 
 
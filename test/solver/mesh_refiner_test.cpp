@@ -0,0 +1,130 @@
+#include <vector>
+#include <memory>
+#include <limits>
+
+#include <gtest/gtest.h>
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/core/solution.hpp"
+#include "robotoc/planner/contact_sequence.hpp"
+#include "robotoc/ocp/time_discretization.hpp"
+#include "robotoc/solver/mesh_refiner.hpp"
+
+#include "robot_factory.hpp"
+#include "contact_sequence_factory.hpp"
+
+
+namespace robotoc {
+
+class MeshRefinerTest : public ::testing::TestWithParam<Robot> {
+protected:
+  virtual void SetUp() {
+    srand((unsigned int) time(0));
+    N = 20;
+    max_num_impacts = 3;
+    t = std::abs(Eigen::VectorXd::Random(1)[0]);
+    T = 1;
+    dt = T / N;
+    tol = 1.0e-03;
+    coarsening_ratio = 0.1;
+  }
+
+  virtual void TearDown() {
+  }
+
+  std::vector<int> numGridsInPhase(const TimeDiscretization& time_discretization) const;
+
+  int N, max_num_impacts;
+  double t, T, dt, tol, coarsening_ratio;
+};
+
+
+std::vector<int> MeshRefinerTest::numGridsInPhase(
+    const TimeDiscretization& time_discretization) const {
+  std::vector<int> num_grids_in_phase(time_discretization.numPhases(), 0);
+  for (int i=0; i<time_discretization.size()-1; ++i) {
+    const auto& grid = time_discretization[i];
+    if (grid.type == GridType::Impact) continue;
+    num_grids_in_phase[grid.phase-time_discretization[0].phase]
+        = grid.num_grids_in_phase;
+  }
+  return num_grids_in_phase;
+}
+
+
+TEST_P(MeshRefinerTest, estimateError) {
+  const auto robot = GetParam();
+  auto grid = GridInfo::Random();
+  grid.type = GridType::Intermediate;
+  auto grid_next = grid;
+  const auto s = SplitSolution::Random(robot);
+  const auto s_next = SplitSolution::Random(robot);
+  const double error_ref
+      = 0.5 * grid.dt * (grid.dt * s.a.lpNorm<Eigen::Infinity>()
+                          + (s_next.a-s.a).lpNorm<Eigen::Infinity>());
+  EXPECT_DOUBLE_EQ(MeshRefiner::estimateError(grid, s, grid_next, s_next),
+                   error_ref);
+  grid_next.type = GridType::Impact;
+  EXPECT_DOUBLE_EQ(MeshRefiner::estimateError(grid, s, grid_next, s_next),
+                   0.5*grid.dt*grid.dt*s.a.lpNorm<Eigen::Infinity>());
+}
+
+
+TEST_P(MeshRefinerTest, refine) {
+  const auto robot = GetParam();
+  const auto contact_sequence
+      = testhelper::CreateContactSequence(robot, N, max_num_impacts, t+3*dt, 3*dt);
+  TimeDiscretization time_discretization(T, N, 2*max_num_impacts);
+  time_discretization.discretize(contact_sequence, t);
+  time_discretization.correctTimeSteps(contact_sequence, t);
+  const auto num_grids_in_phase = numGridsInPhase(time_discretization);
+  Solution s(time_discretization.size(), SplitSolution(robot));
+  MeshRefiner mesh_refiner(tol, coarsening_ratio);
+  // zero acceleration: every phase is coarsened.
+  for (auto& e : s) { e.a.setZero(); }
+  EXPECT_TRUE(mesh_refiner.refine(time_discretization, s));
+  ASSERT_EQ(mesh_refiner.numGridsInPhase().size(), num_grids_in_phase.size());
+  for (int i=0; i<num_grids_in_phase.size(); ++i) {
+    EXPECT_EQ(mesh_refiner.numGridsInPhase()[i], (num_grids_in_phase[i]+1)/2);
+    EXPECT_DOUBLE_EQ(mesh_refiner.phaseErrors()[i], 0);
+  }
+  // max_dt bounds the time steps.
+  const double max_dt = 0.5 * dt;
+  EXPECT_TRUE(mesh_refiner.refine(time_discretization, s, max_dt));
+  std::vector<double> phase_duration(num_grids_in_phase.size(), 0);
+  for (int i=0; i<time_discretization.size()-1; ++i) {
+    const auto& grid = time_discretization[i];
+    phase_duration[grid.phase-time_discretization[0].phase] += grid.dt;
+  }
+  for (int i=0; i<num_grids_in_phase.size(); ++i) {
+    EXPECT_LE(phase_duration[i]/mesh_refiner.numGridsInPhase()[i], 
+              max_dt+std::numeric_limits<double>::epsilon());
+  }
+  // large acceleration: every phase is refined.
+  for (auto& e : s) { e.a.setConstant(1.0e03); }
+  EXPECT_TRUE(mesh_refiner.refine(time_discretization, s));
+  for (int i=0; i<num_grids_in_phase.size(); ++i) {
+    EXPECT_EQ(mesh_refiner.numGridsInPhase()[i], 2*num_grids_in_phase[i]);
+    EXPECT_GT(mesh_refiner.phaseErrors()[i], tol);
+  }
+  time_discretization.remesh(contact_sequence, t, mesh_refiner.numGridsInPhase());
+  EXPECT_EQ(numGridsInPhase(time_discretization), mesh_refiner.numGridsInPhase());
+  EXPECT_THROW(MeshRefiner(0, coarsening_ratio), std::out_of_range);
+  EXPECT_THROW(MeshRefiner(tol, 1.0), std::out_of_range);
+}
+
+
+INSTANTIATE_TEST_SUITE_P(
+  TestWithMultipleRobots, MeshRefinerTest,
+  ::testing::Values(testhelper::CreateRobotManipulator(0.01),
+                    testhelper::CreateQuadrupedalRobot(0.01))
+);
+
+} // namespace robotoc
+
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
\ No newline at end of file
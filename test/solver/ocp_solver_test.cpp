@@ -135,6 +135,63 @@ TEST_F(OCPSolverTest, test) {
   ocp_solver.solve(t, q, v);
   const auto result = ocp_solver.getSolverStatistics();
   EXPECT_TRUE(result.convergence);
+
+  // Warm start by the LQR policy rollout from a perturbed initial state. 
+  // The solvers only initialize the solution without any iteration.
+  Eigen::VectorXd v_pushed = v;
+  v_pushed(0) += 0.05;
+  auto ocp_solver_linear = ocp_solver;
+  solver_options.max_iter = 0;
+  solver_options.interpolation_order = robotoc::InterpolationOrder::Linear;
+  ocp_solver_linear.setSolverOptions(solver_options);
+  ocp_solver_linear.solve(t, q, v_pushed, true);
+  // The solution set between two solves does not replace the solution of the
+  // previous solve from which the next solve is initialized.
+  auto ocp_solver_reset = ocp_solver;
+  ocp_solver_reset.setSolverOptions(solver_options);
+  ocp_solver_reset.setSolution("v", v_pushed);
+  ocp_solver_reset.solve(t, q, v_pushed, true);
+  for (int i=0; i<ocp_solver_linear.getTimeDiscretization().size(); ++i) {
+    EXPECT_TRUE(ocp_solver_reset.getSolution(i).q.isApprox(ocp_solver_linear.getSolution(i).q));
+    EXPECT_TRUE(ocp_solver_reset.getSolution(i).v.isApprox(ocp_solver_linear.getSolution(i).v));
+  }
+  auto ocp_solver_rollout = ocp_solver;
+  solver_options.interpolation_order = robotoc::InterpolationOrder::LQRRollout;
+  ocp_solver_rollout.setSolverOptions(solver_options);
+  ocp_solver_rollout.solve(t, q, v_pushed, true);
+  // The rollout starts from the pushed state, while the linear interpolation 
+  // keeps the previous solution.
+  EXPECT_TRUE(ocp_solver_rollout.getSolution(0).q.isApprox(q));
+  EXPECT_TRUE(ocp_solver_rollout.getSolution(0).v.isApprox(v_pushed));
+  EXPECT_FALSE(ocp_solver_linear.getSolution(0).v.isApprox(v_pushed));
+  EXPECT_FALSE(ocp_solver_rollout.getSolution(1).v.isApprox(ocp_solver_linear.getSolution(1).v));
+
+  solver_options.max_iter = 100;
+  ocp_solver_rollout.setSolverOptions(solver_options);
+  const double t_next = t + 0.01;
+  ocp_solver_rollout.solve(t_next, q, v_pushed, true);
+  EXPECT_TRUE(ocp_solver_rollout.getSolverStatistics().convergence);
+
+  // The rollout keeps the control inputs of the move-blocked grids tied.
+  ocp.move_blocking = {5, 5, 5};
+  robotoc::OCPSolver ocp_solver_blocked(ocp, solver_options);
+  ocp_solver_blocked.discretize(t);
+  ocp_solver_blocked.setSolution("q", q);
+  ocp_solver_blocked.setSolution("v", v);
+  ocp_solver_blocked.setSolution("f", f_init);
+  ocp_solver_blocked.solve(t, q, v);
+  EXPECT_TRUE(ocp_solver_blocked.getSolverStatistics().convergence);
+  solver_options.max_iter = 0;
+  ocp_solver_blocked.setSolverOptions(solver_options);
+  ocp_solver_blocked.solve(t, q, v_pushed, true);
+  const auto& move_blocking = ocp_solver_blocked.getMoveBlocking();
+  EXPECT_GT(move_blocking.numBlockedGrids(), 0);
+  for (int i=1; i<ocp_solver_blocked.getTimeDiscretization().size(); ++i) {
+    if (move_blocking.isBlocked(i)) {
+      EXPECT_TRUE(ocp_solver_blocked.getSolution(i).u.isApprox(
+                      ocp_solver_blocked.getSolution(i-1).u));
+    }
+  }
 }
 
 } // namespace robotoc
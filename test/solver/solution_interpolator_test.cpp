@@ -0,0 +1,203 @@
+#include <memory>
+
+#include <gtest/gtest.h>
+#include "Eigen/Core"
+
+#include "robotoc/robot/robot.hpp"
+#include "robotoc/core/solution.hpp"
+#include "robotoc/planner/contact_sequence.hpp"
+#include "robotoc/ocp/time_discretization.hpp"
+#include "robotoc/solver/solution_interpolator.hpp"
+
+#include "robot_factory.hpp"
+#include "contact_sequence_factory.hpp"
+
+
+namespace robotoc {
+
+class SolutionInterpolatorTest : public ::testing::TestWithParam<Robot> {
+protected:
+  virtual void SetUp() {
+    srand((unsigned int) time(0));
+    N = 20;
+    max_num_impacts = 3;
+    t = std::abs(Eigen::VectorXd::Random(1)[0]);
+    T = 1;
+    dt = T / N;
+  }
+
+  virtual void TearDown() {
+  }
+
+  int N, max_num_impacts;
+  double t, T, dt;
+};
+
+
+TEST_P(SolutionInterpolatorTest, sameTimeDiscretization) {
+  const auto robot = GetParam();
+  const auto contact_sequence
+      = testhelper::CreateContactSequence(robot, N, max_num_impacts, t+3*dt, 3*dt);
+  TimeDiscretization time_discretization(T, N, 2*max_num_impacts);
+  time_discretization.discretize(contact_sequence, t);
+  Solution s(time_discretization.size(), SplitSolution::Random(robot));
+  for (auto& e : s) { e.v.setRandom(); }
+  SolutionInterpolator solution_interpolator;
+  Solution s_interpolated(time_discretization.size(), SplitSolution(robot));
+  solution_interpolator.interpolate(robot, time_discretization, s_interpolated);
+  EXPECT_FALSE(solution_interpolator.hasStoredSolution());
+  solution_interpolator.store(time_discretization, s);
+  EXPECT_TRUE(solution_interpolator.hasStoredSolution());
+  solution_interpolator.interpolate(robot, time_discretization, s_interpolated);
+  for (int i=0; i<time_discretization.size(); ++i) {
+    EXPECT_TRUE(s_interpolated[i].v.isApprox(s[i].v));
+  }
+}
+
+
+TEST_P(SolutionInterpolatorTest, swap) {
+  const auto robot = GetParam();
+  const auto contact_sequence
+      = testhelper::CreateContactSequence(robot, N, max_num_impacts, t+3*dt, 3*dt);
+  TimeDiscretization time_discretization(T, N, 2*max_num_impacts);
+  time_discretization.discretize(contact_sequence, t);
+  Solution s(time_discretization.size(), SplitSolution::Random(robot));
+  for (auto& e : s) { 
+    e.v.setRandom(); 
+    e.u.setRandom(); 
+    e.lmd.setRandom(); 
+  }
+  SolutionInterpolator copy_interpolator, swap_interpolator;
+  copy_interpolator.store(time_discretization, s);
+  Solution s_copy(time_discretization.size(), SplitSolution(robot));
+  Solution s_swap = s;
+  swap_interpolator.storeBySwap(time_discretization, s_swap);
+  const double t_next = t + 0.3 * dt;
+  time_discretization.discretize(contact_sequence, t_next);
+  while (s_copy.size() < time_discretization.size()) {
+    s_copy.push_back(SplitSolution(robot));
+    s_swap.push_back(SplitSolution(robot));
+  }
+  copy_interpolator.interpolate(robot, time_discretization, s_copy);
+  swap_interpolator.interpolate(robot, time_discretization, s_swap);
+  ASSERT_GE(s_swap.size(), time_discretization.size());
+  for (int i=0; i<time_discretization.size(); ++i) {
+    EXPECT_TRUE(s_swap[i].v.isApprox(s_copy[i].v));
+    EXPECT_TRUE(s_swap[i].u.isApprox(s_copy[i].u));
+    EXPECT_TRUE(s_swap[i].lmd.isApprox(s_copy[i].lmd));
+  }
+  // The swapped solution is kept as the stored solution.
+  Solution s_copy_again(time_discretization.size(), SplitSolution(robot));
+  Solution s_swap_again(time_discretization.size(), SplitSolution(robot));
+  copy_interpolator.interpolate(robot, time_discretization, s_copy_again);
+  swap_interpolator.interpolate(robot, time_discretization, s_swap_again);
+  for (int i=0; i<time_discretization.size(); ++i) {
+    EXPECT_TRUE(s_swap_again[i].v.isApprox(s_copy_again[i].v));
+  }
+}
+
+
+TEST_P(SolutionInterpolatorTest, detachStoredSolution) {
+  const auto robot = GetParam();
+  const auto contact_sequence
+      = testhelper::CreateContactSequence(robot, N, max_num_impacts, t+3*dt, 3*dt);
+  TimeDiscretization time_discretization(T, N, 2*max_num_impacts);
+  time_discretization.discretize(contact_sequence, t);
+  Solution s(time_discretization.size(), SplitSolution::Random(robot));
+  for (auto& e : s) { 
+    e.v.setRandom(); 
+    e.u.setRandom(); 
+  }
+  SolutionInterpolator copy_interpolator, swap_interpolator;
+  copy_interpolator.store(time_discretization, s);
+  Solution s_swap = s;
+  swap_interpolator.storeBySwap(time_discretization, s_swap);
+  // The values are modified after the detach, e.g., by OCPSolver::setSolution().
+  swap_interpolator.detachStoredSolution(s_swap);
+  for (auto& e : s_swap) { 
+    e.v.setRandom(); 
+  }
+  const double t_next = t + 0.3 * dt;
+  time_discretization.discretize(contact_sequence, t_next);
+  Solution s_copy(time_discretization.size(), SplitSolution(robot));
+  while (s_swap.size() < time_discretization.size()) {
+    s_swap.push_back(SplitSolution(robot));
+  }
+  copy_interpolator.interpolate(robot, time_discretization, s_copy);
+  swap_interpolator.interpolate(robot, time_discretization, s_swap);
+  for (int i=0; i<time_discretization.size(); ++i) {
+    EXPECT_TRUE(s_swap[i].v.isApprox(s_copy[i].v));
+    EXPECT_TRUE(s_swap[i].u.isApprox(s_copy[i].u));
+  }
+}
+
+
+TEST_P(SolutionInterpolatorTest, swapWithContactStatusChange) {
+  const auto robot = GetParam();
+  const auto contact_sequence
+      = testhelper::CreateContactSequence(robot, N, max_num_impacts, t+3*dt, 3*dt);
+  TimeDiscretization time_discretization(T, N, 2*max_num_impacts);
+  time_discretization.discretize(contact_sequence, t);
+  Solution s(time_discretization.size(), SplitSolution(robot));
+  for (int i=0; i<time_discretization.size(); ++i) {
+    const auto& grid = time_discretization[i];
+    if (grid.type == GridType::Impact) {
+      s[i].setRandom(robot, contact_sequence->impactStatus(grid.impact_index));
+    }
+    else {
+      s[i].setRandom(robot, contact_sequence->contactStatus(grid.phase));
+    }
+  }
+  SolutionInterpolator copy_interpolator, swap_interpolator;
+  copy_interpolator.store(time_discretization, s);
+  Solution s_copy(time_discretization.size(), SplitSolution(robot));
+  Solution s_swap = s;
+  swap_interpolator.storeBySwap(time_discretization, s_swap);
+  // The contact status and the switching constraint dimension are updated 
+  // between storeBySwap() and interpolate(), as OCPSolver::resizeData() does.
+  const double t_next = t + 0.3 * dt;
+  time_discretization.discretize(contact_sequence, t_next);
+  while (s_copy.size() < time_discretization.size()) {
+    s_copy.push_back(SplitSolution(robot));
+    s_swap.push_back(SplitSolution(robot));
+  }
+  auto contact_status = robot.createContactStatus();
+  for (auto& e : s_swap) {
+    e.setContactStatus(contact_status);
+    e.setSwitchingConstraintDimension(0);
+  }
+  copy_interpolator.interpolate(robot, time_discretization, s_copy);
+  swap_interpolator.interpolate(robot, time_discretization, s_swap);
+  for (int i=0; i<time_discretization.size(); ++i) {
+    EXPECT_TRUE(s_swap[i].q.isApprox(s_copy[i].q));
+    EXPECT_TRUE(s_swap[i].v.isApprox(s_copy[i].v));
+    EXPECT_TRUE(s_swap[i].u.isApprox(s_copy[i].u));
+    ASSERT_EQ(s_swap[i].f.size(), s_copy[i].f.size());
+    for (int j=0; j<s_copy[i].f.size(); ++j) {
+      EXPECT_TRUE(s_swap[i].f[j].isApprox(s_copy[i].f[j]));
+    }
+    ASSERT_EQ(s_swap[i].mu.size(), s_copy[i].mu.size());
+    for (int j=0; j<s_copy[i].mu.size(); ++j) {
+      EXPECT_TRUE(s_swap[i].mu[j].isApprox(s_copy[i].mu[j]));
+    }
+    if (time_discretization[i].type == GridType::Impact && i >= 2) {
+      EXPECT_EQ(s_swap[i-2].dims(), s_copy[i-2].dims());
+      EXPECT_TRUE(s_swap[i-2].xi_stack().isApprox(s_copy[i-2].xi_stack()));
+    }
+  }
+}
+
+
+INSTANTIATE_TEST_SUITE_P(
+  TestWithMultipleRobots, SolutionInterpolatorTest,
+  ::testing::Values(testhelper::CreateRobotManipulator(0.01),
+                    testhelper::CreateQuadrupedalRobot(0.01))
+);
+
+} // namespace robotoc
+
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,169 @@
+#include <deque>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include "Eigen/Core"
+
+#include "robotoc/utils/ring_buffer.hpp"
+
+
+namespace robotoc {
+
+class RingBufferTest : public ::testing::Test {
+protected:
+  virtual void SetUp() {
+  }
+
+  virtual void TearDown() {
+  }
+
+  template <typename T>
+  static void expectEqual(const RingBuffer<T>& buffer, const std::deque<T>& ref) {
+    ASSERT_EQ(buffer.size(), ref.size());
+    EXPECT_EQ(buffer.empty(), ref.empty());
+    for (int i=0; i<ref.size(); ++i) {
+      EXPECT_EQ(buffer[i], ref[i]);
+    }
+    int i = 0;
+    for (const auto& e : buffer) {
+      EXPECT_EQ(e, ref[i]);
+      ++i;
+    }
+    EXPECT_EQ(i, ref.size());
+    if (!ref.empty()) {
+      EXPECT_EQ(buffer.front(), ref.front());
+      EXPECT_EQ(buffer.back(), ref.back());
+    }
+  }
+};
+
+
+TEST_F(RingBufferTest, constructor) {
+  RingBuffer<int> buffer(5);
+  EXPECT_EQ(buffer.size(), 0);
+  EXPECT_EQ(buffer.capacity(), 5);
+  EXPECT_TRUE(buffer.empty());
+  RingBuffer<int> buffer_default;
+  EXPECT_EQ(buffer_default.size(), 0);
+  EXPECT_EQ(buffer_default.capacity(), 0);
+  EXPECT_TRUE(buffer_default.empty());
+}
+
+
+TEST_F(RingBufferTest, wrapAround) {
+  const int capacity = 4;
+  RingBuffer<int> buffer(capacity);
+  std::deque<int> ref;
+  for (int i=0; i<capacity; ++i) {
+    buffer.push_back(i);
+    ref.push_back(i);
+  }
+  expectEqual(buffer, ref);
+  // The head moves forward and the back wraps around the end of the storage.
+  for (int i=capacity; i<10*capacity; ++i) {
+    buffer.pop_front();
+    ref.pop_front();
+    buffer.push_back(i);
+    ref.push_back(i);
+    expectEqual(buffer, ref);
+    EXPECT_EQ(buffer.capacity(), capacity);
+  }
+  buffer.pop_back();
+  ref.pop_back();
+  buffer.pop_front();
+  ref.pop_front();
+  expectEqual(buffer, ref);
+  buffer.front() = -1;
+  buffer.back() = -2;
+  ref.front() = -1;
+  ref.back() = -2;
+  expectEqual(buffer, ref);
+  EXPECT_EQ(buffer.capacity(), capacity);
+  buffer.clear();
+  ref.clear();
+  expectEqual(buffer, ref);
+  EXPECT_EQ(buffer.capacity(), capacity);
+}
+
+
+TEST_F(RingBufferTest, grow) {
+  const int capacity = 3;
+  RingBuffer<int> buffer(capacity);
+  std::deque<int> ref;
+  for (int i=0; i<capacity; ++i) {
+    buffer.push_back(i);
+    ref.push_back(i);
+  }
+  // Move the head so that the elements wrap around before the growth.
+  buffer.pop_front();
+  ref.pop_front();
+  buffer.push_back(capacity);
+  ref.push_back(capacity);
+  expectEqual(buffer, ref);
+  buffer.push_back(capacity+1);
+  ref.push_back(capacity+1);
+  expectEqual(buffer, ref);
+  EXPECT_EQ(buffer.capacity(), 2*capacity);
+  for (int i=capacity+2; i<20; ++i) {
+    buffer.push_back(i);
+    ref.push_back(i);
+    expectEqual(buffer, ref);
+    EXPECT_GE(buffer.capacity(), buffer.size());
+  }
+  RingBuffer<int> buffer_default;
+  buffer_default.push_back(0);
+  EXPECT_EQ(buffer_default.size(), 1);
+  EXPECT_EQ(buffer_default.capacity(), 1);
+  EXPECT_EQ(buffer_default.front(), 0);
+}
+
+
+TEST_F(RingBufferTest, reserve) {
+  const int capacity = 4;
+  RingBuffer<int> buffer(capacity);
+  std::deque<int> ref;
+  for (int i=0; i<capacity; ++i) {
+    buffer.push_back(i);
+    ref.push_back(i);
+  }
+  buffer.pop_front();
+  ref.pop_front();
+  buffer.push_back(capacity);
+  ref.push_back(capacity);
+  buffer.reserve(capacity-1);
+  EXPECT_EQ(buffer.capacity(), capacity);
+  expectEqual(buffer, ref);
+  buffer.reserve(3*capacity);
+  EXPECT_EQ(buffer.capacity(), 3*capacity);
+  expectEqual(buffer, ref);
+  for (int i=capacity+1; i<3*capacity+1; ++i) {
+    buffer.push_back(i);
+    ref.push_back(i);
+  }
+  EXPECT_EQ(buffer.capacity(), 3*capacity);
+  expectEqual(buffer, ref);
+}
+
+
+TEST_F(RingBufferTest, eigenVector) {
+  const int capacity = 2;
+  const int dim = 4;
+  RingBuffer<Eigen::VectorXd> buffer(capacity, Eigen::VectorXd::Zero(dim));
+  std::vector<Eigen::VectorXd> ref;
+  for (int i=0; i<5; ++i) {
+    ref.push_back(Eigen::VectorXd::Random(dim));
+    buffer.push_back(ref.back());
+  }
+  ASSERT_EQ(buffer.size(), ref.size());
+  for (int i=0; i<ref.size(); ++i) {
+    EXPECT_TRUE(buffer[i].isApprox(ref[i]));
+  }
+}
+
+} // namespace robotoc
+
+
+int main(int argc, char** argv) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}